@@ -0,0 +1,95 @@
+//
+//  benchConcurrentMutableArray.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Contended producers and consumers on one ConcurrentMutableArray.
+ * Every producer adds ITEMS objects and consumers pop until all of them are consumed, one by one with popObject or
+ * BATCH at a time by waiting for the first with popObjectWaiting and draining the rest with drainObjectsIntoArray. */
+#define ITEMS 20000UL
+#define MAX_THREADS 8
+#define BATCH 64UL
+
+struct _Worker {
+	ConcurrentMutableArrayRef array;
+	ObjectRef item;
+	UInteger total;
+	bool batched;
+};
+
+static UInteger consumed;
+
+static void * produce(void *argument) {
+	struct _Worker *worker = argument;
+	for (UInteger i=0; i<ITEMS; i++)
+		addObject(worker->array, worker->item);
+	return NULL;
+}
+
+static void consumeBatches(struct _Worker *worker) {
+	MutableArrayRef batch = new(MutableArray, NULL);
+	while ( __atomic_load_n(&consumed, __ATOMIC_RELAXED) < worker->total ) {
+		ObjectRef item = popObjectWaiting(worker->array, 1);
+		if ( item == NULL )
+			continue;
+		release(item);
+		UInteger count = 1 + drainObjectsIntoArray(worker->array, batch, BATCH - 1);
+		removeAllObjects(batch);
+		__atomic_fetch_add(&consumed, count, __ATOMIC_RELAXED);
+	}
+	release(batch);
+}
+
+static void * consume(void *argument) {
+	struct _Worker *worker = argument;
+	if ( worker->batched )
+		return consumeBatches(worker), NULL;
+	while ( __atomic_load_n(&consumed, __ATOMIC_RELAXED) < worker->total ) {
+		ObjectRef item = popObject(worker->array);
+		if ( item != NULL ) {
+			release(item);
+			__atomic_fetch_add(&consumed, 1, __ATOMIC_RELAXED);
+		}
+	}
+	return NULL;
+}
+
+int main () {
+	StringRef item = new(String, "item", NULL);
+
+	for (UInteger run=0; run<2*3; run++) {
+		UInteger pairs = 1UL << (run / 2);
+		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
+		struct _Worker worker = { array, item, pairs * ITEMS, run % 2 };
+		ThreadRef threads[MAX_THREADS];
+		consumed = 0;
+
+		double start = cobench_now();
+		for (UInteger i=0; i<pairs; i++) {
+			threads[2*i] = new(Thread, produce, &worker, NULL);
+			threads[2*i+1] = new(Thread, consume, &worker, NULL);
+			startThread(threads[2*i]);
+			startThread(threads[2*i+1]);
+		}
+		for (UInteger i=0; i<2*pairs; i++)
+			joinThread(threads[i], NULL), release(threads[i]);
+		double elapsed = cobench_now() - start;
+
+		printf("%lu producer(s) / %lu consumer(s)%-10s %14.2f ns/item %14.0f items/s\n", pairs, pairs, worker.batched ? " batched" : "", elapsed / worker.total, worker.total / (elapsed / 1e9));
+#ifdef __PROFILING__
+		ConcurrentMutableArrayPrintfStatistics(array);
+#endif
+		release(array);
+	}
+
+	release(item);
+	return EXIT_SUCCESS;
+}
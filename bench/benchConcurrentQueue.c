@@ -0,0 +1,120 @@
+//
+//  benchConcurrentQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Hands TOTAL objects from producers to consumers, half of the threads each, through a ConcurrentQueue (non
+ * blocking and blocking methods) and through a ConcurrentMutableArray. One thread enqueues and dequeues in turn. */
+#define TOTAL 192000UL
+#define CAPACITY 1024UL
+#define MAX_THREADS 32
+
+enum _Kind { QueueTry, QueueBlocking, LockedArray };
+
+struct _Worker {
+	enum _Kind kind;
+	void *container;
+	ObjectRef item;
+	UInteger items;
+};
+
+static void put(struct _Worker *worker) {
+	switch (worker->kind) {
+		case QueueTry:
+			while ( ! tryEnqueueObject(worker->container, worker->item) )
+				sched_yield();
+			break;
+		case QueueBlocking:
+			enqueueObject(worker->container, worker->item);
+			break;
+		case LockedArray:
+			addObject(worker->container, worker->item);
+			break;
+	}
+}
+
+static ObjectRef get(struct _Worker *worker) {
+	ObjectRef item = NULL;
+	switch (worker->kind) {
+		case QueueTry:
+			while ( (item = tryDequeueObject(worker->container)) == NULL )
+				sched_yield();
+			break;
+		case QueueBlocking:
+			item = dequeueObject(worker->container);
+			break;
+		case LockedArray:
+			while ( (item = popObject(worker->container)) == NULL )
+				sched_yield();
+			break;
+	}
+	return item;
+}
+
+static void * produce(void *argument) {
+	struct _Worker *worker = argument;
+	for (UInteger i=0; i<worker->items; i++)
+		put(worker);
+	return NULL;
+}
+
+static void * consume(void *argument) {
+	struct _Worker *worker = argument;
+	for (UInteger i=0; i<worker->items; i++)
+		release(get(worker));
+	return NULL;
+}
+
+static void * alternate(void *argument) {
+	struct _Worker *worker = argument;
+	for (UInteger i=0; i<worker->items; i++) {
+		put(worker);
+		release(get(worker));
+	}
+	return NULL;
+}
+
+static void run(const char *name, enum _Kind kind, UInteger threadCount, ObjectRef item) {
+	void *container = (kind == LockedArray) ? new(ConcurrentMutableArray, NULL) : new(ConcurrentQueue, CAPACITY, NULL);
+	UInteger pairs = threadCount / 2;
+	struct _Worker worker = { kind, container, item, pairs ? TOTAL / pairs : TOTAL };
+	ThreadRef threads[MAX_THREADS];
+
+	double start = cobench_now();
+	if ( pairs == 0 ) {
+		threads[0] = new(Thread, alternate, &worker, NULL);
+		startThread(threads[0]);
+	}
+	for (UInteger i=0; i<pairs; i++) {
+		threads[2*i] = new(Thread, produce, &worker, NULL);
+		threads[2*i+1] = new(Thread, consume, &worker, NULL);
+		startThread(threads[2*i]);
+		startThread(threads[2*i+1]);
+	}
+	for (UInteger i=0; i<(pairs ? 2*pairs : 1); i++)
+		joinThread(threads[i], NULL), release(threads[i]);
+	double elapsed = cobench_now() - start;
+
+	printf("%-28s %2lu thread(s) %12.2f ns/item %14.0f items/s\n", name, threadCount, elapsed / TOTAL, TOTAL / (elapsed / 1e9));
+	release(container);
+}
+
+int main () {
+	StringRef item = new(String, "item", NULL);
+	for (UInteger threads=1; threads<=MAX_THREADS; threads*=2) {
+		run("ConcurrentQueue (try)", QueueTry, threads, item);
+		run("ConcurrentQueue (blocking)", QueueBlocking, threads, item);
+		run("ConcurrentMutableArray", LockedArray, threads, item);
+	}
+	release(item);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,44 @@
+//
+//  benchConstructor.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cobj.h>
+#include "cobench.h"
+
+#define ITERATIONS 1000000UL
+
+int main () {
+	StringRef key = new(String, "key", NULL);
+	StringRef value = new(String, "value", NULL);
+	
+	cobench_run("new(String)", ITERATIONS, {
+		release(new(String, "a short dictionary key", NULL));
+	});
+	cobench_run("newWithArguments(String)", ITERATIONS, {
+		release(newWithArguments(String, &(StringArguments){ "a short dictionary key", 0 }));
+	});
+	
+	cobench_run("new(Couple)", ITERATIONS, {
+		release(new(Couple, key, value, NULL));
+	});
+	cobench_run("newWithArguments(Couple)", ITERATIONS, {
+		release(newWithArguments(Couple, &(CoupleArguments){ key, value }));
+	});
+	
+	cobench_run("new(Value)", ITERATIONS, {
+		release(new(Value, key, NULL, NULL));
+	});
+	cobench_run("newWithArguments(Value)", ITERATIONS, {
+		release(newWithArguments(Value, &(ValueArguments){ key, NULL }));
+	});
+	
+	release(key);
+	release(value);
+	return EXIT_SUCCESS;
+}
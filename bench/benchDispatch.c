@@ -0,0 +1,85 @@
+//
+//  benchDispatch.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cobj.h>
+#include <counchecked.h>
+#include "cobench.h"
+
+#define ITERATIONS 10000000UL
+
+/* Keeps the results alive */
+static volatile UInteger sink;
+
+int main () {
+	StringRef string = new(String, "a short dictionary key", NULL);
+	StringRef other = new(String, "a short dictionary key", NULL);
+	ArrayRef array = new(Array, string, other, string, other, NULL);
+
+	cobench_run("retain+release", ITERATIONS, {
+		release(retain(string));
+	});
+	cobench_run("uncheckedRetain+uncheckedRelease", ITERATIONS, {
+		uncheckedRelease(uncheckedRetain(string));
+	});
+
+	cobench_run("retainCount", ITERATIONS, {
+		sink += retainCount(string);
+	});
+	cobench_run("uncheckedRetainCount", ITERATIONS, {
+		sink += uncheckedRetainCount(string);
+	});
+
+	cobench_run("hash", ITERATIONS, {
+		sink += hash(string);
+	});
+	cobench_run("uncheckedHash", ITERATIONS, {
+		sink += uncheckedHash(string);
+	});
+
+	cobench_run("equals", ITERATIONS, {
+		sink += equals(string, other);
+	});
+	cobench_run("uncheckedEquals", ITERATIONS, {
+		sink += uncheckedEquals(string, other);
+	});
+
+	cobench_run("getStringLength", ITERATIONS, {
+		sink += getStringLength(string);
+	});
+	cobench_run("uncheckedGetStringLength", ITERATIONS, {
+		sink += uncheckedGetStringLength(string);
+	});
+
+	cobench_run("getCollectionCount", ITERATIONS, {
+		sink += getCollectionCount(array);
+	});
+	cobench_run("uncheckedGetCollectionCount", ITERATIONS, {
+		sink += uncheckedGetCollectionCount(array);
+	});
+
+	cobench_run("getObjectAtIndex", ITERATIONS, {
+		sink += (UInteger)getObjectAtIndex(array, 2);
+	});
+	cobench_run("uncheckedGetObjectAtIndex", ITERATIONS, {
+		sink += (UInteger)uncheckedGetObjectAtIndex(array, 2);
+	});
+
+	cobench_run("lastObject", ITERATIONS, {
+		sink += (UInteger)lastObject(array);
+	});
+	cobench_run("uncheckedLastObject", ITERATIONS, {
+		sink += (UInteger)uncheckedLastObject(array);
+	});
+
+	release(array);
+	release(other);
+	release(string);
+	return EXIT_SUCCESS;
+}
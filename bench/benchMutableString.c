@@ -0,0 +1,73 @@
+//
+//  benchMutableString.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Builds a MutableString of SIZE bytes (100 MB, or the first argument in MB) from 16 byte pieces appended with
+ * appendString, appendBytes, appendCharacter and appendFormat, with and without reserving the capacity first; then
+ * appends the same pieces to a plain buffer with strcat, which rescans the text on every call, for a size small
+ * enough to finish. */
+#define SIZE (100UL << 20)
+#define PIECE "0123456789abcdef"
+#define PIECE_LENGTH 16UL
+#define STRCAT_SIZE (1UL << 20)
+
+static void report(const char *name, UInteger size, double elapsed) {
+	printf("%-40s %10.2f ms %10.1f MB/s\n", name, elapsed / 1e6, (double)size / (1 << 20) / (elapsed / 1e9));
+}
+
+static void build(const char *name, UInteger size, bool reserve, int kind) {
+	StringRef piece = new(String, PIECE, NULL);
+	MutableStringRef string = new(MutableString, "", NULL);
+	double start = cobench_now();
+	if ( reserve )
+		reserveMutableStringCapacity(string, size);
+	for (UInteger length=0; length<size; length+=PIECE_LENGTH) {
+		switch ( kind ) {
+			case 0: appendString(string, piece); break;
+			case 1: appendBytes(string, PIECE, PIECE_LENGTH); break;
+			case 2: for (UInteger i=0; i<PIECE_LENGTH; i++) appendCharacter(string, PIECE[i]); break;
+			default: appendFormat(string, "%08lx%08lx", length, size - length); break;
+		}
+	}
+	double elapsed = cobench_now() - start;
+	if ( getStringLength(string) != size )
+		fprintf(stderr, "%s: built %lu bytes instead of %lu\n", name, getStringLength(string), size);
+	report(name, size, elapsed);
+	release(string);
+	release(piece);
+}
+
+static void buildWithStrcat(UInteger size) {
+	char *text = calloc(size + 1, sizeof(char));
+	double start = cobench_now();
+	for (UInteger length=0; length<size; length+=PIECE_LENGTH)
+		strcat(text, PIECE);
+	double elapsed = cobench_now() - start;
+	char name[48];
+	snprintf(name, sizeof(name), "strcat (%lu MB)", size >> 20);
+	report(name, size, elapsed);
+	free(text);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger size = argc > 1 ? strtoul(argv[1], NULL, 10) << 20 : SIZE;
+	build("appendString", size, NO, 0);
+	build("appendString (reserved)", size, YES, 0);
+	build("appendBytes", size, NO, 1);
+	build("appendBytes (reserved)", size, YES, 1);
+	build("appendCharacter", size, NO, 2);
+	build("appendFormat", size, NO, 3);
+	build("appendFormat (reserved)", size, YES, 3);
+	buildWithStrcat(STRCAT_SIZE);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+//
+//  benchParallel.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* The parallel algorithms of ThreadPool over a Vector of ELEMENTS objects, on 1 to all online processors: hashing
+ * Strings with parallelForRange, filtering and mapping Values with parallelMapIntoVector, and summing Values with
+ * parallelReduce in both modes. The serial loops give the baseline the speedups are measured against. */
+#define ELEMENTS 2000000UL
+
+static void hashRange(const void *const collection, Range range, void *context) {
+	UInteger accumulated = 0;
+	for (UInteger i=range.location; i<MaxRange(range); i++)
+		accumulated ^= hash(getObjectAtIndex(collection, i));
+	__atomic_xor_fetch((UInteger *)context, accumulated, __ATOMIC_RELAXED);
+}
+
+static ObjectRef keepEven(ObjectRef object, void *context) {
+	UInteger payload = (UInteger)(uintptr_t)getValuePointer(object);
+	return (payload % 2) ? NULL : object;
+}
+
+static void sum(void *accumulator, ObjectRef object, void *context) {
+	*(UInteger *)accumulator += (UInteger)(uintptr_t)getValuePointer(object);
+}
+
+static void add(void *accumulator, const void *partial, void *context) {
+	*(UInteger *)accumulator += *(const UInteger *)partial;
+}
+
+static void report(const char *name, UInteger workers, double elapsed, double serial) {
+	printf("%-34s %3lu worker(s) %10.2f ms %8.2f ns/element  x%.2f\n", name, workers, elapsed / 1e6, elapsed / ELEMENTS, serial / elapsed);
+}
+
+int main () {
+	VectorRef strings = new(Vector, ELEMENTS, 0UL, NULL);
+	VectorRef values = new(Vector, ELEMENTS, 0UL, NULL);
+	for (UInteger i=0; i<ELEMENTS; i++) {
+		StringRef string = newStringWithFormat(String, "element %lu", i);
+		ValueRef value = new(Value, (void *)(uintptr_t)(i + 1), NULL, NULL);
+		addObject(strings, string), addObject(values, value);
+		release(string), release(value);
+	}
+
+	/* Once untimed, so that the first pass over the strings is not charged to the baseline */
+	UInteger accumulated = 0;
+	hashRange(strings, MakeRange(0, ELEMENTS), &accumulated);
+	double start = cobench_now();
+	hashRange(strings, MakeRange(0, ELEMENTS), &accumulated);
+	double serialHash = cobench_now() - start;
+	report("hash (serial)", 1, serialHash, serialHash);
+
+	start = cobench_now();
+	VectorRef kept = new(Vector, 0UL, 0UL, NULL);
+	for (UInteger i=0; i<ELEMENTS; i++) {
+		ObjectRef object = keepEven(getObjectAtIndex(values, i), NULL);
+		if ( object ) addObject(kept, object);
+	}
+	double serialFilter = cobench_now() - start;
+	release(kept);
+	report("filter (serial)", 1, serialFilter, serialFilter);
+
+	UInteger total = 0;
+	start = cobench_now();
+	for (UInteger i=0; i<ELEMENTS; i++)
+		sum(&total, getObjectAtIndex(values, i), NULL);
+	double serialSum = cobench_now() - start;
+	report("sum (serial)", 1, serialSum, serialSum);
+
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	UInteger maxWorkers = processors > 0 ? (UInteger)processors : 1;
+	for (UInteger workers=1; ; workers = (2 * workers < maxWorkers) ? 2 * workers : maxWorkers) {
+		ThreadPoolRef pool = new(ThreadPool, workers, NULL);
+
+		start = cobench_now();
+		parallelForRange(pool, strings, hashRange, &accumulated, ThreadPoolParallelAdaptive);
+		report("hash (parallelForRange)", workers, cobench_now() - start, serialHash);
+
+		kept = new(Vector, 0UL, 0UL, NULL);
+		start = cobench_now();
+		parallelMapIntoVector(pool, values, kept, keepEven, NULL, ThreadPoolParallelAdaptive);
+		report("filter (parallelMapIntoVector)", workers, cobench_now() - start, serialFilter);
+		release(kept);
+
+		total = 0;
+		start = cobench_now();
+		parallelReduce(pool, values, &total, sizeof(UInteger), sum, add, NULL, ThreadPoolParallelAdaptive);
+		report("sum (parallelReduce, adaptive)", workers, cobench_now() - start, serialSum);
+
+		total = 0;
+		start = cobench_now();
+		parallelReduce(pool, values, &total, sizeof(UInteger), sum, add, NULL, ThreadPoolParallelOrdered);
+		report("sum (parallelReduce, ordered)", workers, cobench_now() - start, serialSum);
+
+		release(pool);
+		if ( workers == maxWorkers )
+			break;
+	}
+
+	release(strings), release(values);
+	return EXIT_SUCCESS;
+}
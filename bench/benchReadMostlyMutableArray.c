@@ -0,0 +1,84 @@
+//
+//  benchReadMostlyMutableArray.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* A table of ROUTES objects read by 1 to MAX_THREADS threads, READS lookups each, while one writer replaces a route
+ * every UPDATE_PERIOD lookups of the first reader; on a ConcurrentMutableArray and on a ReadMostlyMutableArray. */
+#define ROUTES 64UL
+#define READS 400000UL
+#define UPDATE_PERIOD 50000UL
+#define MAX_THREADS 8
+
+struct _Reader {
+	void *table;
+	UInteger found;
+};
+
+static UInteger Progress;
+
+static void * lookup(void *argument) {
+	struct _Reader *reader = argument;
+	for (UInteger i=0; i<READS; i++) {
+		UInteger count = getCollectionCount(reader->table);
+		if ( getObjectAtIndex(reader->table, i % count) != NULL )
+			reader->found++;
+		__atomic_store_n(&Progress, i, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+static void run(const char *name, const void *class, UInteger threadCount, ObjectRef route) {
+	void *table = new(class, NULL);
+	for (UInteger i=0; i<ROUTES; i++)
+		addObject(table, route);
+	struct _Reader readers[MAX_THREADS];
+	ThreadRef threads[MAX_THREADS];
+	Progress = 0;
+
+	double start = cobench_now();
+	for (UInteger i=0; i<threadCount; i++) {
+		readers[i] = (struct _Reader){ table, 0 };
+		threads[i] = new(Thread, lookup, &readers[i], NULL);
+		startThread(threads[i]);
+	}
+	/* The writer: updates are rare compared to the lookups */
+	for (UInteger next=UPDATE_PERIOD; next<READS; next+=UPDATE_PERIOD) {
+		while ( __atomic_load_n(&Progress, __ATOMIC_RELAXED) < next )
+			sched_yield();
+		release(popObject(table));
+		addObject(table, route);
+	}
+	for (UInteger i=0; i<threadCount; i++)
+		joinThread(threads[i], NULL), release(threads[i]);
+	double elapsed = cobench_now() - start;
+
+	UInteger lookups = threadCount * READS;
+	printf("%-24s %lu reader(s) %10.2f ns/lookup %14.0f lookups/s\n", name, threadCount, elapsed / lookups, lookups / (elapsed / 1e9));
+#ifdef __PROFILING__
+	if ( classOf(table) == ReadMostlyMutableArray )
+		ReadMostlyMutableArrayPrintfStatistics(table);
+	else
+		ConcurrentMutableArrayPrintfStatistics(table);
+#endif
+	release(table);
+}
+
+int main () {
+	StringRef route = new(String, "route", NULL);
+	for (UInteger threads=1; threads<=MAX_THREADS; threads*=2) {
+		run("ConcurrentMutableArray", ConcurrentMutableArray, threads, route);
+		run("ReadMostlyMutableArray", ReadMostlyMutableArray, threads, route);
+	}
+	release(route);
+	return EXIT_SUCCESS;
+}
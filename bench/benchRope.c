@@ -0,0 +1,66 @@
+//
+//  benchRope.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Applies EDITS edits (the first argument if any) to a document of DOCUMENT bytes, as an editor would: a word typed
+ * or a few characters deleted at a random place, then a few more characters typed right after. Prints the edits per
+ * second of a MutableString and of a Rope, and the time the rope takes to materialize the document. */
+#define DOCUMENT (4UL << 20)
+#define EDITS 20000UL
+
+static double run(void *const document, UInteger edits, StringRef *const words) {
+	srand(50);
+	double start = cobench_now();
+	for (UInteger e=0; e<edits; e++) {
+		UInteger length = getStringLength(document);
+		UInteger location = (UInteger)rand() % length;
+		if ( rand() % 4 ) {
+			insertStringAtMutableStringIndex(document, words[rand() % 4], location);
+			insertStringAtMutableStringIndex(document, words[4], location + getStringLength(words[rand() % 4]) / 2);
+		}
+		else
+			deleteMutableStringCharactersInRange(document, MakeRange(location, location + 8 <= length ? 8 : length - location));
+	}
+	return cobench_now() - start;
+}
+
+int main (int argc, char *argv[]) {
+	UInteger edits = argc > 1 ? strtoul(argv[1], NULL, 10) : EDITS;
+	char *text = malloc(DOCUMENT + 1);
+	for (UInteger i=0; i<DOCUMENT; i++)
+		text[i] = (i % 64 == 63) ? '\n' : (char)('a' + i % 26);
+	text[DOCUMENT] = '\0';
+	StringRef words[] = { new(String, "the ", NULL), new(String, "document ", NULL), new(String, "editor ", NULL), new(String, "rope ", NULL), new(String, "x", NULL) };
+
+	MutableStringRef mutableString = new(MutableString, text, NULL);
+	double elapsed = run(mutableString, edits, words);
+	printf("%-28s %10.2f ms %12.0f edits/s\n", "MutableString", elapsed / 1e6, edits / (elapsed / 1e9));
+
+	RopeRef rope = new(Rope, text, NULL);
+	elapsed = run(rope, edits, words);
+	printf("%-28s %10.2f ms %12.0f edits/s %8lu chunks\n", "Rope", elapsed / 1e6, edits / (elapsed / 1e9), getRopeChunkCount(rope));
+
+	double start = cobench_now();
+	StringRef string = copyRopeAsString(rope);
+	printf("%-28s %10.2f ms\n", "Rope materialized", (cobench_now() - start) / 1e6);
+	if ( getStringLength(string) != getStringLength(mutableString) || memcmp(getStringText(string), getStringText(mutableString), getStringLength(string)) != 0 )
+		fprintf(stderr, "the rope and the mutable string differ\n");
+
+	release(string);
+	release(rope);
+	release(mutableString);
+	for (UInteger w=0; w<sizeof(words)/sizeof(words[0]); w++)
+		release(words[w]);
+	free(text);
+	return EXIT_SUCCESS;
+}
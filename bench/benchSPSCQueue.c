@@ -0,0 +1,138 @@
+//
+//  benchSPSCQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Streams ITEMS objects from one Thread to another through an SPSCQueue, one by one and in batches, and through a
+ * ConcurrentQueue; then ping-pongs one object ROUNDS times between two Threads over two SPSCQueues and prints the
+ * round trip latency as a log2 histogram. */
+#define ITEMS 4000000UL
+#define BATCH 64UL
+#define CAPACITY 4096UL
+#define ROUNDS 200000UL
+#define BUCKETS 40
+
+struct _Stream {
+	void *queue;
+	ObjectRef item;
+	UInteger batch;
+};
+
+static void * produce(void *argument) {
+	struct _Stream *stream = argument;
+	void *items[BATCH];
+	for (UInteger i=0; i<BATCH; i++)
+		items[i] = stream->item;
+	for (UInteger sent=0; sent<ITEMS; ) {
+		UInteger count = (stream->batch == 1) ? (UInteger)tryEnqueueObject(stream->queue, stream->item) : tryEnqueueObjects(stream->queue, items, stream->batch);
+		if ( count == 0 )
+			sched_yield();
+		sent += count;
+	}
+	return NULL;
+}
+
+static void consume(struct _Stream *stream) {
+	ObjectRef items[BATCH];
+	for (UInteger received=0; received<ITEMS; ) {
+		UInteger count = 0;
+		if ( stream->batch == 1 )
+			count = (items[0] = tryDequeueObject(stream->queue)) != NULL;
+		else
+			count = tryDequeueObjects(stream->queue, items, stream->batch);
+		for (UInteger i=0; i<count; i++)
+			release(items[i]);
+		if ( count == 0 )
+			sched_yield();
+		received += count;
+	}
+}
+
+static void stream(const char *name, const void *class, UInteger batch, ObjectRef item) {
+	struct _Stream stream = { new(class, CAPACITY, NULL), item, batch };
+	ThreadRef producer = new(Thread, produce, &stream, NULL);
+
+	double start = cobench_now();
+	startThread(producer);
+	consume(&stream);
+	joinThread(producer, NULL);
+	double elapsed = cobench_now() - start;
+
+	printf("%-40s %12.2f ns/item %14.0f items/s\n", name, elapsed / ITEMS, ITEMS / (elapsed / 1e9));
+	release(producer);
+	release(stream.queue);
+}
+
+struct _PingPong {
+	void *ping;
+	void *pong;
+};
+
+static void * echo(void *argument) {
+	struct _PingPong *pingPong = argument;
+	for (UInteger round=0; round<ROUNDS; round++) {
+		ObjectRef item = NULL;
+		while ( (item = tryDequeueObject(pingPong->ping)) == NULL )
+			sched_yield();
+		while ( ! tryEnqueueObject(pingPong->pong, item) )
+			sched_yield();
+		release(item);
+	}
+	return NULL;
+}
+
+static void pingPong(ObjectRef item) {
+	struct _PingPong pingPong = { new(SPSCQueue, 2UL, NULL), new(SPSCQueue, 2UL, NULL) };
+	ThreadRef echoer = new(Thread, echo, &pingPong, NULL);
+	UInteger histogram[BUCKETS] = { 0 };
+	startThread(echoer);
+
+	for (UInteger round=0; round<ROUNDS; round++) {
+		double start = cobench_now();
+		while ( ! tryEnqueueObject(pingPong.ping, item) )
+			sched_yield();
+		ObjectRef back = NULL;
+		while ( (back = tryDequeueObject(pingPong.pong)) == NULL )
+			sched_yield();
+		UInteger latency = (UInteger)(cobench_now() - start);
+		release(back);
+
+		UInteger bucket = 0;
+		while ( (latency >> bucket) > 1 && bucket < BUCKETS - 1 )
+			bucket++;
+		histogram[bucket]++;
+	}
+	joinThread(echoer, NULL);
+
+	printf("SPSCQueue ping-pong round trip latency, %lu rounds\n", ROUNDS);
+	UInteger cumulated = 0;
+	for (UInteger bucket=0; bucket<BUCKETS; bucket++) {
+		if ( histogram[bucket] == 0 )
+			continue;
+		cumulated += histogram[bucket];
+		printf("  [%10lu, %10lu) ns %10lu %8.3f%%\n", 1UL << bucket, 2UL << bucket, histogram[bucket], 100.0 * cumulated / ROUNDS);
+	}
+	release(echoer);
+	release(pingPong.ping);
+	release(pingPong.pong);
+}
+
+int main () {
+	StringRef item = new(String, "item", NULL);
+	stream("SPSCQueue", SPSCQueue, 1, item);
+	stream("SPSCQueue (batches of 64)", SPSCQueue, BATCH, item);
+	stream("ConcurrentQueue", ConcurrentQueue, 1, item);
+	stream("ConcurrentQueue (batches of 64)", ConcurrentQueue, BATCH, item);
+	pingPong(item);
+	release(item);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+//
+//  benchStartup.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Spawns this binary RUNS times. Each child uses only String and reports, from the top of main,
+ * the monotonic time and its resident memory; the parent measures the time from fork to main.
+ * The child also times the library's constructors, which build the classes, from a constructor
+ * run before them to main.
+ * Compare a library built as usual with one built with CFLAGS=-DCO_LAZY_CLASS_INIT. */
+#define RUNS 200
+
+/* Prioritized constructors run before the library's, which have none */
+static double constructorsTime = 0.0;
+__attribute__((constructor(101))) static void beforeConstructors() {
+	constructorsTime = cobench_now();
+}
+
+static long residentKilobytes() {
+	long size = 0, resident = 0;
+	FILE *statm = fopen("/proc/self/statm", "r");
+	if (statm == NULL)
+		return -1;
+	if (fscanf(statm, "%ld %ld", &size, &resident) != 2)
+		resident = -1;
+	fclose(statm);
+	return resident < 0 ? -1 : resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static int child() {
+	double mainTime = cobench_now();
+	constructorsTime = mainTime - constructorsTime;
+	long residentAtMain = residentKilobytes();
+
+	StringRef string = new(String, "startup", NULL);
+	long residentAfterString = residentKilobytes();
+	release(string);
+
+	printf("%.0f %.0f %ld %ld\n", mainTime, constructorsTime, residentAtMain, residentAfterString);
+	return EXIT_SUCCESS;
+}
+
+int main (int argc, char *argv[]) {
+	if (argc > 1 && strcmp(argv[1], "child") == 0)
+		return child();
+
+	double total = 0.0, best = 0.0, constructorsTotal = 0.0, constructorsBest = 0.0;
+	long residentAtMain = 0, residentAfterString = 0;
+	for (int run=0; run<RUNS; run++) {
+		int fds[2];
+		if (pipe(fds) != 0)
+			return perror("pipe"), EXIT_FAILURE;
+
+		double start = cobench_now();
+		pid_t pid = fork();
+		if (pid < 0)
+			return perror("fork"), EXIT_FAILURE;
+		if (pid == 0) {
+			dup2(fds[1], STDOUT_FILENO);
+			close(fds[0]), close(fds[1]);
+			execl("/proc/self/exe", argv[0], "child", (char *)NULL);
+			execl(argv[0], argv[0], "child", (char *)NULL);
+			_exit(EXIT_FAILURE);
+		}
+
+		close(fds[1]);
+		FILE *output = fdopen(fds[0], "r");
+		double mainTime = 0.0, constructors = 0.0;
+		if (output == NULL || fscanf(output, "%lf %lf %ld %ld", &mainTime, &constructors, &residentAtMain, &residentAfterString) != 4)
+			return fprintf(stderr, "child did not report\n"), EXIT_FAILURE;
+		fclose(output);
+		waitpid(pid, NULL, 0);
+
+		double elapsed = mainTime - start;
+		total += elapsed;
+		if (run == 0 || elapsed < best)
+			best = elapsed;
+		constructorsTotal += constructors;
+		if (run == 0 || constructors < constructorsBest)
+			constructorsBest = constructors;
+	}
+
+	printf("%-48s %12.2f us mean %12.2f us best\n", "fork+exec to main (String only)", total / RUNS / 1e3, best / 1e3);
+	printf("%-48s %12.2f us mean %12.2f us best\n", "library constructors (class building)", constructorsTotal / RUNS / 1e3, constructorsBest / 1e3);
+	printf("%-48s %12ld KB\n", "resident memory at main", residentAtMain);
+	printf("%-48s %12ld KB\n", "resident memory after first String", residentAfterString);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+//
+//  benchString.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* KEYS short keys (8 bytes, stored inline) against as many long ones (over 23 bytes, stored on the heap): resident
+ * memory per String and cost of reading their text, then a MutableDictionary of the short keys: resident memory per
+ * entry and lookups with equal but distinct keys. The number of keys can be given as the first argument. */
+#define KEYS 10000000UL
+
+static double residentBytes() {
+	long pages = 0, resident = 0;
+	FILE *statm = fopen("/proc/self/statm", "r");
+	if ( statm == NULL ) return 0;
+	if ( fscanf(statm, "%ld %ld", &pages, &resident) != 2 ) resident = 0;
+	fclose(statm);
+	return (double)resident * (double)sysconf(_SC_PAGESIZE);
+}
+
+static StringRef * newKeys(UInteger count, const char *format) {
+	StringRef *keys = malloc(count * sizeof(StringRef));
+	char text[64];
+	double resident = residentBytes();
+	double start = cobench_now();
+	for (UInteger i=0; i<count; i++) {
+		snprintf(text, sizeof(text), format, i);
+		keys[i] = new(String, text, NULL);
+	}
+	double elapsed = cobench_now() - start;
+	printf("%-40s %10.2f ns/string %10.1f bytes/string\n", format, elapsed / count, (residentBytes() - resident) / count);
+	return keys;
+}
+
+static void readKeys(StringRef *keys, UInteger count, const char *name) {
+	UInteger checksum = 0;
+	double start = cobench_now();
+	for (UInteger i=0; i<count; i++)
+		checksum += (unsigned char)getStringText(keys[i])[getStringLength(keys[i]) - 1];
+	double elapsed = cobench_now() - start;
+	printf("%-40s %10.2f ns/read (checksum %lu)\n", name, elapsed / count, checksum);
+}
+
+static void releaseKeys(StringRef *keys, UInteger count) {
+	for (UInteger i=0; i<count; i++)
+		release(keys[i]);
+	free(keys);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger count = argc > 1 ? strtoul(argv[1], NULL, 10) : KEYS;
+
+	StringRef *keys = newKeys(count, "k%07lu");
+	readKeys(keys, count, "read short keys");
+
+	StringRef *longKeys = newKeys(count, "a key long enough for the heap %08lu");
+	readKeys(longKeys, count, "read long keys");
+	releaseKeys(longKeys, count);
+
+	MutableDictionaryRef dictionary = new(MutableDictionary, NULL);
+	double resident = residentBytes();
+	double start = cobench_now();
+	for (UInteger i=0; i<count; i++)
+		setObjectForKey(dictionary, keys[i], keys[i]);
+	double elapsed = cobench_now() - start;
+	printf("%-40s %10.2f ns/insert %10.1f bytes/entry\n", "MutableDictionary insert", elapsed / count, (residentBytes() - resident) / count);
+
+	/* Equal keys that are other objects, so that lookups compare texts */
+	StringRef *probes = newKeys(count, "k%07lu");
+	UInteger found = 0;
+	start = cobench_now();
+	for (UInteger i=0; i<count; i++)
+		found += objectForKey(dictionary, probes[i]) != NULL;
+	elapsed = cobench_now() - start;
+	printf("%-40s %10.2f ns/lookup (%lu found)\n", "MutableDictionary lookup", elapsed / count, found);
+
+	release(dictionary);
+	releaseKeys(probes, count);
+	releaseKeys(keys, count);
+	return EXIT_SUCCESS;
+}
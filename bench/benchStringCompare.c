@@ -0,0 +1,81 @@
+//
+//  benchStringCompare.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Dictionary keys of a settings store: KEYS keys (the first argument if any) of the same length sharing a long
+ * prefix. Prints the lookups per second of a MutableDictionary asked with copies of its keys, the equals per second
+ * of keys whose hashes are known, and the comparisons per second of sorting the keys ignoring case. */
+#define KEYS 20000UL
+#define ROUNDS 20UL
+
+static const char *const Prefix = "com.example.application.preferences.section-%02lu.Key-%06lu";
+
+static int compareIgnoringCase(const void *first, const void *second) {
+	return (int)compareWithOptions(*(StringRef const *)first, *(StringRef const *)second, SStringComparingOptionCaseInsensitiveSearch);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger keys = argc > 1 ? strtoul(argv[1], NULL, 10) : KEYS;
+	char text[128];
+	StringRef *stored = calloc(keys, sizeof(StringRef)), *asked = calloc(keys, sizeof(StringRef));
+	MutableDictionaryRef dictionary = new(MutableDictionary, NULL);
+	for (UInteger k=0; k<keys; k++) {
+		/* Scattered, so that sorting has work to do */
+		UInteger key = (k * 7919) % keys;
+		snprintf(text, sizeof(text), Prefix, key % 16, key);
+		stored[k] = new(String, text, NULL);
+		asked[k] = new(String, text, NULL);
+		setObjectForKey(dictionary, stored[k], stored[k]);
+	}
+
+	UInteger found = 0;
+	double start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++)
+		for (UInteger k=0; k<keys; k++)
+			found += objectForKey(dictionary, asked[k]) == stored[k];
+	double elapsed = cobench_now() - start;
+	printf("%-32s %10.2f ms %8.2f Mlookups/s\n", "MutableDictionary lookups", elapsed / 1e6, (double)(ROUNDS * keys) / (elapsed / 1e3));
+
+	/* Every key against its neighbours, hashes known: one of each pair of eight is equal */
+	UInteger equal = 0;
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++)
+		for (UInteger k=0; k<keys; k++)
+			for (UInteger n=0; n<8; n++)
+				equal += equals(asked[k], stored[(k + n) % keys]);
+	elapsed = cobench_now() - start;
+	printf("%-32s %10.2f ms %8.2f Mequals/s\n", "equals", elapsed / 1e6, (double)(ROUNDS * keys * 8) / (elapsed / 1e3));
+
+	StringRef *sorted = calloc(keys, sizeof(StringRef));
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		memcpy(sorted, stored, keys * sizeof(StringRef));
+		qsort(sorted, keys, sizeof(StringRef), compareIgnoringCase);
+	}
+	elapsed = cobench_now() - start;
+	printf("%-32s %10.2f ms %8.2f Msorts/s of one key\n", "sorting ignoring case", elapsed / 1e6, (double)(ROUNDS * keys) / (elapsed / 1e3));
+
+	if ( found != ROUNDS * keys || equal != ROUNDS * keys )
+		fprintf(stderr, "found %lu keys and %lu equal ones instead of %lu\n", found, equal, ROUNDS * keys);
+	for (UInteger k=1; k<keys; k++)
+		if ( compareIgnoringCase(sorted + k - 1, sorted + k) != SAscending )
+			fprintf(stderr, "the keys are not sorted at %lu\n", k);
+
+	free(sorted);
+	release(dictionary);
+	for (UInteger k=0; k<keys; k++)
+		release(stored[k]), release(asked[k]);
+	free(asked);
+	free(stored);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+//
+//  benchStringFormat.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Format calls per second: newStringWithFormat with short and long results, against the former path that cleared
+ * a BUFSIZ stack buffer then copied it with new(String, ...), and the typed paths against the formats they replace. */
+#define CALLS 2000000UL
+
+/* What newStringWithFormat used to do for short results */
+static StringRef newStringWithFormerFormat(const char *format, ...) {
+	char buffer[BUFSIZ];
+	memset(buffer, '\0', BUFSIZ);
+	va_list ap;
+	va_start(ap, format);
+	vsnprintf(buffer, BUFSIZ, format, ap);
+	va_end(ap);
+	return new(String, buffer, NULL);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger calls = argc > 1 ? strtoul(argv[1], NULL, 10) : CALLS;
+	StringRef first = new(String, "first half ", NULL);
+	StringRef second = new(String, "and the second one", NULL);
+	char longText[1024];
+	memset(longText, 'x', sizeof(longText) - 1), longText[sizeof(longText) - 1] = '\0';
+
+	cobench_run("BUFSIZ memset + new \"%ld\"", calls, release(newStringWithFormerFormat("%ld", (long)___i)));
+	cobench_run("newStringWithFormat \"%ld\"", calls, release(newStringWithFormat(String, "%ld", (long)___i, NULL)));
+	cobench_run("newStringWithInteger", calls, release(newStringWithInteger(String, (Integer)___i)));
+
+	cobench_run("newStringWithFormat \"%.2f\"", calls, release(newStringWithFormat(String, "%.2f", ___i * 0.37, NULL)));
+	cobench_run("newStringWithDouble 2 decimals", calls, release(newStringWithDouble(String, ___i * 0.37, 2)));
+
+	cobench_run("BUFSIZ memset + new \"%s%s\"", calls, release(newStringWithFormerFormat("%s%s", getStringText(first), getStringText(second))));
+	cobench_run("newStringWithFormat \"%s%s\"", calls, release(newStringWithFormat(String, "%s%s", getStringText(first), getStringText(second), NULL)));
+	cobench_run("newStringWithStrings", calls, release(newStringWithStrings(String, first, second, NULL)));
+	cobench_run("copyStringByAppendingString", calls, release(copyStringByAppendingString(first, second)));
+
+	cobench_run("newStringWithFormat 1 KB \"%s\"", calls / 4, release(newStringWithFormat(String, "%s", longText, NULL)));
+	cobench_run("copyDescription", calls, release(copyDescription(first)));
+
+	release(second);
+	release(first);
+	return EXIT_SUCCESS;
+}
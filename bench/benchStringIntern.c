@@ -0,0 +1,69 @@
+//
+//  benchStringIntern.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Fills DICTIONARIES dictionaries (the first argument if any) with the same KEYS keys, then looks each key up in all
+ * of them, once with every dictionary holding its own copies of the keys and once with interned keys; then prints the
+ * statistics of the intern table. */
+#define DICTIONARIES 200UL
+#define KEYS 2000UL
+
+static void run(const char *name, UInteger dictionaries, bool interned) {
+	char text[64];
+	StringRef lookupKeys[KEYS];
+	for (UInteger k=0; k<KEYS; k++) {
+		int length = snprintf(text, sizeof(text), "com.example.settings.key-%04lu", k);
+		lookupKeys[k] = interned ? internStringWithText(text, (UInteger)length) : new(String, text, NULL);
+	}
+
+	MutableDictionaryRef *all = calloc(dictionaries, sizeof(MutableDictionaryRef));
+	double start = cobench_now();
+	for (UInteger d=0; d<dictionaries; d++) {
+		all[d] = new(MutableDictionary, NULL);
+		for (UInteger k=0; k<KEYS; k++) {
+			int length = snprintf(text, sizeof(text), "com.example.settings.key-%04lu", k);
+			StringRef key = interned ? internStringWithText(text, (UInteger)length) : new(String, text, NULL);
+			setObjectForKey(all[d], lookupKeys[k], key);
+			release(key);
+		}
+	}
+	double filled = cobench_now();
+
+	UInteger found = 0;
+	for (UInteger d=0; d<dictionaries; d++)
+		for (UInteger k=0; k<KEYS; k++)
+			found += objectForKey(all[d], lookupKeys[k]) == lookupKeys[k];
+	double looked = cobench_now();
+
+	printf("%-16s fill %8.2f ms   lookup %8.2f ms %8.2f Mlookups/s\n", name, (filled - start) / 1e6, (looked - filled) / 1e6,
+		   (double)(dictionaries * KEYS) / ((looked - filled) / 1e3));
+	if ( found != dictionaries * KEYS )
+		fprintf(stderr, "%s: found %lu keys instead of %lu\n", name, found, dictionaries * KEYS);
+
+	for (UInteger d=0; d<dictionaries; d++)
+		release(all[d]);
+	free(all);
+	for (UInteger k=0; k<KEYS; k++)
+		release(lookupKeys[k]);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger dictionaries = argc > 1 ? strtoul(argv[1], NULL, 10) : DICTIONARIES;
+	run("copied keys", dictionaries, NO);
+	run("interned keys", dictionaries, YES);
+
+	StringInternStatistics statistics = getStringInternStatistics();
+	printf("interned %lu strings in %lu bytes, table %lu bytes, %lu lookups %lu hits\n",
+		   statistics.count, statistics.bytes, statistics.tableBytes, statistics.lookups, statistics.hits);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+//
+//  benchStringSearch.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Searches a SIZE haystack (256 MB, or the first argument in MB) of random lowercase text for needles of several
+ * lengths that only occur at its very end, and prints the throughput in GB/s of rangeOfString forwards, backwards
+ * (the needle then planted at the start) and case-insensitive, against strstr and memmem on the same text; then for a
+ * needle that matches everywhere but at its last byte. */
+#define SIZE (256UL << 20)
+#define ROUNDS 4
+
+static void report(const char *name, UInteger length, UInteger size, double elapsed) {
+	printf("%-36s needle %4lu %8.2f GB/s\n", name, length, (double)size * ROUNDS / elapsed);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger size = argc > 1 ? strtoul(argv[1], NULL, 10) << 20 : SIZE;
+	char *text = malloc(size + 1);
+	srand(7);
+	for (UInteger i=0; i<size; i++)
+		text[i] = (char)('a' + rand() % 26);
+	text[size] = '\0';
+
+	const UInteger lengths[] = { 4, 16, 63, 256 };
+	char needleText[257];
+	for (UInteger l=0; l<sizeof(lengths)/sizeof(lengths[0]); l++) {
+		UInteger length = lengths[l];
+		for (UInteger i=0; i<length; i++)
+			needleText[i] = (char)('a' + (i * 7) % 26);
+		needleText[length - 1] = '#', needleText[length] = '\0';
+		memcpy(text + size - length, needleText, length);
+		StringRef haystack = newWithArguments(String, &(StringArguments){ text, size });
+		StringRef needle = new(String, needleText, NULL);
+		UInteger found = 0;
+		/* Keeps the compiler from searching once for all the rounds */
+		const char *volatile searched = text;
+
+		double start = cobench_now();
+		for (int round=0; round<ROUNDS; round++)
+			found += rangeOfString(haystack, needle).location;
+		report("rangeOfString", length, size, cobench_now() - start);
+
+		start = cobench_now();
+		for (int round=0; round<ROUNDS; round++)
+			found += rangeOfStringWithOptions(haystack, needle, SStringComparingOptionCaseInsensitiveSearch).location;
+		report("rangeOfString case-insensitive", length, size, cobench_now() - start);
+
+		start = cobench_now();
+		for (int round=0; round<ROUNDS; round++)
+			found += (UInteger)(strstr(searched, needleText) - text);
+		report("strstr", length, size, cobench_now() - start);
+
+		start = cobench_now();
+		for (int round=0; round<ROUNDS; round++)
+			found += (UInteger)((char *)memmem(searched, size, needleText, length) - text);
+		report("memmem", length, size, cobench_now() - start);
+		release(haystack);
+
+		memcpy(text, needleText, length);
+		haystack = newWithArguments(String, &(StringArguments){ text, size - length });
+		start = cobench_now();
+		for (int round=0; round<ROUNDS; round++)
+			found += rangeOfStringWithOptions(haystack, needle, SStringComparingOptionBackwardsSearch).location;
+		report("rangeOfString backwards", length, size, cobench_now() - start);
+		memset(text, 'q', length);
+
+		if ( found != ROUNDS * 4 * (size - length) )
+			fprintf(stderr, "needle %lu found at unexpected locations\n", length);
+		release(needle);
+		release(haystack);
+		memset(text + size - length, 'a', length);
+	}
+
+	/* Adversarial: every position is a candidate, the forward search soon leaves the haystack to Two-Way */
+	memset(text, 'a', size);
+	memset(needleText, 'a', 255), needleText[255] = 'b', needleText[256] = '\0';
+	StringRef haystack = newWithArguments(String, &(StringArguments){ text, size });
+	StringRef needle = new(String, needleText, NULL);
+	double start = cobench_now();
+	for (int round=0; round<ROUNDS; round++)
+		if ( rangeOfString(haystack, needle).location != NotFound )
+			fprintf(stderr, "needle found where it does not occur\n");
+	report("rangeOfString a...ab in a...a", 256, size, cobench_now() - start);
+	release(needle);
+	release(haystack);
+
+	free(text);
+	return EXIT_SUCCESS;
+}
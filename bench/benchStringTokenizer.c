@@ -0,0 +1,93 @@
+//
+//  benchStringTokenizer.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Splits LINES log lines (the first argument if any) of 8 comma separated fields and prints the fields per second
+ * of copying each field with getCharactersInRange and new(String, ...), of componentsSeparatedByCharacters and
+ * componentsSeparatedByString, and of enumerating a StringTokenizer. */
+#define LINES 200000UL
+#define FIELDS 8
+
+static void report(const char *name, UInteger fields, double elapsed) {
+	printf("%-36s %10.2f ms %8.2f Mfields/s\n", name, elapsed / 1e6, (double)fields / (elapsed / 1e3));
+}
+
+int main (int argc, char *argv[]) {
+	UInteger lines = argc > 1 ? strtoul(argv[1], NULL, 10) : LINES;
+	StringRef line = new(String, "2026-10-19T12:00:00,host-042,GET,/api/v1/items,200,1534,0.042,Mozilla/5.0", NULL);
+	StringRef comma = new(String, ",", NULL);
+	UInteger expected = lines * FIELDS, fields = 0;
+
+	double start = cobench_now();
+	for (UInteger i=0; i<lines; i++) {
+		const char *text = getStringText(line);
+		UInteger length = getStringLength(line), location = 0;
+		char buffer[128];
+		while ( location <= length ) {
+			const char *separator = memchr(text + location, ',', length - location);
+			UInteger end = separator ? (UInteger)(separator - text) : length;
+			getCharactersInRange(line, buffer, MakeRange(location, end - location));
+			buffer[end - location] = '\0';
+			release(new(String, buffer, NULL)), fields++;
+			location = end + 1;
+		}
+	}
+	report("getCharactersInRange + new", fields, cobench_now() - start);
+
+	start = cobench_now();
+	for (UInteger i=0; i<lines; i++) {
+		VectorRef components = componentsSeparatedByCharacters(line, ",");
+		fields += getCollectionCount(components);
+		release(components);
+	}
+	report("componentsSeparatedByCharacters", fields - expected, cobench_now() - start);
+
+	start = cobench_now();
+	for (UInteger i=0; i<lines; i++) {
+		VectorRef components = componentsSeparatedByString(line, comma);
+		fields += getCollectionCount(components);
+		release(components);
+	}
+	report("componentsSeparatedByString", fields - 2 * expected, cobench_now() - start);
+
+	/* One tokenizer per line, as a log reader would */
+	start = cobench_now();
+	for (UInteger i=0; i<lines; i++) {
+		StringTokenizerRef tokenizer = newStringTokenizerWithCharacters(line, ",");
+		foreach_start(StringRef, field, tokenizer) {
+			fields += getStringLength(field) != NotFound;
+		} foreach_end()
+		release(tokenizer);
+	}
+	report("StringTokenizer per line", fields - 3 * expected, cobench_now() - start);
+
+	/* One tokenizer over the whole log, its fields re-pointed instead of allocated */
+	MutableStringRef log = new(MutableString, "", NULL);
+	reserveMutableStringCapacity(log, lines * (getStringLength(line) + 1));
+	for (UInteger i=0; i<lines; i++)
+		appendString(log, line), appendCharacter(log, ',');
+	StringTokenizerRef tokenizer = newStringTokenizer(log, comma);
+	start = cobench_now();
+	foreach_start(StringRef, field, tokenizer) {
+		fields += getStringLength(field) != NotFound;
+	} foreach_end()
+	report("StringTokenizer over the whole log", fields - 4 * expected - 1, cobench_now() - start);
+
+	if ( fields != 5 * expected + 1 )
+		fprintf(stderr, "split %lu fields instead of %lu\n", fields, 5 * expected + 1);
+	release(tokenizer);
+	release(log);
+	release(comma);
+	release(line);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+//
+//  benchThreadPool.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Throughput of tiny tasks on a ThreadPool of 1 to MAX_WORKERS workers: TASKS tasks submitted from the main thread,
+ * then TASKS tasks fanned out FANOUT at a time from within tasks, so that they land on the deques of the workers and
+ * get stolen. THREADS tasks with a Thread each give the cost the pool avoids. */
+#define TASKS 1000000UL
+#define FANOUT 100UL
+#define THREADS 2000UL
+#define MAX_WORKERS 8
+
+static UInteger Counter = 0;
+static ThreadPoolRef Pool = NULL;
+
+static void tiny(void *argument) {
+	__atomic_add_fetch(&Counter, 1, __ATOMIC_RELAXED);
+}
+
+static void fanOut(void *argument) {
+	for (UInteger i=0; i<FANOUT; i++)
+		submitTask(Pool, tiny, NULL);
+}
+
+static void * tinyThread(void *argument) {
+	tiny(argument);
+	return NULL;
+}
+
+static void report(const char *name, UInteger workers, UInteger tasks, double elapsed) {
+	printf("%-28s %lu worker(s) %10.2f ns/task %14.0f tasks/s", name, workers, elapsed / tasks, tasks / (elapsed / 1e9));
+	if ( Pool )
+		printf("  stolen %lu", getThreadPoolStolenTaskCount(Pool));
+	printf("\n");
+}
+
+int main () {
+	for (UInteger workers=1; workers<=MAX_WORKERS; workers*=2) {
+		Pool = new(ThreadPool, workers, NULL);
+		double start = cobench_now();
+		for (UInteger i=0; i<TASKS; i++)
+			submitTask(Pool, tiny, NULL);
+		waitForTasks(Pool);
+		report("ThreadPool (external)", workers, TASKS, cobench_now() - start);
+		release(Pool);
+
+		Pool = new(ThreadPool, workers, NULL);
+		start = cobench_now();
+		for (UInteger i=0; i<TASKS/FANOUT; i++)
+			submitTask(Pool, fanOut, NULL);
+		waitForTasks(Pool);
+		report("ThreadPool (fan out)", workers, TASKS, cobench_now() - start);
+		release(Pool), Pool = NULL;
+	}
+
+	double start = cobench_now();
+	for (UInteger i=0; i<THREADS; i++) {
+		ThreadRef thread = new(Thread, tinyThread, NULL, NULL);
+		startThread(thread);
+		joinThread(thread, NULL);
+		release(thread);
+	}
+	report("Thread per task", 1, THREADS, cobench_now() - start);
+	return EXIT_SUCCESS;
+}
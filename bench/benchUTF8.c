@@ -0,0 +1,108 @@
+//
+//  benchUTF8.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <locale.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Converts a text of BYTES bytes (the first argument if any) of ASCII and of mixed Greek, CJK and ASCII between UTF-8
+ * and wide Strings and prints the megabytes of UTF-8 per second of mbstowcs and wcstombs (sized by a first pass into
+ * a calloc'ed buffer, as WString did) and of the WString conversions; then of validating and counting the UTF-8. */
+#define BYTES (1UL << 20)
+#define ROUNDS 50UL
+
+static void report(const char *name, UInteger bytes, double elapsed) {
+	printf("%-40s %10.2f ms %10.2f MB/s\n", name, elapsed / 1e6, (double)bytes / (elapsed / 1e3));
+}
+
+static void run(const char *name, const char *text, UInteger length) {
+	char label[64];
+	UInteger checksum = 0;
+
+	double start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		size_t size = mbstowcs(NULL, text, 0);
+		wchar_t *wide = calloc(size + 1, sizeof(wchar_t));
+		checksum += mbstowcs(wide, text, size);
+		WStringRef string = new(WString, wide, NULL);
+		free(wide);
+		release(string);
+	}
+	snprintf(label, sizeof(label), "%s mbstowcs", name);
+	report(label, ROUNDS * length, cobench_now() - start);
+
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		WStringRef string = newWStringWithUTF8Text(WString, text, length);
+		checksum -= getStringLength(string);
+		release(string);
+	}
+	snprintf(label, sizeof(label), "%s newWStringWithUTF8Text", name);
+	report(label, ROUNDS * length, cobench_now() - start);
+
+	WStringRef wide = newWStringWithUTF8Text(WString, text, length);
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		size_t size = wcstombs(NULL, getWText(wide), 0);
+		char *multibyte = calloc(size + 1, sizeof(char));
+		checksum += wcstombs(multibyte, getWText(wide), size);
+		StringRef string = new(String, multibyte, NULL);
+		free(multibyte);
+		release(string);
+	}
+	snprintf(label, sizeof(label), "%s wcstombs", name);
+	report(label, ROUNDS * length, cobench_now() - start);
+
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		StringRef string = copyDescription(wide);
+		checksum -= getStringLength(string);
+		release(string);
+	}
+	snprintf(label, sizeof(label), "%s copyDescription", name);
+	report(label, ROUNDS * length, cobench_now() - start);
+	release(wide);
+
+	/* A fresh String each round, so the validation is not remembered */
+	start = cobench_now();
+	for (UInteger r=0; r<ROUNDS; r++) {
+		StringRef string = newStringWithUTF8Text(String, text, length);
+		checksum += getStringUTF8Length(string) - getStringUTF8Length(string);
+		release(string);
+	}
+	snprintf(label, sizeof(label), "%s validate and count", name);
+	report(label, ROUNDS * length, cobench_now() - start);
+
+	if ( checksum != 0 )
+		fprintf(stderr, "%s: the conversions disagree\n", name);
+}
+
+int main (int argc, char *argv[]) {
+	UInteger bytes = argc > 1 ? strtoul(argv[1], NULL, 10) : BYTES;
+	if ( setlocale(LC_CTYPE, "C.UTF-8") == NULL )
+		fprintf(stderr, "no C.UTF-8 locale, mbstowcs and wcstombs will fail\n");
+
+	const char *pieces[] = { "The quick brown fox jumps over the lazy dog. ", "Γαζέες καὶ μυρτιὲς δὲν θὰ βρῶ. ", "五色沼 (ごしきぬま) ", "𐍆 " };
+	char *ascii = malloc(bytes + 1), *mixed = malloc(bytes + 1);
+	UInteger asciiLength = 0, mixedLength = 0;
+	while ( asciiLength + strlen(pieces[0]) <= bytes )
+		memcpy(ascii + asciiLength, pieces[0], strlen(pieces[0])), asciiLength += strlen(pieces[0]);
+	for (UInteger p=0; mixedLength + strlen(pieces[p % 4]) <= bytes; p++)
+		memcpy(mixed + mixedLength, pieces[p % 4], strlen(pieces[p % 4])), mixedLength += strlen(pieces[p % 4]);
+	ascii[asciiLength] = '\0', mixed[mixedLength] = '\0';
+
+	run("ascii", ascii, asciiLength);
+	run("mixed", mixed, mixedLength);
+	free(mixed);
+	free(ascii);
+	return EXIT_SUCCESS;
+}
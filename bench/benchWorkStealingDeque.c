@@ -0,0 +1,107 @@
+//
+//  benchWorkStealingDeque.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <sched.h>
+#include <cobj.h>
+#include "cobench.h"
+
+/* Imbalanced fork-join: all the work starts on the deque of worker 0 as one range of LEAVES leaves, every range is split
+ * in two, the right half pushed and the left half processed, until single leaves of WORK iterations each. The other
+ * workers only get work by stealing. Prints throughput and how many steal attempts succeeded, for 1 to MAX_WORKERS. */
+#define LEAVES (1UL << 18)
+#define WORK 200UL
+#define MAX_WORKERS 8
+
+struct _Worker {
+	UInteger index;
+	UInteger workerCount;
+	WorkStealingDequeRef deque;
+	struct _Worker *workers;
+	UInteger attempts;
+	UInteger steals;
+	UInteger leaves;
+	unsigned int seed;
+};
+
+static UInteger LeavesDone = 0;
+static volatile UInteger Sink = 0;
+
+static ValueRef newRange(UInteger low, UInteger high) {
+	return new(Value, (void *)(uintptr_t)((low << 32) | high), NULL, NULL);
+}
+
+static void process(struct _Worker *worker, ValueRef range) {
+	uintptr_t bounds = (uintptr_t)getValuePointer(range);
+	UInteger low = bounds >> 32, high = bounds & 0xffffffffUL;
+	release(range);
+	while ( high - low > 1 ) {
+		UInteger middle = low + (high - low) / 2;
+		ValueRef right = newRange(middle, high);
+		pushDequeObject(worker->deque, right);
+		release(right);
+		high = middle;
+	}
+	for (UInteger i=0; i<WORK; i++)
+		Sink += i;
+	worker->leaves++;
+	__atomic_add_fetch(&LeavesDone, 1, __ATOMIC_RELAXED);
+}
+
+static void * work(void *argument) {
+	struct _Worker *worker = argument;
+	while ( __atomic_load_n(&LeavesDone, __ATOMIC_RELAXED) < LEAVES ) {
+		ValueRef range = popDequeObject(worker->deque);
+		if ( range == NULL && worker->workerCount > 1 ) {
+			UInteger victim = (worker->index + 1 + (UInteger)rand_r(&(worker->seed)) % (worker->workerCount - 1)) % worker->workerCount;
+			worker->attempts++;
+			if ( (range = stealDequeObject(worker->workers[victim].deque)) != NULL )
+				worker->steals++;
+		}
+		if ( range != NULL )
+			process(worker, range);
+		else
+			sched_yield();
+	}
+	return NULL;
+}
+
+int main () {
+	for (UInteger workerCount=1; workerCount<=MAX_WORKERS; workerCount*=2) {
+		struct _Worker workers[MAX_WORKERS];
+		ThreadRef threads[MAX_WORKERS];
+		LeavesDone = 0;
+		for (UInteger i=0; i<workerCount; i++)
+			workers[i] = (struct _Worker){ i, workerCount, new(WorkStealingDeque, 64UL, NULL), workers, 0, 0, 0, (unsigned int)i + 1 };
+		ValueRef root = newRange(0, LEAVES);
+		pushDequeObject(workers[0].deque, root);
+		release(root);
+
+		double start = cobench_now();
+		for (UInteger i=0; i<workerCount; i++) {
+			threads[i] = new(Thread, work, &workers[i], NULL);
+			startThread(threads[i]);
+		}
+		for (UInteger i=0; i<workerCount; i++)
+			joinThread(threads[i], NULL), release(threads[i]);
+		double elapsed = cobench_now() - start;
+
+		UInteger attempts = 0, steals = 0, busiest = 0;
+		for (UInteger i=0; i<workerCount; i++) {
+			attempts += workers[i].attempts, steals += workers[i].steals;
+			if ( workers[i].leaves > busiest )
+				busiest = workers[i].leaves;
+			release(workers[i].deque);
+		}
+		printf("%lu worker(s) %10.2f ns/leaf %14.0f leaves/s  steals %8lu/%-10lu (%5.1f%%)  busiest worker %5.1f%% of the leaves\n",
+			   workerCount, elapsed / LEAVES, LEAVES / (elapsed / 1e9), steals, attempts, attempts ? 100.0 * steals / attempts : 0.0, 100.0 * busiest / LEAVES);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,31 @@
+//
+//  cobench.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_cobench_h
+#define CObjects_cobench_h
+
+#include <stdio.h>
+#include <time.h>
+
+/* Monotonic time in nanoseconds */
+static inline double cobench_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* Runs `body` `iterations` times and prints the mean time per iteration */
+#define cobench_run(name, iterations, body) do { \
+	const unsigned long ___iterations = (iterations); \
+	double ___start = cobench_now(); \
+	for (unsigned long ___i=0; ___i<___iterations; ___i++) { body; } \
+	double ___elapsed = cobench_now() - ___start; \
+	printf("%-48s %12.2f ns/op %14.0f ops/s\n", (name), ___elapsed / ___iterations, ___iterations / (___elapsed / 1e9)); \
+} while (0)
+
+#endif
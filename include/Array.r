@@ -31,6 +31,11 @@ CO_BEGIN_CLASS_DECL(ArrayClass,CollectionClass)
 	void * ( * getStore) (const void * const self);
 CO_END_CLASS_DECL
 
+#define ArrayClassLayout struct ArrayClass
+#define ArrayClassRoot .isa CollectionClassRoot
+
+CO_DECLARE_STATIC_CLASS_TABLES(Array,CollectionClass)
+
 void *getStore(const void * const self);
 
 #endif
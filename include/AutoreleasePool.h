@@ -9,6 +9,7 @@
 #ifndef CObjects_AutoreleasePool_h
 #define CObjects_AutoreleasePool_h
 
+#include <coint.h>
 #include <codefinitions.h>
 
 ///*! A @ref AutoreleasePool type. */
@@ -24,4 +25,39 @@ CO_DECLARE_CLASS(AutoreleasePool)
 void addAutoreleaseObject(const void *self, const void *object);
 void AutoreleasePoolAddObject(const void *object);
 
+/*!
+ *  @fn void drainAutoreleasePool(void *const self)
+ *  @relates AutoreleasePool
+ *  @brief Releases the objects autoreleased in @a self so far and keeps it in place for the next ones.
+ *  @details Cheaper than releasing the pool and creating a new one, e.g. between the tasks run by one thread.
+ */
+void drainAutoreleasePool(void *const self);
+
+/*!
+ *  @fn void *autoreleaseReturnValue(void *const object)
+ *  @relates AutoreleasePool
+ *  @brief Autoreleases an object that is about to be returned to a caller.
+ *  @details The object is parked in a thread-local slot instead of being inserted in the current pool. It is inserted later if the caller does not claim it with @ref retainAutoreleasedReturnValue() before the next hand-off, pool push or pool pop on this thread.
+ *  @param[in] object the object to autorelease.
+ *  @returns @a object.
+ */
+void *autoreleaseReturnValue(void *const object);
+
+/*!
+ *  @fn void *retainAutoreleasedReturnValue(void *const object)
+ *  @relates AutoreleasePool
+ *  @brief Retains an object returned by a function that used @ref autoreleaseReturnValue().
+ *  @details If @a object is still in the thread-local slot it is taken out and its reference is handed to the caller, so neither the pool insertion nor the retain happen. Otherwise the object is simply retained.
+ *  @param[in] object the object to retain.
+ *  @returns @a object, owned by the caller.
+ */
+void *retainAutoreleasedReturnValue(void *const object);
+
+/*!
+ *  @fn UInteger AutoreleasePoolGetElidedReturnValueCount()
+ *  @relates AutoreleasePool
+ *  @brief Returns the number of pool insertions skipped by @ref retainAutoreleasedReturnValue() since the process started, across all threads.
+ */
+UInteger AutoreleasePoolGetElidedReturnValueCount();
+
 #endif
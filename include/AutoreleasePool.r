@@ -26,6 +26,7 @@ CO_END_CLASS_TYPE_DECL
 
 CO_BEGIN_CLASS_DECL(AutoreleasePoolClass,Classs)
 	void (* addAutoreleaseObject)(const void *self, const void *object);
+	void (* drainAutoreleasePool)(void *const self);
 CO_END_CLASS_DECL
 
 
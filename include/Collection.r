@@ -12,6 +12,7 @@
 #include <Object.h>
 #include <Object.r>
 #include <foreach.h>
+#include <codefinitions.h>
 
 #include <stdint.h>
 
@@ -22,8 +23,13 @@ CO_BEGIN_CLASS_DECL(CollectionClass,Classs)
 	UInteger (*getCollectionCount)(const void *const self);
 	void * (*lastObject)(const void * const self);
 	void * (*firstObject)(const void * const self);
-	int (*containsObject)(const void * const self, const void * const object);
+	bool (*containsObject)(const void * const self, const void * const object);
 	UInteger (*enumerateWithState)(const void *const collection, FastEnumerationState *const state, void *iobuffer[], UInteger length);
 CO_END_CLASS_DECL
 
+#define CollectionClassLayout struct CollectionClass
+#define CollectionClassRoot .isa
+
+CO_DECLARE_STATIC_CLASS_TABLES(Collection,Class)
+
 #endif
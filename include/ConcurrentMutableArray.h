@@ -25,6 +25,38 @@ CO_DECLARE_CLASS(ConcurrentMutableArray)
  insertObjectAtIndex,
  
  popObject,
+ popObjectWaiting,
+ drainObjectsIntoArray,
  */
 
+/*!
+ *  @fn ObjectRef popObjectWaiting(void *const self, Integer timeout)
+ *  @relates ConcurrentMutableArray
+ *  @brief Removes and returns the first object of @a self, waiting up to @a timeout milliseconds for one to be added.
+ *  @details A negative @a timeout waits forever, zero does not wait at all. The caller owns the returned object and must release it.
+ *  @return the first object or NULL with errno set to ETIMEDOUT if @a self stayed empty.
+ */
+ObjectRef popObjectWaiting(void *const self, Integer timeout);
+
+/*!
+ *  @fn UInteger drainObjectsIntoArray(void *const self, void *const array, UInteger max)
+ *  @relates ConcurrentMutableArray
+ *  @brief Moves up to @a max objects from the front of @a self to the end of the mutable array @a array under one lock acquisition.
+ *  @details Does not wait: use popObjectWaiting() to block for the first object then drain the rest of the batch. The objects
+ *  are added to @a array once @a self is unlocked, so two concurrent arrays may drain into each other from different threads.
+ *  @return the number of objects moved.
+ */
+UInteger drainObjectsIntoArray(void *const self, void *const array, UInteger max);
+
+#ifdef __PROFILING__
+/*!
+ *  @fn void ConcurrentMutableArrayGetLockStatistics(const void *const self, UInteger *const acquisitions, UInteger *const holdTime, UInteger *const maxHoldTime)
+ *  @relates ConcurrentMutableArray
+ *  @brief Returns how many times the lock of @a self was taken and how long, in nanoseconds, it was held in total and at most.
+ *  @details Time spent waiting on the condition of @a self is not counted as held.
+ */
+void ConcurrentMutableArrayGetLockStatistics(const void *const self, UInteger *const acquisitions, UInteger *const holdTime, UInteger *const maxHoldTime);
+void ConcurrentMutableArrayPrintfStatistics(const void *const self);
+#endif
+
 #endif
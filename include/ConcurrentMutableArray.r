@@ -19,11 +19,34 @@ struct ConcurrentMutableArray {
 	const struct MutableArray isa;
 	pthread_mutex_t protector;
 	pthread_cond_t synchronization;
+	/* Consumers blocked on synchronization, producers only signal when it is not zero */
+	UInteger waitingConsumers;
+#ifdef __PROFILING__
+	/* Lock statistics, updated while holding protector */
+	UInteger lockAcquisitions;
+	UInteger lockHoldTime;
+	UInteger maxLockHoldTime;
+	UInteger lockedAt;
+#endif
 };
 
 struct ConcurrentMutableArrayClass {
 	const struct MutableArrayClass isa;
+	ObjectRef (* popObjectWaiting) (void *const self, Integer timeout);
+	UInteger (* drainObjectsIntoArray) (void *const self, void *const array, UInteger max);
+	/* The implementations wrapped by the synchronized methods, resolved once when the class is built */
+	UInteger (* unlockedGetCollectionCount)(const void *const self);
+	ObjectRef (* unlockedGetObjectAtIndex)(const void *const self, UInteger index);
+	void (* unlockedAddObject) (void *const self, void * const object);
+	void (* unlockedInsertObject) (void *const self, void * const object);
+	void (* unlockedInsertObjectAtIndex) (void *const self, void *const object, UInteger index);
+	void (* unlockedRemoveObjectAtIndex) (void *const self, UInteger index);
+	UInteger (* unlockedEnumerateWithState) (const void *const self, FastEnumerationState *const state, void *iobuffer[], UInteger length);
 };
 
+/* Take and give back the lock of self, so that subclasses can call the unlocked methods. */
+void ConcurrentMutableArrayLock(struct ConcurrentMutableArray *const self) CO_VISIBILITY_INTERNAL;
+void ConcurrentMutableArrayUnlock(struct ConcurrentMutableArray *const self) CO_VISIBILITY_INTERNAL;
+
 
 #endif
@@ -0,0 +1,23 @@
+//
+//  ConcurrentQueue.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ConcurrentQueue_h
+#define CObjects_ConcurrentQueue_h
+
+#include <Queue.h>
+
+/*!
+ *  @brief A bounded multi producer, multi consumer FIFO @ref Queue of objects.
+ *  @details Created with new(ConcurrentQueue, capacity, NULL), capacity being an @ref UInteger rounded up to a power of two.
+ *  new returns @a NULL, with errno set to EINVAL, for a capacity too large to be rounded up and allocated.
+ *  The try methods never block nor take a lock. The queue retains the objects it holds and hands them over, retained, to
+ *  the consumer that dequeues them, who must release them.
+ */
+CO_DECLARE_CLASS(ConcurrentQueue)
+
+#endif
@@ -0,0 +1,35 @@
+//
+//  ConcurrentQueue.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ConcurrentQueue_r
+#define CObjects_ConcurrentQueue_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Queue.r>
+
+/* A slot of the ring. Its sequence tells whose turn it is: equal to the enqueue position it is free for that
+ * producer, equal to the dequeue position + 1 it is full for that consumer. */
+struct _ConcurrentQueueCell {
+	UInteger sequence;
+	void *object;
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(ConcurrentQueue,Queue)
+	struct _ConcurrentQueueCell *cells;
+	char enqueuePadding[CO_CACHE_LINE_SIZE];
+	UInteger enqueuePosition;
+	char dequeuePadding[CO_CACHE_LINE_SIZE];
+	UInteger dequeuePosition;
+	char endPadding[CO_CACHE_LINE_SIZE];
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(ConcurrentQueueClass,QueueClass)
+CO_END_CLASS_DECL
+
+#endif
@@ -11,6 +11,16 @@
 
 CO_DECLARE_CLASS(Couple)
 
+/*!
+ *  @struct CoupleArguments
+ *  @relates Couple
+ *  @brief The arguments of a @ref Couple for @ref newWithArguments().
+ */
+typedef struct _CoupleArguments {
+	void *key;		/*!< The key, must not be @a NULL */
+	void *value;	/*!< The value, must not be @a NULL */
+} CoupleArguments;
+
 void * getKey(const void * const self);
 void * getValue(const void * const self);
 void setKey(void * const self, void * const key);
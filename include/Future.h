@@ -0,0 +1,75 @@
+//
+//  Future.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Future_h
+#define CObjects_Future_h
+
+#include <coint.h>
+#include <codefinitions.h>
+#include <ThreadPool.h>
+
+/*!
+ *  @brief The result of an asynchronous operation, available once the @ref Promise it comes from is completed.
+ *  @details A future is completed exactly once, either with a value, which it retains, or with an error code. Any
+ *  number of threads can wait for it and any number of continuations can be attached to it.
+ */
+CO_DECLARE_CLASS(Future)
+
+/*! A continuation: called once @a future is completed, with the argument it was attached with. */
+typedef void (*FutureCallback)(FutureRef future, void *argument);
+
+/*!
+ *  @fn ObjectRef getFutureValue(void *const self, Integer timeout)
+ *  @relates Future
+ *  @brief Returns the value of @a self, waiting up to @a timeout milliseconds for it to be completed.
+ *  @details A negative @a timeout waits forever, zero does not wait at all. The value belongs to @a self.
+ *  @return the value, or NULL with errno set to ETIMEDOUT if @a self is still pending or to the error it failed with.
+ */
+ObjectRef getFutureValue(void *const self, Integer timeout);
+
+/*!
+ *  @fn bool isFutureReady(const void *const self)
+ *  @relates Future
+ *  @brief Returns whether @a self is completed, without waiting.
+ */
+bool isFutureReady(const void *const self);
+
+/*!
+ *  @fn int getFutureError(const void *const self)
+ *  @relates Future
+ *  @brief Returns the error @a self failed with, or 0 if it is pending or has a value.
+ */
+int getFutureError(const void *const self);
+
+/*!
+ *  @fn void thenFuture(void *const self, FutureCallback callback, void *const argument, ThreadPoolRef pool)
+ *  @relates Future
+ *  @brief Calls @a callback with @a self and @a argument once @a self is completed.
+ *  @details With a NULL @a pool the callback runs inline: on the thread completing @a self, or right away on the
+ *  calling thread if @a self is already completed. Otherwise it is submitted to @a pool, which retains @a self meanwhile.
+ *  Continuations run in the order they were attached.
+ */
+void thenFuture(void *const self, FutureCallback callback, void *const argument, ThreadPoolRef pool);
+
+/*!
+ *  @fn FutureRef newFutureWhenAll(const void *const futures)
+ *  @relates Future
+ *  @brief Returns a new future completed with the @ref Array @a futures once they all have a value.
+ *  @details It fails as soon as one of @a futures fails, with the same error. The caller must release it.
+ */
+FutureRef newFutureWhenAll(const void *const futures);
+
+/*!
+ *  @fn FutureRef newFutureWhenAny(const void *const futures)
+ *  @relates Future
+ *  @brief Returns a new future completed with the first of the @ref Array @a futures to be completed, failed or not.
+ *  @details The caller must release it. Returns NULL with errno set to EINVAL if @a futures is empty.
+ */
+FutureRef newFutureWhenAny(const void *const futures);
+
+#endif
@@ -0,0 +1,47 @@
+//
+//  Future.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Future_r
+#define CObjects_Future_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <pthread.h>
+
+struct _FutureContinuation {
+	struct Future *future;
+	FutureCallback callback;
+	void *argument;
+	ThreadPoolRef pool;
+	struct _FutureContinuation *next;
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(Future,Object)
+	/* Set once, under lock, read without it once ready is seen */
+	bool ready;
+	ObjectRef value;
+	int error;
+	pthread_mutex_t lock;
+	pthread_cond_t completion;
+	/* The continuations waiting for the completion, in the order they were attached */
+	struct _FutureContinuation *continuations;
+	struct _FutureContinuation **lastContinuation;
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(FutureClass,Classs)
+	ObjectRef (* getFutureValue) (void *const self, Integer timeout);
+	bool (* isFutureReady) (const void *const self);
+	int (* getFutureError) (const void *const self);
+	void (* thenFuture) (void *const self, FutureCallback callback, void *const argument, ThreadPoolRef pool);
+CO_END_CLASS_DECL
+
+/* Completes self with value, retained, or with error, then runs the continuations. For Promise. Returns NO with errno
+ * set to EALREADY if self was already completed. */
+bool FutureComplete(struct Future *const self, void *const value, int error) CO_VISIBILITY_INTERNAL;
+
+#endif
@@ -13,6 +13,11 @@ CO_DECLARE_CLASS(MutableString)
 
 void appendString(void *const self, const void *const other);
 void appendFormat(void *const self, char *format, ...);
+/* Appends length bytes, which need not be null terminated, at the end of self */
+void appendBytes(void *const self, const void *const bytes, UInteger length);
+void appendCharacter(void *const self, char character);
+/* Grows self so that capacity characters fit without further reallocation */
+void reserveMutableStringCapacity(void *const self, UInteger capacity);
 void setString(void *const self, const void *const other);
 void setMutableStringLength(void *const self, UInteger capacity);
 int insertStringAtMutableStringIndex(void *const self, const void *const other, UInteger index);
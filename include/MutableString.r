@@ -21,6 +21,9 @@ CO_END_CLASS_TYPE_DECL
 CO_BEGIN_CLASS_DECL(MutableStringClass,StringClass)
 	void ( * appendString ) (void *const self, const void *const other);
 	void ( * appendFormat ) (void *const self, char *format, va_list *app);
+	void ( * appendBytes ) (void *const self, const void *const bytes, UInteger length);
+	void ( * appendCharacter ) (void *const self, char character);
+	void ( * reserveMutableStringCapacity ) (void *const self, UInteger capacity);
 	void ( * setString ) (void *const self, const void *const other);
 	void ( * setMutableStringLength ) (void *const self, UInteger capacity);
 	
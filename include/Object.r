@@ -106,6 +106,13 @@ typedef UInteger (* retc) (const void *const self);
 
 typedef void *(*autor) (void *const self);
 
+/*!
+ *  @typedef typedef void * (* ictor) (void * self, const void *const arguments)
+ *  @private
+ *  @brief The form of an @ref Object @ref initializer, the typed counterpart of a @ref constructor.
+ */
+typedef void * (* ictor) (void * self, const void *const arguments);
+
 /*!
  *  @class Class Object.r
  *  @private
@@ -219,6 +226,14 @@ struct Classs {
 	 *  @brief The function pointer to the @ref autorelease method of this class.
 	 */
 	autor autorelease;
+	
+	/*!
+	 *  @member initializer
+	 *  @protected
+	 *  @brief The function pointer to the @ref initializer of this class, used by @ref newWithArguments().
+	 *  @details It is @a NULL when the class (or a class between it and the class that defined the initializer) overrides @ref constructor without providing an initializer.
+	 */
+	ictor initializer;
 };
 
 /*!
@@ -233,6 +248,18 @@ struct Classs {
  */
 void * super_constructor(const void * class, void * self, va_list * app);
 
+/*!
+ *  @protected
+ *  @method void * super_initializer(const void * class, void * self, const void *const arguments)
+ *  @relates Object
+ *  @brief A method that calls the super class's initializer of a given class.
+ *  @param[in] class the @ref Class which its super initializer will be called.
+ *  @param[in] self the instance, of type @ref Object.
+ *  @param[in] arguments the class specific arguments structure.
+ *  @return a @ref ObjectRef pointer (probably) pointing to self.
+ */
+void * super_initializer(const void * class, void * self, const void *const arguments);
+
 /*!
  *  @protected
  *  @method void * super_destructor(const void * class)
@@ -254,6 +281,17 @@ void * super_destructor(const void * class, void * self);
  */
 void * constructor(void * self, va_list * app);
 
+/*!
+ *  @protected
+ *  @method void * initializer(void * self, const void *const arguments)
+ *  @relates Object
+ *  @brief An @ref Object @ref initializer. It's called by @ref newWithArguments() to initialize a newly created instance from a class specific arguments structure instead of a variadic list. It follows the same rules as @ref constructor.
+ *  @param[in] self the instance of type @ref Object.
+ *  @param[in] arguments the class specific arguments structure.
+ *  @return a @ref ObjectRef pointer (probably) pointing to self.
+ */
+void * initializer(void * self, const void *const arguments);
+
 /*!
  *  @protected
  *  @method void * super_destructor(const void * class)
@@ -267,6 +305,7 @@ void * destructor(void * self);
 
 
 void * Object_constructor (void * _self, va_list * app);
+void * Object_initializer (void * _self, const void *const arguments);
 void * Object_destructor (void * _self);
 void * Object_copy (const void * const _self);
 bool Object_equals (const void *const _self, const void *const _other);
@@ -283,4 +322,95 @@ void * Object_copyDescription (const void *const _self);
 
 const void * super (const void *const _self);
 
+/* Class methods */
+void * Class_constructor (void * _self, va_list * app);
+void * Class_destructor (void * _self);
+void * Class_copy (const void *const _self);
+UInteger Class_hash (const void *const self);
+void * Class_retain (void *const _self);
+void * Class_autorelease (void *const _self);
+
+/* Static class tables */
+
+/*!
+ *  @private
+ *  @brief The static tables of @ref Object and @ref Class.
+ */
+extern const struct Classs CORootClasses[3];
+#define ObjectTable (CORootClasses[0])
+#define ClassTable (CORootClasses[1])
+#define LazyClassTable (CORootClasses[2])
+
+/*!
+ *  @private
+ *  @brief The placeholder a class variable points to, in the @a CO_LAZY_CLASS_INIT mode, until its class is built.
+ *  @details Its class is @ref LazyClassTable, whose retain and release do nothing.
+ */
+struct COLazyClass {
+	struct Object isa;
+	void (*initialize)(void);
+	const void *const *class;
+};
+
+/*!
+ *  @private
+ *  @brief Whether @a class is a @ref COLazyClass placeholder.
+ */
+#define COClassIsLazy(type) (((const struct Object *)(type))->class == &LazyClassTable)
+
+/*!
+ *  @private
+ *  @brief Builds the class of a @ref COLazyClass placeholder, if not already built, and returns it.
+ */
+const void * COResolveLazyClass (const void *const class);
+
+/*!
+ *  @private
+ *  @brief Returns the class a class variable stands for, building it first when it is a @ref COLazyClass placeholder.
+ */
+#if defined(CO_LAZY_CLASS_INIT)
+#define COResolveClass(type) (COClassIsLazy(type) ? COResolveLazyClass(type) : (const void *)(type))
+#else
+#define COResolveClass(type) ((const void *)(type))
+#endif
+
+/*!
+ *  @private
+ *  @brief The layout of a class's class structure and the designator path from it to its @ref Classs part.
+ *  @details Every class structure usable as the superclass argument of @ref CO_CLASS_TYPE_STATIC_DECL defines these two.
+ */
+#define ClassLayout struct Classs
+#define ClassRoot
+
+/*!
+ *  @private
+ *  @brief The designated initializers of the methods every static class inherits from @ref Object.
+ *  @details @a constructor and @a initializer are left out: a static class lists its own.
+ */
+#define CO_OBJECT_METHODS(root) \
+	root.destructor = Object_destructor, \
+	root.copy = Object_copy, \
+	root.equals = Object_equals, \
+	root.hash = Object_hash, \
+	root.copyDescription = Object_copyDescription, \
+	root.retain = Object_retain, \
+	root.release = Object_release, \
+	root.retainCount = Object_retainCount, \
+	root.autorelease = Object_autorelease
+
+/*!
+ *  @private
+ *  @brief The designated initializers of the methods every static class's class inherits from @ref Class.
+ */
+#define CO_CLASS_METHODS(root) \
+	root.destructor = Class_destructor, \
+	root.copy = Class_copy, \
+	root.equals = Object_equals, \
+	root.hash = Class_hash, \
+	root.copyDescription = Object_copyDescription, \
+	root.retain = Class_retain, \
+	root.release = Object_release, \
+	root.retainCount = Object_retainCount, \
+	root.autorelease = Class_autorelease
+
 #endif
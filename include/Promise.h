@@ -0,0 +1,45 @@
+//
+//  Promise.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Promise_h
+#define CObjects_Promise_h
+
+#include <Future.h>
+
+/*!
+ *  @brief The producing side of a @ref Future.
+ *  @details Created with @c new(Promise, NULL) along with its future. Whoever computes the result completes the promise
+ *  once; whoever waits for it holds the future. Releasing a promise that was never completed fails its future with
+ *  ECANCELED.
+ */
+CO_DECLARE_CLASS(Promise)
+
+/*!
+ *  @fn FutureRef getPromiseFuture(const void *const self)
+ *  @relates Promise
+ *  @brief Returns the future of @a self. It belongs to @a self, retain it to keep it longer.
+ */
+FutureRef getPromiseFuture(const void *const self);
+
+/*!
+ *  @fn bool fulfillPromise(void *const self, void *const value)
+ *  @relates Promise
+ *  @brief Completes the future of @a self with @a value, which it retains.
+ *  @return NO with errno set to EALREADY if the future was already completed.
+ */
+bool fulfillPromise(void *const self, void *const value);
+
+/*!
+ *  @fn bool failPromise(void *const self, int error)
+ *  @relates Promise
+ *  @brief Completes the future of @a self with the non zero error code @a error.
+ *  @return NO with errno set to EALREADY if the future was already completed.
+ */
+bool failPromise(void *const self, int error);
+
+#endif
@@ -0,0 +1,26 @@
+//
+//  Promise.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Promise_r
+#define CObjects_Promise_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Future.r>
+
+CO_BEGIN_CLASS_TYPE_DECL(Promise,Object)
+	struct Future *future;
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(PromiseClass,Classs)
+	FutureRef (* getPromiseFuture) (const void *const self);
+	bool (* fulfillPromise) (void *const self, void *const value);
+	bool (* failPromise) (void *const self, int error);
+CO_END_CLASS_DECL
+
+#endif
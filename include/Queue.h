@@ -0,0 +1,84 @@
+//
+//  Queue.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Queue_h
+#define CObjects_Queue_h
+
+#include <coint.h>
+#include <stdbool.h>
+
+/*!
+ *  @brief The abstract bounded FIFO queue of objects, @ref ConcurrentQueue and @ref SPSCQueue being its implementations.
+ *  @details A subclass is created with new(Subclass, capacity, NULL), capacity being an @ref UInteger rounded up to a
+ *  power of two. Queue keeps that capacity, which it answers getQueueCapacity() with, and the parking of the blocking
+ *  methods. The subclasses hold the objects and implement the other methods, which fail with ENOTSUP on a plain Queue.
+ */
+CO_DECLARE_CLASS(Queue)
+
+/*!
+ *  @fn bool tryEnqueueObject(void *const self, void *const object)
+ *  @relates Queue
+ *  @brief Appends @a object to the queue unless it is full.
+ *  @return YES if @a object was enqueued, NO if the queue was full.
+ */
+bool tryEnqueueObject(void *const self, void *const object);
+
+/*!
+ *  @fn ObjectRef tryDequeueObject(void *const self)
+ *  @relates Queue
+ *  @brief Removes the oldest object of the queue unless it is empty.
+ *  @return The object, which the caller must release, or NULL if the queue was empty.
+ */
+ObjectRef tryDequeueObject(void *const self);
+
+/*!
+ *  @fn UInteger tryEnqueueObjects(void *const self, void *const objects[], UInteger count)
+ *  @relates Queue
+ *  @brief Appends, in order, as many of the @a count @a objects as fit.
+ *  @return The number of objects enqueued, the first ones of @a objects.
+ */
+UInteger tryEnqueueObjects(void *const self, void *const objects[], UInteger count);
+
+/*!
+ *  @fn UInteger tryDequeueObjects(void *const self, ObjectRef objects[], UInteger count)
+ *  @relates Queue
+ *  @brief Removes up to @a count objects into @a objects, oldest first.
+ *  @return The number of objects dequeued, which the caller must release.
+ */
+UInteger tryDequeueObjects(void *const self, ObjectRef objects[], UInteger count);
+
+/*!
+ *  @fn void enqueueObject(void *const self, void *const object)
+ *  @relates Queue
+ *  @brief Appends @a object to the queue, waiting while it is full.
+ */
+void enqueueObject(void *const self, void *const object);
+
+/*!
+ *  @fn ObjectRef dequeueObject(void *const self)
+ *  @relates Queue
+ *  @brief Removes the oldest object of the queue, waiting while it is empty.
+ *  @return The object, which the caller must release.
+ */
+ObjectRef dequeueObject(void *const self);
+
+/*!
+ *  @fn UInteger getQueueCapacity(const void *const self)
+ *  @relates Queue
+ *  @brief Returns the number of objects the queue can hold.
+ */
+UInteger getQueueCapacity(const void *const self);
+
+/*!
+ *  @fn UInteger getQueueCount(const void *const self)
+ *  @relates Queue
+ *  @brief Returns the number of objects in the queue, a snapshot that may be stale as soon as it is returned.
+ */
+UInteger getQueueCount(const void *const self);
+
+#endif
@@ -0,0 +1,42 @@
+//
+//  Queue.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Queue_r
+#define CObjects_Queue_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <pthread.h>
+
+CO_BEGIN_CLASS_TYPE_DECL(Queue,Object)
+	/* The capacity, a power of two, minus one */
+	UInteger mask;
+	char parkingPadding[CO_CACHE_LINE_SIZE];
+	/* Parking of the blocking methods, only touched when someone waits */
+	UInteger waitingProducers;
+	UInteger waitingConsumers;
+	pthread_mutex_t parking;
+	pthread_cond_t notFull;
+	pthread_cond_t notEmpty;
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(QueueClass,Classs)
+	bool (* tryEnqueueObject) (void *const self, void *const object);
+	ObjectRef (* tryDequeueObject) (void *const self);
+	UInteger (* tryEnqueueObjects) (void *const self, void *const objects[], UInteger count);
+	UInteger (* tryDequeueObjects) (void *const self, ObjectRef objects[], UInteger count);
+	void (* enqueueObject) (void *const self, void *const object);
+	ObjectRef (* dequeueObject) (void *const self);
+	UInteger (* getQueueCapacity) (const void *const self);
+	UInteger (* getQueueCount) (const void *const self);
+CO_END_CLASS_DECL
+
+/* Wakes the threads parked on condition, if any, after count objects changed hands. For subclasses' methods. */
+void QueueWake(struct Queue *const self, UInteger *const waiting, pthread_cond_t *const condition, UInteger count) CO_VISIBILITY_INTERNAL;
+
+#endif
@@ -0,0 +1,37 @@
+//
+//  ReadMostlyMutableArray.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ReadMostlyMutableArray_h
+#define CObjects_ReadMostlyMutableArray_h
+
+#include <ConcurrentMutableArray.h>
+
+/*!
+ *  @brief A @ref ConcurrentMutableArray for data read by many threads and seldom changed.
+ *  @details Every modification publishes an immutable @ref Array snapshot of the contents with one atomic pointer swap.
+ *  getCollectionCount(), getObjectAtIndex() and copy() read the current snapshot without any lock: a reader only
+ *  increments and decrements a counter of its own, so reads are wait-free and scale with the reader threads. There is one
+ *  counter per processor online when the array is made, threads beyond that share them, which stays correct but makes
+ *  them contend. A writer pays for a copy of the contents and then waits for the readers of the replaced snapshot before
+ *  releasing it.
+ *  getObjectAtIndex() does not wait for an object: on an empty array it fails with EINVAL like any index out of range.
+ *  As with @ref ConcurrentMutableArray the returned object is only guaranteed to live while it stays in the array.
+ */
+CO_DECLARE_CLASS(ReadMostlyMutableArray)
+
+#ifdef __PROFILING__
+/*!
+ *  @fn void ReadMostlyMutableArrayGetStatistics(const void *const self, UInteger *const publications, UInteger *const gracePeriodTime)
+ *  @relates ReadMostlyMutableArray
+ *  @brief Returns how many snapshots @a self published and how long, in nanoseconds, writers waited for readers of replaced ones.
+ */
+void ReadMostlyMutableArrayGetStatistics(const void *const self, UInteger *const publications, UInteger *const gracePeriodTime);
+void ReadMostlyMutableArrayPrintfStatistics(const void *const self);
+#endif
+
+#endif
@@ -0,0 +1,43 @@
+//
+//  ReadMostlyMutableArray.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ReadMostlyMutableArray_r
+#define CObjects_ReadMostlyMutableArray_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Array.r>
+#include <ConcurrentMutableArray.r>
+#include <pthread.h>
+
+/* Readers inside the snapshot published before and after the last epoch flip, by parity of the epoch */
+struct _ReadMostlyReaderSlot {
+	UInteger readers[2];
+	char padding[CO_CACHE_LINE_SIZE - 2 * sizeof(UInteger)];
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(ReadMostlyMutableArray,ConcurrentMutableArray)
+	char snapshotPadding[CO_CACHE_LINE_SIZE];
+	/* Read by everyone, written by the publishing writer */
+	struct Array *snapshot;
+	UInteger epoch;
+	/* One slot per processor online when the array was made, threads beyond share them */
+	struct _ReadMostlyReaderSlot *slots;
+	UInteger slotCount;
+	/* Serializes the publications and their grace periods */
+	pthread_mutex_t publishing;
+#ifdef __PROFILING__
+	UInteger publications;
+	UInteger gracePeriodTime;
+#endif
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(ReadMostlyMutableArrayClass,ConcurrentMutableArrayClass)
+CO_END_CLASS_DECL
+
+#endif
@@ -0,0 +1,81 @@
+//
+//  Rope.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Rope_h
+#define CObjects_Rope_h
+
+#include <coint.h>
+#include <corange.h>
+#include <codefinitions.h>
+
+/*!
+ *  @brief A @ref MutableString kept as a balanced tree of immutable chunks, for long texts edited in the middle.
+ *  @details Created with @c new(Rope, text, NULL) or @c newWithArguments(Rope, &(StringArguments){ text, length }).
+ *  @ref insertStringAtMutableStringIndex(), @ref deleteMutableStringCharactersInRange(), the appends and
+ *  @ref characterAtIndex() take a time logarithmic in the number of chunks instead of moving the tail of the text.
+ *  Inserted plain Strings and slices become chunks without being copied, other Strings are copied once. Short edits
+ *  are merged into the chunk they touch, so that typing does not split the text a character at a time.
+ *  The chunks are enumerated in order, without copying them, with @ref MakeRopeChunks() and @ref nextRopeChunk().
+ *  @ref getStringText() materializes the whole text into a buffer the rope keeps until its next edit, as does every
+ *  method of @ref String needing it; @ref copyRopeAsString() materializes it into a new @ref String. @ref copy shares
+ *  the chunks of the rope with the copy.
+ *  @warning A rope is not thread safe.
+ */
+CO_DECLARE_CLASS(Rope)
+
+/*!
+ *  @struct RopeChunks
+ *  @relates Rope
+ *  @brief The state of an enumeration of the chunks of a @ref Rope, created by @ref MakeRopeChunks() and advanced by @ref nextRopeChunk().
+ */
+typedef struct _RopeChunks {
+	const void *rope;		/*!< The enumerated @ref Rope */
+	UInteger location;		/*!< Where the next chunk starts in the text of @a rope */
+} RopeChunks;
+
+/*!
+ *  @fn RopeChunks MakeRopeChunks(const void *const rope)
+ *  @relates Rope
+ *  @brief Returns an enumeration of the chunks of @a rope, from its start.
+ */
+RopeChunks MakeRopeChunks(const void *const rope);
+
+/*!
+ *  @fn bool nextRopeChunk(RopeChunks *const chunks, const char **text, UInteger *length)
+ *  @relates Rope
+ *  @brief Sets @a text and @a length to the next chunk of the enumeration, which is not null terminated.
+ *  @details The text belongs to the rope and is valid until its next edit. An enumeration edited under continues from
+ *  where it was in the text.
+ *  @returns @a NO once the chunks are exhausted.
+ */
+bool nextRopeChunk(RopeChunks *const chunks, const char **text, UInteger *length);
+
+/*!
+ *  @fn const char *getRopeChunkAtIndex(const void *const self, UInteger index, UInteger *length)
+ *  @relates Rope
+ *  @brief Returns the text of the chunk of @a self holding the character at @a index, from that character on, and sets
+ *  @a length to the number of its characters from there.
+ *  @returns @a NULL, with errno set to EINVAL, if @a index is past the end of @a self.
+ */
+const char *getRopeChunkAtIndex(const void *const self, UInteger index, UInteger *length);
+
+/*!
+ *  @fn StringRef copyRopeAsString(const void *const self)
+ *  @relates Rope
+ *  @brief Returns a new @ref String with the text of @a self, the chunks copied one after the other.
+ */
+StringRef copyRopeAsString(const void *const self);
+
+/*!
+ *  @fn UInteger getRopeChunkCount(const void *const self)
+ *  @relates Rope
+ *  @brief Returns the number of chunks of @a self.
+ */
+UInteger getRopeChunkCount(const void *const self);
+
+#endif
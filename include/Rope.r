@@ -0,0 +1,43 @@
+//
+//  Rope.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_Rope_r
+#define CObjects_Rope_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <MutableString.r>
+
+/* Edits leaving a chunk at most this long are merged into it instead of splitting it */
+#define ROPE_CHUNK_CAPACITY 512
+
+/* A node of a treap ordered by position: each node holds a chunk, the subtrees the text before and after it */
+struct _RopeNode {
+	struct _RopeNode *left;
+	struct _RopeNode *right;
+	StringRef chunk;	/* A plain String, retained, which may be shared with other nodes and ropes */
+	Range range;		/* The part of the text of chunk the node holds */
+	UInteger length;	/* Of the text of the whole subtree */
+	UInteger count;		/* Of the nodes of the whole subtree */
+	UInteger priority;	/* Greater than those of the subtrees */
+};
+
+/* The text and capacity of MutableString are those of the materialized text */
+CO_BEGIN_CLASS_TYPE_DECL(Rope,MutableString)
+	struct _RopeNode *root;
+	UInteger seed;	/* Of the priorities */
+	bool flat;		/* Whether the materialized text is that of the chunks */
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(RopeClass,MutableStringClass)
+	const char * ( * getRopeChunkAtIndex ) (const void *const self, UInteger index, UInteger *length);
+	StringRef ( * copyRopeAsString ) (const void *const self);
+	UInteger ( * getRopeChunkCount ) (const void *const self);
+CO_END_CLASS_DECL
+
+#endif
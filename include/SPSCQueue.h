@@ -0,0 +1,23 @@
+//
+//  SPSCQueue.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_SPSCQueue_h
+#define CObjects_SPSCQueue_h
+
+#include <Queue.h>
+
+/*!
+ *  @brief A bounded single producer, single consumer FIFO queue of objects.
+ *  @details A @ref Queue, created like @ref ConcurrentQueue, for exactly one producing and one consuming thread. It
+ *  answers the whole @ref Queue API without any atomic read-modify-write: each side owns its index, on its own cache
+ *  line, and keeps a cached copy of the other side's, re-read only when the queue looks full or empty. The batch methods
+ *  publish a whole batch with a single store.
+ */
+CO_DECLARE_CLASS(SPSCQueue)
+
+#endif
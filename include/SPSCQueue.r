@@ -0,0 +1,33 @@
+//
+//  SPSCQueue.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_SPSCQueue_r
+#define CObjects_SPSCQueue_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Queue.r>
+
+/* A ring of plain slots, tail & mask being the next slot written and head & mask the next read */
+CO_BEGIN_CLASS_TYPE_DECL(SPSCQueue,Queue)
+	void **slots;
+	char producerPadding[CO_CACHE_LINE_SIZE];
+	/* Owned by the producer */
+	UInteger tail;
+	UInteger cachedHead;
+	char consumerPadding[CO_CACHE_LINE_SIZE];
+	/* Owned by the consumer */
+	UInteger head;
+	UInteger cachedTail;
+	char endPadding[CO_CACHE_LINE_SIZE];
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(SPSCQueueClass,QueueClass)
+CO_END_CLASS_DECL
+
+#endif
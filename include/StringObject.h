@@ -43,12 +43,27 @@ enum SStringComparingOptions {
 	SStringComparingOptionCaseInsensitiveSearch =	(1<<0),	/*!< A case-insensitive search. */ // = 0
 	SStringComparingOptionLiteralSearch =					(1<<1),	/*!< Exact character-by-character equivalence. */ // = 2
 	SStringComparingOptionLocalizedCompare =			(1<<2),	/*!< A localized compare */ // = 4
+	SStringComparingOptionBackwardsSearch =				(1<<3),	/*!< A search from the end of the range. */ // = 8
+	SStringComparingOptionAnchoredSearch =				(1<<4),	/*!< A search matching only at the start, or at the end when backwards, of the range. */ // = 16
 };
 /*!
  *  @typedef enum SStringComparingOptions SStringComparingOptions;
  */
 typedef enum SStringComparingOptions SStringComparingOptions;
 
+/*! The length of @ref StringArguments copying @a text up to its terminating null byte */
+#define StringArgumentsNullTerminated UIntegerMax
+
+/*!
+ *  @struct StringArguments
+ *  @relates String
+ *  @brief The arguments of a @ref String for @ref newWithArguments().
+ */
+typedef struct _StringArguments {
+	const char *text;	/*!< The text to copy, can be @a NULL */
+	UInteger length;	/*!< The number of bytes of @a text to copy, 0 for an empty string, or @ref StringArgumentsNullTerminated */
+} StringArguments;
+
 /* API */
 /*!
  *  @fn StringRef newStringWithFormat(const void *const _class, const void *format, ...)
@@ -61,6 +76,36 @@ typedef enum SStringComparingOptions SStringComparingOptions;
  */
 StringRef newStringWithFormat(const void *const class, const void *format, ...);
 
+/*!
+ *  @fn StringRef newStringWithInteger(const void *const class, Integer value)
+ *  @relates String
+ *  @brief Creates a new instance of @ref String (or a subclass of) with the decimal digits of @a value, as the format "%ld" would, without parsing a format.
+ */
+StringRef newStringWithInteger(const void *const class, Integer value);
+
+/*!
+ *  @fn StringRef newStringWithDouble(const void *const class, double value, UInteger decimals)
+ *  @relates String
+ *  @brief Creates a new instance of @ref String (or a subclass of) with @a value written with @a decimals digits after the decimal point, as the format "%.*f" would.
+ *  @details Up to 9 decimals and magnitudes whose scaled value fits in 63 bits are written without parsing a format. They are rounded half away from zero, so the last digit may differ from printf for values halfway between two results.
+ */
+StringRef newStringWithDouble(const void *const class, double value, UInteger decimals);
+
+/*!
+ *  @fn StringRef newStringWithStrings(const void *const class, const void *const first, ...)
+ *  @relates String
+ *  @brief Creates a new instance of @ref String (or a subclass of) with the catenation of the @a NULL terminated list of strings starting with @a first, sized once and copied without parsing a format.
+ */
+StringRef newStringWithStrings(const void *const class, const void *const first, ...);
+
+/*!
+ *  @fn StringRef componentsJoinedByString(const void *const array, const void *const separator)
+ *  @relates Array
+ *  @brief Creates a new @ref String with the @ref String instances of @a array joined by @a separator, which can be @a NULL to join them with nothing.
+ *  @details The length of the result is summed first so that its text is allocated once and each component copied into it without parsing a format.
+ */
+StringRef componentsJoinedByString(const void *const array, const void *const separator);
+
 /*!
  *  @method
  *  @relates String
@@ -144,5 +189,137 @@ StringRef copyStringByTrimmingSpaces(const void *const self);
  */
 StringRef copyStringByAppendingString(const void *restrict const self, const void *restrict const other);
 
+/*!
+ *  @method
+ *  @relates String
+ *  @brief A method that finds the first occurrence of a given string in the receiver.
+ *  @param[in] self the receiver @ref String (or a subclass) instace.
+ *  @param[in] other the @ref String (or a subclass) instace to search for.
+ *  @returns the range of the occurrence, or a range whose location is @ref NotFound if @a other does not occur in the receiver or is empty.
+ */
+Range rangeOfString(const void *const self, const void *const other);
+
+/*!
+ *  @method
+ *  @relates String
+ *  @brief A method that finds an occurrence of a given string in the receiver.
+ *  @param[in] self the receiver @ref String (or a subclass) instace.
+ *  @param[in] other the @ref String (or a subclass) instace to search for.
+ *  @param[in] options any combination of @ref SStringComparingOptionCaseInsensitiveSearch, @ref SStringComparingOptionBackwardsSearch and @ref SStringComparingOptionAnchoredSearch.
+ *  @returns the range of the occurrence, or a range whose location is @ref NotFound.
+ */
+Range rangeOfStringWithOptions(const void *const self, const void *const other, SStringComparingOptions options);
+
+/*!
+ *  @method
+ *  @relates String
+ *  @brief A method that finds an occurrence of a given string in a range of the receiver.
+ *  @details The search neither reads past the length of the receiver nor needs its text to be null terminated. Needles are located with vectorized filtering or, for long ones, the Two-Way algorithm (see cosearch.h). A case-insensitive search ignores the case of ASCII letters only.
+ *  @param[in] self the receiver @ref String (or a subclass) instace.
+ *  @param[in] other the @ref String (or a subclass) instace to search for.
+ *  @param[in] options any combination of @ref SStringComparingOptionCaseInsensitiveSearch, @ref SStringComparingOptionBackwardsSearch and @ref SStringComparingOptionAnchoredSearch.
+ *  @param[in] range the range of the receiver to search in. The range must not exceed the bounds of the receiver.
+ *  @returns the range of the occurrence, or a range whose location is @ref NotFound. If @a range lies outside the bounds of the receiver @a errno is positioned to @a EINVAL.
+ */
+Range rangeOfStringWithOptionsInRange(const void *const self, const void *const other, SStringComparingOptions options, Range range);
+
+/*!
+ *  @struct StringSearch
+ *  @relates String
+ *  @brief The state of a search for every occurrence of a string, created by @ref MakeStringSearch() and advanced by @ref nextRangeOfString().
+ */
+typedef struct _StringSearch {
+	const void *string;					/*!< The searched @ref String */
+	const void *needle;					/*!< The @ref String searched for */
+	SStringComparingOptions options;	/*!< The options of each search */
+	Range range;						/*!< What is left to search, shrinking past each occurrence found */
+} StringSearch;
+
+/*!
+ *  @fn StringSearch MakeStringSearch(const void *const string, const void *const needle, SStringComparingOptions options)
+ *  @relates String
+ *  @brief Returns a search for the occurrences of @a needle in the whole of @a string, from its end with @ref SStringComparingOptionBackwardsSearch.
+ */
+StringSearch MakeStringSearch(const void *const string, const void *const needle, SStringComparingOptions options);
+
+/*!
+ *  @fn Range nextRangeOfString(StringSearch *const search)
+ *  @relates String
+ *  @brief Returns the range of the next occurrence of the search, occurrences not overlapping, or a range whose location is @ref NotFound once they are exhausted.
+ */
+Range nextRangeOfString(StringSearch *const search);
+
+/*!
+ *  @fn StringRef internString(const void *const string)
+ *  @relates String
+ *  @brief Returns the interned @ref String with the text of @a string, interning one the first time the text is seen.
+ *  @details There is a single interned @ref String per text for the life of the process, shared by all threads: two
+ *  interned strings are equal exactly when they are the same pointer, which is what @ref equals checks first. An
+ *  interned string is immortal: @ref retain and @ref release leave it alone, so it need not be released, nor retained
+ *  to be kept. Its hash is computed once when it is interned. The table is split in independently locked shards.
+ *  @returns the interned @ref String, or @a NULL with errno set to ENOMEM.
+ */
+StringRef internString(const void *const string);
+
+/*!
+ *  @fn StringRef internStringWithText(const char *const text, UInteger length)
+ *  @relates String
+ *  @brief Returns the interned @ref String with the @a length bytes of @a text, as @ref internString() does, without a @ref String to look it up with.
+ */
+StringRef internStringWithText(const char *const text, UInteger length);
+
+/*!
+ *  @struct StringInternStatistics
+ *  @relates String
+ *  @brief The memory used by the interned strings, returned by @ref getStringInternStatistics().
+ */
+typedef struct _StringInternStatistics {
+	UInteger count;			/*!< The number of interned strings */
+	UInteger bytes;			/*!< The bytes of their instances and of the texts too long to be stored inline */
+	UInteger tableBytes;	/*!< The bytes of the table slots */
+	UInteger lookups;		/*!< The number of calls to @ref internString() and @ref internStringWithText() */
+	UInteger hits;			/*!< How many of those found the text already interned */
+} StringInternStatistics;
+
+/*!
+ *  @fn StringInternStatistics getStringInternStatistics(void)
+ *  @relates String
+ *  @brief Returns the statistics of the intern table, summed over its shards.
+ */
+StringInternStatistics getStringInternStatistics(void);
+
+/*!
+ *  @fn StringRef newStringWithUTF8Text(const void *const class, const char *const text, UInteger length)
+ *  @relates String
+ *  @brief Creates a new instance of @ref String (or a subclass of) with the @a length bytes of @a text, provided they are well formed UTF-8.
+ *  @details The text is validated once, with the vectorized validation of coutf8.h, and a plain @ref String remembers
+ *  that it is valid.
+ *  @returns the new @ref String, or @a NULL with errno set to EILSEQ if @a text is not well formed UTF-8.
+ */
+StringRef newStringWithUTF8Text(const void *const class, const char *const text, UInteger length);
+
+/*!
+ *  @fn bool isStringValidUTF8(const void *const self)
+ *  @relates String
+ *  @brief Returns whether the text of @a self is well formed UTF-8: no overlong forms, surrogates nor code points past U+10FFFF.
+ *  @details A plain @ref String is validated at most once, the result kept in the instance. This and the following UTF-8 methods read bytes and do not apply to the @ref WString classes.
+ */
+bool isStringValidUTF8(const void *const self);
+
+/*!
+ *  @fn UInteger getStringUTF8Length(const void *const self)
+ *  @relates String
+ *  @brief Returns the number of code points of the UTF-8 text of @a self, or @ref NotFound with errno set to EILSEQ if it is not well formed.
+ */
+UInteger getStringUTF8Length(const void *const self);
+
+/*!
+ *  @fn Range rangeOfUTF8CharacterAtIndex(const void *const self, UInteger index)
+ *  @relates String
+ *  @brief Returns the range of the bytes of the code point at @a index of the UTF-8 text of @a self.
+ *  @returns a range whose location is @ref NotFound, with errno set to EILSEQ if the text is not well formed UTF-8 or to EINVAL if it has no code point at @a index.
+ */
+Range rangeOfUTF8CharacterAtIndex(const void *const self, UInteger index);
+
 
 #endif
@@ -14,14 +14,47 @@
 #include <StringObject.h>
 #include <codefinitions.h>
 
+#include <pthread.h>
+
+/* The texts of String instances shorter than this, terminating null byte included, live in the instance itself */
+#define STRING_INLINE_CAPACITY 24
+/* Formatted texts shorter than this are written on the stack before being copied in their String */
+#define STRING_FORMAT_CAPACITY 256
+/* The intern table is split in this many independently locked shards */
+#define STRING_INTERN_SHARDS 64
+
 CO_BEGIN_CLASS_TYPE_DECL(String, Object)
 	const void *text;
 	UInteger length;
 	UInteger _hash;
+	char inlineText[STRING_INLINE_CAPACITY];
+	bool interned;	/* Owned by the intern table: immortal and the only String with its text */
+	unsigned char utf8;	/* A StringUTF8State, kept for plain Strings only as the others may change */
 CO_END_CLASS_TYPE_DECL
 
+enum StringUTF8State {
+	StringUTF8Unknown = 0,
+	StringUTF8Valid,
+	StringUTF8Invalid
+};
+
+/* An open addressed set of interned Strings, probed linearly */
+struct _StringInternShard {
+	pthread_mutex_t lock;
+	struct String **strings;
+	UInteger capacity;	/* A power of two, or 0 */
+	UInteger count;
+	UInteger bytes;
+	UInteger lookups;
+	UInteger hits;
+	char padding[CO_CACHE_LINE_SIZE];
+};
 
 
+
+/* A String of length characters whose text is left for the caller to write, terminating null byte aside */
+struct String * String_newWithLength(UInteger length);
+
 CO_BEGIN_CLASS_DECL(StringClass,Classs)
 	const char * (* getStringText)(const void *const self);
 	UInteger (* getStringLength)(const void *const self);
@@ -36,6 +69,8 @@ CO_BEGIN_CLASS_DECL(StringClass,Classs)
 	SComparisonResult ( *compareWithOptions) (const void *const self, const void *const other, SStringComparingOptions options);
 	
 	StringRef ( * copyStringByTrimmingSpaces ) (const void *const self);
+	
+	Range ( * rangeOfStringWithOptionsInRange ) (const void *const self, const void *const other, SStringComparingOptions options, Range range);
 CO_END_CLASS_DECL
 
 
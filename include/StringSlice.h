@@ -0,0 +1,61 @@
+//
+//  StringSlice.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_StringSlice_h
+#define CObjects_StringSlice_h
+
+#include <coint.h>
+#include <corange.h>
+#include <codefinitions.h>
+
+/*!
+ *  @brief A @ref String that is a range of another one, sharing its text instead of copying it.
+ *  @details Created with @c new(StringSlice, parent, (Range)range, NULL) or @ref newStringSlice(). A slice retains its
+ *  parent, or the parent of its parent when slicing a slice. The text of a mutable parent can change under a slice,
+ *  so other subclasses of @ref String are first copied into a plain @ref String. @ref hash, @ref equals and
+ *  @ref compare give the same results as for a @ref String with the same text, so that slices and strings can be
+ *  used for one another as @ref MutableDictionary keys. @ref copy materializes the slice into a @ref String that no
+ *  longer references the parent.
+ *  @warning The text returned by @ref getStringText() is not null terminated: only @ref getStringLength() bytes of it
+ *  belong to the slice.
+ */
+CO_DECLARE_CLASS(StringSlice)
+
+/*!
+ *  @struct StringSliceArguments
+ *  @relates StringSlice
+ *  @brief The arguments of a @ref StringSlice for @ref newWithArguments().
+ */
+typedef struct _StringSliceArguments {
+	const void *parent;	/*!< The sliced @ref String, must not be @a NULL */
+	Range range;		/*!< The range of @a parent, must lie within it */
+} StringSliceArguments;
+
+/*!
+ *  @fn StringRef newStringSlice(const void *const string, Range range)
+ *  @relates StringSlice
+ *  @brief Returns a new @ref StringSlice of @a range of @a string.
+ *  @return @a NULL, with errno set to EINVAL, if @a range goes past the end of @a string.
+ */
+StringRef newStringSlice(const void *const string, Range range);
+
+/*!
+ *  @fn StringRef getStringSliceParent(const void *const self)
+ *  @relates StringSlice
+ *  @brief Returns the @ref String whose text @a self shares.
+ */
+StringRef getStringSliceParent(const void *const self);
+
+/*!
+ *  @fn Range getStringSliceRange(const void *const self)
+ *  @relates StringSlice
+ *  @brief Returns the range of the parent of @a self that @a self spans.
+ */
+Range getStringSliceRange(const void *const self);
+
+#endif
@@ -0,0 +1,26 @@
+//
+//  StringSlice.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_StringSlice_r
+#define CObjects_StringSlice_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <StringObject.r>
+
+CO_BEGIN_CLASS_TYPE_DECL(StringSlice,String)
+	StringRef parent;
+	Range range;
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(StringSliceClass,StringClass)
+	StringRef ( * getStringSliceParent ) (const void *const self);
+	Range ( * getStringSliceRange ) (const void *const self);
+CO_END_CLASS_DECL
+
+#endif
@@ -0,0 +1,71 @@
+//
+//  StringTokenizer.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_StringTokenizer_h
+#define CObjects_StringTokenizer_h
+
+#include <Object.h>
+#include <Collection.h>
+#include <Vector.h>
+
+/*!
+ *  @brief A @ref Collection of the fields of a @ref String, separated by a string or by any of a set of characters.
+ *  @details Created with @c new(StringTokenizer, string, separator, NULL) or @ref newStringTokenizer() and
+ *  @ref newStringTokenizerWithCharacters(). The fields are found while enumerating, with @ref foreach_start or
+ *  @ref enumerateWithState(), a batch at a time: no array of them is ever built. Each field is a @ref StringSlice of the
+ *  string, empty fields included, as @ref componentsSeparatedByString() would return them. A field belongs to the
+ *  tokenizer and is only valid until the next batch: retain it to keep it, the tokenizer then leaves it alone. Fields
+ *  nobody retained are re-pointed at the next ones instead of being allocated again. A tokenizer is enumerated by one
+ *  enumeration at a time. @ref getCollectionCount() counts the fields without creating any.
+ */
+CO_DECLARE_CLASS(StringTokenizer)
+
+/*!
+ *  @struct StringTokenizerArguments
+ *  @relates StringTokenizer
+ *  @brief The arguments of a @ref StringTokenizer for @ref newWithArguments().
+ */
+typedef struct _StringTokenizerArguments {
+	const void *string;		/*!< The tokenized @ref String, must not be @a NULL */
+	const void *separator;	/*!< The @ref String separating the fields, or @a NULL to use @a characters */
+	const char *characters;	/*!< The null terminated characters any of which separates the fields when @a separator is @a NULL */
+} StringTokenizerArguments;
+
+/*!
+ *  @fn StringTokenizerRef newStringTokenizer(const void *const string, const void *const separator)
+ *  @relates StringTokenizer
+ *  @brief Returns a new @ref StringTokenizer of the fields of @a string separated by @a separator.
+ */
+StringTokenizerRef newStringTokenizer(const void *const string, const void *const separator);
+
+/*!
+ *  @fn StringTokenizerRef newStringTokenizerWithCharacters(const void *const string, const char *const characters)
+ *  @relates StringTokenizer
+ *  @brief Returns a new @ref StringTokenizer of the fields of @a string separated by any of the bytes of @a characters.
+ */
+StringTokenizerRef newStringTokenizerWithCharacters(const void *const string, const char *const characters);
+
+/*!
+ *  @fn VectorRef componentsSeparatedByString(const void *const self, const void *const separator)
+ *  @relates String
+ *  @brief Returns a new @ref Vector of the fields of @a self separated by @a separator.
+ *  @details The fields are @ref StringSlice instances sharing the text of @a self, which is copied once beforehand if
+ *  it is neither a @ref String nor a @ref StringSlice. Adjacent separators, or one at either end, delimit empty fields,
+ *  so there is always one more field than occurrences of @a separator. An empty @a separator separates nothing.
+ */
+VectorRef componentsSeparatedByString(const void *const self, const void *const separator);
+
+/*!
+ *  @fn VectorRef componentsSeparatedByCharacters(const void *const self, const char *const characters)
+ *  @relates String
+ *  @brief Returns a new @ref Vector of the fields of @a self separated by any of the bytes of the null terminated
+ *  @a characters, as @ref componentsSeparatedByString() does for a string.
+ */
+VectorRef componentsSeparatedByCharacters(const void *const self, const char *const characters);
+
+#endif
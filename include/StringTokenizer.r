@@ -0,0 +1,39 @@
+//
+//  StringTokenizer.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_StringTokenizer_r
+#define CObjects_StringTokenizer_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Collection.r>
+
+/* The fields handed out by one call to enumerateWithState */
+#define STRING_TOKENIZER_BATCH 16
+
+/* What separates the fields: the text of a string, or any byte set in characters */
+struct _StringTokenizerSeparator {
+	const char *text;				/* NULL for a set of characters */
+	UInteger length;				/* 1 for a set of characters */
+	unsigned char characters[32];	/* A bit per byte value */
+	char character;					/* The text of a set of a single character */
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(StringTokenizer,Collection)
+	StringRef root;					/* The plain String whose text the fields are slices of */
+	Range range;					/* The range of root that is tokenized */
+	StringRef separatorString;
+	struct _StringTokenizerSeparator separator;
+	UInteger mutations;				/* Never changes, for foreach */
+	StringRef fields[STRING_TOKENIZER_BATCH];
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(StringTokenizerClass,CollectionClass)
+CO_END_CLASS_DECL
+
+#endif
@@ -10,11 +10,75 @@
 #define CObjects_Thread_h
 
 #include <pthread.h>
+#include <coint.h>
 
 CO_DECLARE_CLASS(Thread)
 
+/*! The number of processors a @ref ThreadAttributes affinity can name. */
+#define THREAD_AFFINITY_PROCESSORS 1024
+/*! The number of bytes of a thread name, the terminating null byte included; longer names are truncated. */
+#define THREAD_NAME_LENGTH 16
+
+/*!
+ *  @struct ThreadAttributes
+ *  @relates Thread
+ *  @brief How a @ref Thread is started. A zeroed structure starts it like @ref pthread_create() does by default.
+ */
+typedef struct _ThreadAttributes {
+	UInteger affinity[THREAD_AFFINITY_PROCESSORS / (8 * sizeof(UInteger))];	/*!< The processors the thread may run on, see @ref ThreadAttributesAddProcessor(); none means any */
+	UInteger stackSize;			/*!< The stack size in bytes, 0 for the default one */
+	const char *name;			/*!< The name shown by @a top or @a perf, can be @a NULL */
+	bool explicitScheduling;	/*!< Whether @a schedulingPolicy and @a schedulingPriority apply, otherwise the scheduling of the creating thread is inherited */
+	int schedulingPolicy;		/*!< @a SCHED_OTHER, @a SCHED_FIFO or @a SCHED_RR */
+	int schedulingPriority;		/*!< The static priority, 0 for @a SCHED_OTHER */
+	bool detached;				/*!< Whether the thread is started detached, in which case it cannot be joined */
+} ThreadAttributes;
+
+/*!
+ *  @struct ThreadArguments
+ *  @relates Thread
+ *  @brief The arguments of a @ref Thread for @ref newWithArguments().
+ */
+typedef struct _ThreadArguments {
+	void *(*function)(void *);				/*!< The start function, must not be @a NULL */
+	void *argument;							/*!< The argument of @a function */
+	const ThreadAttributes *attributes;		/*!< Copied, can be @a NULL for the default attributes */
+} ThreadArguments;
+
+/*!
+ *  @fn void ThreadAttributesAddProcessor(ThreadAttributes *const attributes, UInteger processor)
+ *  @relates Thread
+ *  @brief Adds @a processor to the processors a thread started with @a attributes may run on.
+ */
+void ThreadAttributesAddProcessor(ThreadAttributes *const attributes, UInteger processor);
+
+/*!
+ *  @fn void startThread(const void *const self)
+ *  @relates Thread
+ *  @brief Starts @a self with its attributes.
+ *  @details On failure errno is set to the error of @a pthread_create(), for instance EPERM for a real time policy the
+ *  process may not use, or EINVAL for an affinity without any online processor. Affinities are only supported on Linux,
+ *  elsewhere starting a thread with one fails with ENOTSUP.
+ */
 void startThread(const void *const self);
 void joinThread(const void *const self, void **exit);
 pthread_t * getPthread(const void *const self);
 
+/*!
+ *  @fn bool pinThreadToProcessor(void *const self, UInteger processor)
+ *  @relates Thread
+ *  @brief Restricts @a self to @a processor, right away if it is running or when it starts otherwise.
+ *  @return NO, with errno set, if the affinity could not be changed, ENOTSUP outside Linux.
+ */
+bool pinThreadToProcessor(void *const self, UInteger processor);
+
+/*!
+ *  @fn bool pinThreadsToProcessors(const void *const threads, UInteger firstProcessor)
+ *  @relates Thread
+ *  @brief Pins the @ref Thread objects of the @ref Array @a threads one per processor, the first one to
+ *  @a firstProcessor and the next ones to the following processors, wrapping around the online processors.
+ *  @return NO, with errno set, as soon as one of them could not be pinned.
+ */
+bool pinThreadsToProcessors(const void *const threads, UInteger firstProcessor);
+
 #endif
@@ -19,12 +19,16 @@ CO_BEGIN_CLASS_TYPE_DECL(Thread,Object)
 	voidf threadFunction;
 	void * threadArgument;
 	pthread_t thread;
+	ThreadAttributes attributes;
+	char name[THREAD_NAME_LENGTH];
+	bool started;
 CO_END_CLASS_TYPE_DECL
 
 CO_BEGIN_CLASS_DECL(ThreadClass,Classs)
 	void ( *startThread ) (const void *const self);
 	void ( * joinThread ) (const void *const self, void **exit);
 	pthread_t * ( * getPthread ) (const void *const self);
+	bool ( * pinThreadToProcessor ) (void *const self, UInteger processor);
 CO_END_CLASS_DECL
 
 
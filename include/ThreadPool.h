@@ -0,0 +1,141 @@
+//
+//  ThreadPool.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ThreadPool_h
+#define CObjects_ThreadPool_h
+
+#include <coint.h>
+#include <corange.h>
+#include <codefinitions.h>
+
+/*!
+ *  @brief A fixed set of worker @ref Thread objects running submitted tasks.
+ *  @details Created with @c new(ThreadPool, (UInteger)workerCount, NULL), zero meaning one worker per online processor.
+ *  Every worker owns a deque of tasks: it runs the last task pushed on it and, when it has nothing left, steals the
+ *  oldest task of another worker. Tasks submitted from a worker go to its own deque, the others are spread round robin.
+ *  Idle workers sleep until a task is submitted. Each worker runs its tasks inside an @ref AutoreleasePool drained after
+ *  every task.
+ *  @warning The number of workers is fixed at creation: the pool neither adds workers under load nor retires idle
+ *  ones. The deques are not lock free: each one is guarded by a mutex, taken by its worker and by thieves alike. They
+ *  are not @ref WorkStealingDeque objects, which hold retained objects, because a task is a function and an argument
+ *  and making it an object would cost an allocation per task.
+ */
+CO_DECLARE_CLASS(ThreadPool)
+
+/*! A task: called once, on one of the workers, with the argument it was submitted with. */
+typedef void (*ThreadPoolFunction)(void *argument);
+
+/*!
+ *  @fn bool submitTask(void *const self, ThreadPoolFunction function, void *const argument)
+ *  @relates ThreadPool
+ *  @brief Schedules @a function to be called with @a argument on one of the workers of @a self.
+ *  @return NO, with errno set to ECANCELED, if @a self is being shut down and the caller is not one of its workers.
+ */
+bool submitTask(void *const self, ThreadPoolFunction function, void *const argument);
+
+/*!
+ *  @fn void waitForTasks(void *const self)
+ *  @relates ThreadPool
+ *  @brief Returns once every task submitted to @a self, including those submitted by tasks, has run.
+ *  @details Must not be called from a task of @a self.
+ */
+void waitForTasks(void *const self);
+
+/*!
+ *  @fn void shutdownThreadPool(void *const self)
+ *  @relates ThreadPool
+ *  @brief Refuses new tasks from outside @a self, runs the pending ones and joins the workers.
+ *  @details Releasing a @ref ThreadPool shuts it down first.
+ */
+void shutdownThreadPool(void *const self);
+
+/*!
+ *  @fn UInteger getThreadPoolWorkerCount(const void *const self)
+ *  @relates ThreadPool
+ *  @brief Returns the number of workers of @a self.
+ */
+UInteger getThreadPoolWorkerCount(const void *const self);
+
+/*!
+ *  @fn UInteger getThreadPoolPendingTaskCount(const void *const self)
+ *  @relates ThreadPool
+ *  @brief Returns the number of tasks queued in the deques of @a self and not yet started.
+ */
+UInteger getThreadPoolPendingTaskCount(const void *const self);
+
+/*!
+ *  @fn UInteger getThreadPoolCompletedTaskCount(const void *const self)
+ *  @relates ThreadPool
+ *  @brief Returns the number of tasks @a self has run so far.
+ */
+UInteger getThreadPoolCompletedTaskCount(const void *const self);
+
+/*!
+ *  @fn UInteger getThreadPoolStolenTaskCount(const void *const self)
+ *  @relates ThreadPool
+ *  @brief Returns the number of tasks run by another worker than the one whose deque they were pushed on.
+ */
+UInteger getThreadPoolStolenTaskCount(const void *const self);
+
+/*!
+ *  @enum ThreadPoolParallelOptions
+ *  @brief How the parallel algorithms of a @ref ThreadPool split their index range.
+ *  @relates ThreadPool
+ */
+enum ThreadPoolParallelOptions {
+	ThreadPoolParallelAdaptive =	0,		/*!< Chunks shrink as the range runs out, partial results are combined as workers finish. */
+	ThreadPoolParallelOrdered =		(1<<0),	/*!< Chunks do not depend on the workers nor on timing, partial results are combined from left to right. */
+};
+/*!
+ *  @typedef enum ThreadPoolParallelOptions ThreadPoolParallelOptions;
+ */
+typedef enum ThreadPoolParallelOptions ThreadPoolParallelOptions;
+
+/*! Called with a range of indexes of the collection given to @ref parallelForRange(). */
+typedef void (*ParallelRangeFunction)(const void *const collection, Range range, void *context);
+/*! Called for each object given to @ref parallelMapIntoVector(). Returns an object the caller does not own, or @a NULL to drop it. */
+typedef ObjectRef (*ParallelMapFunction)(ObjectRef object, void *context);
+/*! Folds an object given to @ref parallelReduce() into an accumulator. */
+typedef void (*ParallelReduceFunction)(void *accumulator, ObjectRef object, void *context);
+/*! Folds a partial accumulator of @ref parallelReduce() into another one. */
+typedef void (*ParallelCombineFunction)(void *accumulator, const void *partial, void *context);
+
+/*!
+ *  @fn bool parallelForRange(void *const self, const void *const collection, ParallelRangeFunction function, void *const context, ThreadPoolParallelOptions options)
+ *  @relates ThreadPool
+ *  @brief Calls @a function on disjoint ranges covering the indexes of the @ref Array @a collection, on the workers of @a self.
+ *  @details Returns once every range has been processed. Each participating thread runs the ranges inside its own
+ *  @ref AutoreleasePool, drained after every range. Called from a worker of @a self, the worker takes part in the work.
+ *  @return NO, with errno set, if the work could not be scheduled.
+ */
+bool parallelForRange(void *const self, const void *const collection, ParallelRangeFunction function, void *const context, ThreadPoolParallelOptions options);
+
+/*!
+ *  @fn bool parallelMapIntoVector(void *const self, const void *const collection, void *const vector, ParallelMapFunction function, void *const context, ThreadPoolParallelOptions options)
+ *  @relates ThreadPool
+ *  @brief Appends to the @ref MutableArray @a vector the result of @a function on every object of @a collection.
+ *  @details The results keep the order of their objects whatever the options; those which are @a NULL are skipped, so
+ *  that @a function can filter. @a vector is only modified by the calling thread, once every result is known. The
+ *  objects of @a collection are gathered with one fast enumeration before the work starts, so that a list is not
+ *  walked for every index.
+ */
+bool parallelMapIntoVector(void *const self, const void *const collection, void *const vector, ParallelMapFunction function, void *const context, ThreadPoolParallelOptions options);
+
+/*!
+ *  @fn bool parallelReduce(void *const self, const void *const collection, void *const result, UInteger resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *const context, ThreadPoolParallelOptions options)
+ *  @relates ThreadPool
+ *  @brief Folds every object of @a collection into the @a resultSize bytes of @a result.
+ *  @details @a result holds the identity of @a combine on entry: each partial accumulator starts as a copy of it, is
+ *  passed to @a reduce with the objects of its chunk and is then combined into @a result. With
+ *  @ref ThreadPoolParallelOrdered the partials are those of fixed chunks combined in index order, so that the result is
+ *  the same from one run to the other even when @a combine is not associative, as with floating point sums. The
+ *  objects are gathered as for @ref parallelMapIntoVector().
+ */
+bool parallelReduce(void *const self, const void *const collection, void *const result, UInteger resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *const context, ThreadPoolParallelOptions options);
+
+#endif
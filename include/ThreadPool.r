@@ -0,0 +1,67 @@
+//
+//  ThreadPool.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_ThreadPool_r
+#define CObjects_ThreadPool_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <pthread.h>
+
+struct _ThreadPoolTask {
+	ThreadPoolFunction function;
+	void *argument;
+};
+
+/* A worker and its deque: the worker pushes and pops at bottom, thieves take at top, all under lock */
+struct _ThreadPoolWorker {
+	struct ThreadPool *pool;
+	ThreadRef thread;
+	UInteger index;
+	pthread_mutex_t lock;
+	struct _ThreadPoolTask *tasks;
+	UInteger mask;
+	UInteger top;
+	UInteger bottom;
+	/* Written by the worker only */
+	UInteger completed;
+	UInteger stolen;
+	char padding[CO_CACHE_LINE_SIZE];
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(ThreadPool,Object)
+	struct _ThreadPoolWorker *workers;
+	UInteger workerCount;
+	UInteger nextWorker;
+	char countersPadding[CO_CACHE_LINE_SIZE];
+	/* Tasks in the deques, and tasks submitted but not run to completion yet */
+	UInteger pending;
+	UInteger unfinished;
+	UInteger idleWorkers;
+	bool shuttingDown;
+	bool stopping;
+	/* Parking of the idle workers and of the threads waiting for the tasks */
+	pthread_mutex_t parking;
+	pthread_cond_t work;
+	pthread_cond_t finished;
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(ThreadPoolClass,Classs)
+	bool (* submitTask) (void *const self, ThreadPoolFunction function, void *const argument);
+	void (* waitForTasks) (void *const self);
+	void (* shutdownThreadPool) (void *const self);
+	UInteger (* getThreadPoolWorkerCount) (const void *const self);
+	UInteger (* getThreadPoolPendingTaskCount) (const void *const self);
+	UInteger (* getThreadPoolCompletedTaskCount) (const void *const self);
+	UInteger (* getThreadPoolStolenTaskCount) (const void *const self);
+	bool (* parallelForRange) (void *const self, const void *const collection, ParallelRangeFunction function, void *const context, ThreadPoolParallelOptions options);
+	bool (* parallelMapIntoVector) (void *const self, const void *const collection, void *const vector, ParallelMapFunction function, void *const context, ThreadPoolParallelOptions options);
+	bool (* parallelReduce) (void *const self, const void *const collection, void *const result, UInteger resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *const context, ThreadPoolParallelOptions options);
+CO_END_CLASS_DECL
+
+#endif
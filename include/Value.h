@@ -11,6 +11,16 @@
 
 CO_DECLARE_CLASS(Value)
 
+/*!
+ *  @struct ValueArguments
+ *  @relates Value
+ *  @brief The arguments of a @ref Value for @ref newWithArguments().
+ */
+typedef struct _ValueArguments {
+	const void *pointer;			/*!< The wrapped pointer, must not be @a NULL */
+	void *(*cleanup)(void *);	/*!< Called with @a pointer when the value is destroyed, can be @a NULL */
+} ValueArguments;
+
 void *getValuePointer(const void *const self);
 void setValuePointer(void *const self, const void *const pointer);
 
@@ -16,4 +16,8 @@ CO_DECLARE_CLASS(WString)
 
 const wchar_t *getWText(const void *const self);
 
+/* Creates a new instance of class, WString or a subclass of, with the length bytes of the UTF-8 text; returns NULL
+ * with errno set to EILSEQ if they are not well formed UTF-8. The conversion does not depend on the locale. */
+WStringRef newWStringWithUTF8Text(const void *const class, const char *const text, UInteger length);
+
 #endif
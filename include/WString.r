@@ -11,6 +11,7 @@
 
 #include <StringObject.h>
 #include <StringObject.r>
+#include <wchar.h>
 
 CO_BEGIN_CLASS_TYPE_DECL(WString,String)
 CO_END_CLASS_TYPE_DECL
@@ -18,4 +19,12 @@ CO_END_CLASS_TYPE_DECL
 CO_BEGIN_CLASS_DECL(WStringClass,StringClass)
 CO_END_CLASS_DECL
 
+/* The wide text of the WString classes is UTF-32 where wchar_t holds every code point, UTF-16 elsewhere */
+
+/* A String of the UTF-8 of the length characters of text, NULL with errno set to EILSEQ if they are malformed */
+StringRef WString_newUTF8Description(const wchar_t *text, UInteger length);
+
+/* Decodes the length bytes of UTF-8 text to output, which has room for length characters; returns the characters written or NotFound */
+UInteger WString_decodeUTF8(const char *text, UInteger length, wchar_t *output);
+
 #endif
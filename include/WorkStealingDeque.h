@@ -0,0 +1,51 @@
+//
+//  WorkStealingDeque.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_WorkStealingDeque_h
+#define CObjects_WorkStealingDeque_h
+
+#include <Collection.h>
+
+/*!
+ *  @brief A Chase–Lev work-stealing deque of objects.
+ *  @details Created with @c new(WorkStealingDeque, (UInteger)capacity, NULL), the capacity being rounded up to a power of
+ *  two and doubled whenever the deque is full. One thread, the owner, pushes and pops at the bottom, LIFO; any other
+ *  thread steals from the top, FIFO. The owner only needs an atomic read-modify-write to take the last object,
+ *  thieves need one per steal. Pushing retains the object, popping and stealing hand the reference over to the caller.
+ *  getCollectionCount() is a snapshot that may already be stale when it returns. firstObject() is the oldest object
+ *  and lastObject() the newest. They, containsObject() and fast enumeration, oldest first, read the buffer in place:
+ *  only the owner thread may use them, and only while no thief runs, since a thief may release what it stole. new returns @a NULL, with errno set to
+ *  EINVAL, for a capacity too large to be rounded up and allocated.
+ */
+CO_DECLARE_CLASS(WorkStealingDeque)
+
+/*!
+ *  @fn bool pushDequeObject(void *const self, void *const object)
+ *  @relates WorkStealingDeque
+ *  @brief Pushes @a object at the bottom of @a self. Only for the owner thread.
+ *  @return YES if @a object was pushed, NO with errno set to ENOMEM if a full deque could not grow, leaving it unchanged.
+ */
+bool pushDequeObject(void *const self, void *const object);
+
+/*!
+ *  @fn ObjectRef popDequeObject(void *const self)
+ *  @relates WorkStealingDeque
+ *  @brief Pops the object at the bottom of @a self, the last one pushed. Only for the owner thread.
+ *  @return the object, which the caller must release, or NULL if @a self is empty.
+ */
+ObjectRef popDequeObject(void *const self);
+
+/*!
+ *  @fn ObjectRef stealDequeObject(void *const self)
+ *  @relates WorkStealingDeque
+ *  @brief Takes the object at the top of @a self, the oldest one. For any thread but the owner.
+ *  @return the object, which the caller must release, or NULL if @a self is empty or another thread took the object first.
+ */
+ObjectRef stealDequeObject(void *const self);
+
+#endif
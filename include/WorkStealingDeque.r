@@ -0,0 +1,41 @@
+//
+//  WorkStealingDeque.r
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_WorkStealingDeque_r
+#define CObjects_WorkStealingDeque_r
+
+#include <cobj.h>
+#include <Object.r>
+#include <Collection.h>
+#include <Collection.r>
+
+/* A circular buffer of objects. Replaced buffers stay reachable through previous, thieves may still read them. */
+struct _WorkStealingBuffer {
+	Integer mask;
+	struct _WorkStealingBuffer *previous;
+	void *objects[];
+};
+
+CO_BEGIN_CLASS_TYPE_DECL(WorkStealingDeque,Collection)
+	char topPadding[CO_CACHE_LINE_SIZE];
+	/* Advanced by thieves and by the owner taking the last object */
+	Integer top;
+	char bottomPadding[CO_CACHE_LINE_SIZE];
+	/* Written by the owner only */
+	Integer bottom;
+	struct _WorkStealingBuffer *buffer;
+	char endPadding[CO_CACHE_LINE_SIZE];
+CO_END_CLASS_TYPE_DECL
+
+CO_BEGIN_CLASS_DECL(WorkStealingDequeClass,CollectionClass)
+	bool (* pushDequeObject) (void *const self, void *const object);
+	ObjectRef (* popDequeObject) (void *const self);
+	ObjectRef (* stealDequeObject) (void *const self);
+CO_END_CLASS_DECL
+
+#endif
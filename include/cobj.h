@@ -26,6 +26,7 @@
 #include <new.h>
 #include <coexception.h>
 #include <StringObject.h>
+#include <StringSlice.h>
 #include <WString.h>
 #include <Array.h>
 #include <MutableArray.h>
@@ -36,9 +37,19 @@
 #include <Thread.h>
 #include <Buffer.h>
 #include <Vector.h>
+#include <StringTokenizer.h>
 #include <MutableString.h>
+#include <Rope.h>
 #include <WMutableString.h>
 #include <ConcurrentMutableArray.h>
+#include <ReadMostlyMutableArray.h>
+#include <Queue.h>
+#include <ConcurrentQueue.h>
+#include <WorkStealingDeque.h>
+#include <SPSCQueue.h>
 #include <AutoreleasePool.h>
+#include <ThreadPool.h>
+#include <Future.h>
+#include <Promise.h>
 
 #endif
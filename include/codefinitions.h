@@ -21,6 +21,24 @@
 #define CO_DESTRUCTOR __attribute__ ((destructor))
 #endif
 
+/* The cache line size assumed to keep fields written by different threads apart */
+#if !defined(CO_CACHE_LINE_SIZE)
+#define CO_CACHE_LINE_SIZE 64
+#endif
+
+/* Class initialization mode.
+ * By default every class is built at load time and released at exit.
+ * Building the library with CO_LAZY_CLASS_INIT defined builds each class, once and thread safely, on the first new of it
+ * and keeps it until exit. Until then its class variable points to a placeholder recognized by new. */
+#if defined(CO_LAZY_CLASS_INIT)
+#include <pthread.h>
+#define CO_CLASS_INIT_ATTRIBUTE
+#define CO_CLASS_DEALLOC_ATTRIBUTE
+#else
+#define CO_CLASS_INIT_ATTRIBUTE CO_CONSTRUCTOR
+#define CO_CLASS_DEALLOC_ATTRIBUTE CO_DESTRUCTOR
+#endif
+
 
 /* Declare a class */
 #if !defined(CO_DECLARE_CLASS)
@@ -37,14 +55,63 @@ typedef void * class##Ref; \
 *  @brief A function that initializes @ref class and @ref class##Class. \
 *  @details This function must be called once, before any instanciation of @ref String instance occur. \
 */ \
-void init##class() CO_CONSTRUCTOR; \
+void init##class() CO_CLASS_INIT_ATTRIBUTE; \
 /*! \
 *  @fn void dealloc##class() \
 *  @relates class \
 *  @brief A function that deallocates any memory used by @ref init##class() counterpart. \
 *  @details This function must be called once, after any instanciation of @ref class instances. After calling this method, instanciating a @ref class will terminate the application. \
 */ \
-void dealloc##class() CO_DESTRUCTOR;
+void dealloc##class() CO_CLASS_DEALLOC_ATTRIBUTE;
+#endif
+
+/* Define the class variables of a class */
+#if !defined(CO_CLASS_STORAGE_DECL)
+#if defined(CO_LAZY_CLASS_INIT)
+#define CO_CLASS_STORAGE_DECL(type) \
+static const struct COLazyClass type##Lazy = { .isa.class = &LazyClassTable, .initialize = init##type, .class = &type }; \
+const void * type = &type##Lazy; \
+const void * type##Class = NULL;
+#else
+#define CO_CLASS_STORAGE_DECL(type) \
+const void * type = NULL; \
+const void * type##Class = NULL;
+#endif
+#endif
+
+/* Define the init function of a class, followed by its body */
+#if !defined(CO_CLASS_INIT_DECL)
+#if defined(CO_LAZY_CLASS_INIT)
+#define CO_CLASS_INIT_DECL(type) \
+static void build##type(void); \
+void init##type() { \
+	static pthread_once_t once = PTHREAD_ONCE_INIT; \
+	pthread_once(&once, build##type); \
+} \
+static void build##type(void)
+#else
+#define CO_CLASS_INIT_DECL(type) \
+void init##type()
+#endif
+#endif
+
+/* Whether a class variable still has to be built */
+#if !defined(CO_CLASS_PENDING)
+#if defined(CO_LAZY_CLASS_INIT)
+#define CO_CLASS_PENDING(type) ( ! (type) || COClassIsLazy(type) )
+#else
+#define CO_CLASS_PENDING(type) ( ! (type) )
+#endif
+#endif
+
+/* Assign a built class to its class variable. In the CO_LAZY_CLASS_INIT mode other threads read the variable without
+ * waiting for the init function, so the class is published with a release store */
+#if !defined(CO_CLASS_PUBLISH)
+#if defined(CO_LAZY_CLASS_INIT)
+#define CO_CLASS_PUBLISH(type,class) __atomic_store_n(&(type), (class), __ATOMIC_RELEASE)
+#else
+#define CO_CLASS_PUBLISH(type,class) ((type) = (class))
+#endif
 #endif
 
 /* Declare the class structure */
@@ -74,14 +141,13 @@ struct class { \
 /* Declare internal class */
 #if !defined(CO_CLASS_TYPE_INTERNAL_DECL_DEALLOC)
 #define CO_CLASS_TYPE_INTERNAL_DECL_DEALLOC(class,superclass,super,classOverrides,instanceOverrides,...) \
-const void * class = NULL; \
-const void * class##Class = NULL; \
-void init##class() { \
+CO_CLASS_STORAGE_DECL(class) \
+CO_CLASS_INIT_DECL(class) { \
 	if ( ! class##Class ) { \
 		class##Class = new(superclass, #class "Class", superclass, sizeof(struct class##Class), classOverrides, NULL); \
 	} \
-	if ( ! class ) { \
-		class = new(class##Class, #class, super, sizeof(struct class), instanceOverrides, NULL); \
+	if ( CO_CLASS_PENDING(class) ) { \
+		CO_CLASS_PUBLISH(class, new(class##Class, #class, super, sizeof(struct class), instanceOverrides, NULL)); \
 	} \
 } \
 void dealloc##class() { \
@@ -99,15 +165,14 @@ void dealloc##class() { \
 
 #if !defined(CO_CLASS_TYPE_INTERNAL_DECL_INIT)
 #define CO_CLASS_TYPE_INTERNAL_DECL_INIT(class,superclass,super,classOverrides,instanceOverrides,initcalls,...) \
-const void * class = NULL; \
-const void * class##Class = NULL; \
-void init##class() { \
+CO_CLASS_STORAGE_DECL(class) \
+CO_CLASS_INIT_DECL(class) { \
 	initcalls; \
 	if ( ! class##Class ) { \
 		class##Class = new(superclass, #class "Class", superclass, sizeof(struct class##Class), classOverrides, NULL); \
 	} \
-	if ( ! class ) { \
-		class = new(class##Class, #class, super, sizeof(struct class), instanceOverrides, NULL); \
+	if ( CO_CLASS_PENDING(class) ) { \
+		CO_CLASS_PUBLISH(class, new(class##Class, #class, super, sizeof(struct class), instanceOverrides, NULL)); \
 	} \
 } \
 void dealloc##class() { \
@@ -123,6 +188,45 @@ void dealloc##class() { \
 }
 #endif
 
+/* Declare the static tables of a class, in its .r */
+#if !defined(CO_DECLARE_STATIC_CLASS_TABLES)
+#define CO_DECLARE_STATIC_CLASS_TABLES(type,superclass) \
+extern const superclass##Layout type##ClassTable; \
+extern const struct type##Class type##Table;
+#endif
+
+/* Define internal class as static, fully initialized, tables. Nothing is allocated nor scanned at load time.
+ * Only Collection and Array are defined this way: a static table lists every inherited method itself, so the classes
+ * whose ancestors' methods are private to their files are still built by their init functions (about 10us at load
+ * time in total, see bench/benchStartup.c).
+ * The superclass (the class of class##Class) must define superclass##Layout and superclass##Root, and so must type##Class.
+ * instanceOverrides are designated initializers of the struct type##Class table, e.g. type##ClassRoot.copy = type##_copy */
+#if !defined(CO_CLASS_TYPE_STATIC_DECL)
+#define CO_CLASS_TYPE_STATIC_DECL(type,superclass,supertype,classConstructor,instanceOverrides) \
+const superclass##Layout type##ClassTable = { \
+	superclass##Root.isa.class = (const struct Classs *)&superclass##Table, \
+	superclass##Root.class_name = #type "Class", \
+	superclass##Root.super = (const struct Classs *)&superclass##Table, \
+	superclass##Root.size = sizeof(struct type##Class), \
+	CO_CLASS_METHODS(superclass##Root), \
+	superclass##Root.constructor = classConstructor \
+}; \
+const struct type##Class type##Table = { \
+	type##ClassRoot.isa.class = (const struct Classs *)&type##ClassTable, \
+	type##ClassRoot.class_name = #type, \
+	type##ClassRoot.super = (const struct Classs *)&supertype##Table, \
+	type##ClassRoot.size = sizeof(struct type), \
+	CO_OBJECT_METHODS(type##ClassRoot), \
+	instanceOverrides \
+}; \
+const void * type = &type##Table; \
+const void * type##Class = &type##ClassTable; \
+void init##type() { \
+} \
+void dealloc##type() { \
+}
+#endif
+
 #if !defined(CO_OVVERRIDE)
 #define CO_OVERRIDE(...) __VA_ARGS__
 #endif
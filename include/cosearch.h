@@ -0,0 +1,34 @@
+//
+//  cosearch.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+/*!
+ *  @file cosearch.h
+ *  @brief Substring search and comparison over byte buffers.
+ *  @details The searches behind @ref rangeOfStringWithOptionsInRange(). Neither the haystack nor the needle need be
+ *  null terminated. Needles are filtered on their first and last bytes 16 (SSE2) or 32 (AVX2, when the processor has
+ *  it) positions at a time; long needles are searched forwards with the Two-Way algorithm, which is linear in the worst
+ *  case. Case-insensitive searches fold ASCII letters only, whatever the locale. Each function returns the first (or
+ *  last, backwards) occurrence of the needle in the haystack or @a NULL. An empty needle is never found.
+ *  @ref COCompareCaseInsensitive() is the case-insensitive comparison of @ref compareWithOptions(), folding 16 or 32
+ *  bytes at a time; null bytes are compared as any other.
+ */
+
+#ifndef CObjects_cosearch_h
+#define CObjects_cosearch_h
+
+#include <coint.h>
+
+const char * COSearchForward(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength);
+const char * COSearchBackward(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength);
+const char * COSearchForwardCaseInsensitive(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength);
+const char * COSearchBackwardCaseInsensitive(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength);
+
+/* The difference of the first bytes of text and other to differ once ASCII letters are folded, or 0 */
+int COCompareCaseInsensitive(const char *text, const char *other, UInteger length);
+
+#endif
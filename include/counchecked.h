@@ -0,0 +1,124 @@
+//
+//  counchecked.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#ifndef CObjects_counchecked_h
+#define CObjects_counchecked_h
+
+/* Unchecked dispatch.
+ * Each function below is the unchecked counterpart of the public method of the same name: it reads the class of
+ * its receiver and calls the method slot directly. There is no NULL receiver, class or method check, no errno and
+ * no assert, so the receiver must be a valid instance whose class implements the method. Meant for tight loops
+ * over objects already known to be valid. */
+
+#include <Object.h>
+#include <Object.r>
+#include <Collection.h>
+#include <Collection.r>
+#include <Array.h>
+#include <Array.r>
+#include <StringObject.h>
+#include <StringObject.r>
+
+/* Object */
+
+static inline const void * uncheckedClassOf (const void *const self) {
+	return ((const struct Object *)self)->class;
+}
+
+static inline void * uncheckedRetain (void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->retain(self);
+}
+
+static inline void uncheckedRelease (void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	class->release(self);
+}
+
+static inline UInteger uncheckedRetainCount (const void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->retainCount(self);
+}
+
+static inline void * uncheckedAutorelease (void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->autorelease(self);
+}
+
+static inline UInteger uncheckedHash (const void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->hash(self);
+}
+
+static inline bool uncheckedEquals (const void *const self, const void *const other) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->equals(self, other);
+}
+
+static inline void * uncheckedCopy (const void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->copy(self);
+}
+
+static inline void * uncheckedCopyDescription (const void *const self) {
+	const struct Classs *const class = uncheckedClassOf(self);
+	return class->copyDescription(self);
+}
+
+/* Collection */
+
+static inline UInteger uncheckedGetCollectionCount (const void *const self) {
+	const struct CollectionClass *const class = uncheckedClassOf(self);
+	return class->getCollectionCount(self);
+}
+
+static inline void * uncheckedFirstObject (const void *const self) {
+	const struct CollectionClass *const class = uncheckedClassOf(self);
+	return class->firstObject(self);
+}
+
+static inline void * uncheckedLastObject (const void *const self) {
+	const struct CollectionClass *const class = uncheckedClassOf(self);
+	return class->lastObject(self);
+}
+
+static inline bool uncheckedContainsObject (const void *const self, const void *const object) {
+	const struct CollectionClass *const class = uncheckedClassOf(self);
+	return class->containsObject(self, object);
+}
+
+static inline UInteger uncheckedEnumerateWithState (const void *const self, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
+	const struct CollectionClass *const class = uncheckedClassOf(self);
+	return class->enumerateWithState(self, state, iobuffer, length);
+}
+
+/* Array */
+
+static inline ObjectRef uncheckedGetObjectAtIndex (const void *const self, UInteger index) {
+	const struct ArrayClass *const class = uncheckedClassOf(self);
+	return class->getObjectAtIndex(self, index);
+}
+
+static inline UInteger uncheckedIndexOfObject (const void *const self, const void *const object) {
+	const struct ArrayClass *const class = uncheckedClassOf(self);
+	return class->indexOfObject(self, object);
+}
+
+/* String */
+
+static inline const char * uncheckedGetStringText (const void *const self) {
+	const struct StringClass *const class = uncheckedClassOf(self);
+	return class->getStringText(self);
+}
+
+static inline UInteger uncheckedGetStringLength (const void *const self) {
+	const struct StringClass *const class = uncheckedClassOf(self);
+	return class->getStringLength(self);
+}
+
+#endif
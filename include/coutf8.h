@@ -0,0 +1,40 @@
+//
+//  coutf8.h
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+/*!
+ *  @file coutf8.h
+ *  @brief UTF-8 validation, indexing and transcoding to and from UTF-32 and UTF-16.
+ *  @details The conversions behind the UTF-8 methods of @ref String and the @ref WString classes. They are independent
+ *  of the locale and none of the texts need be null terminated, nor are the outputs terminated. Well formed UTF-8 is
+ *  that of RFC 3629: no overlong forms, surrogates nor code points past U+10FFFF. Validation checks 32 bytes at a time
+ *  with lookup tables (Keiser and Lemire, 2021) when the processor has AVX2; the other functions move blocks of ASCII
+ *  16 bytes at a time (SSE2) and the rest one sequence at a time. The functions returning a count return
+ *  @ref NotFound for a malformed input.
+ */
+
+#ifndef CObjects_coutf8_h
+#define CObjects_coutf8_h
+
+#include <coint.h>
+#include <stdint.h>
+
+bool COUTF8Validate(const char *text, UInteger length);
+
+/* The number of code points of valid UTF-8, and the byte offset of the one at index or NotFound past the last */
+UInteger COUTF8CountCodePoints(const char *text, UInteger length);
+UInteger COUTF8OffsetOfCodePoint(const char *text, UInteger length, UInteger index);
+
+/* From UTF-8 at most length units are written, to UTF-8 the number of bytes COUTF32LengthInUTF8 or COUTF16LengthInUTF8 counts */
+UInteger COUTF8ToUTF32(const char *text, UInteger length, uint32_t *output);
+UInteger COUTF8ToUTF16(const char *text, UInteger length, uint16_t *output);
+UInteger COUTF32ToUTF8(const uint32_t *text, UInteger length, char *output);
+UInteger COUTF16ToUTF8(const uint16_t *text, UInteger length, char *output);
+UInteger COUTF32LengthInUTF8(const uint32_t *text, UInteger length);
+UInteger COUTF16LengthInUTF8(const uint16_t *text, UInteger length);
+
+#endif
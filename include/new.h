@@ -20,6 +20,17 @@
  */
 void * new (const void *const restrict class, ...);
 
+/*!
+ *  @fn void * newWithArguments (const void *const restrict class, const void *const arguments);
+ *  @relates Object
+ *  @brief This function creates a new instance of the given class from a class specific arguments structure (@ref StringArguments, @ref CoupleArguments, @ref ValueArguments, ...).
+ *  @details It is the non variadic counterpart of @ref new(): the class's initializer reads typed fields instead of walking a @a NULL terminated argument list. The resulting instance is identical to the one @ref new() would have created.
+ *  @param[in] class the class type of the instance to be created.
+ *  @param[in] arguments a pointer to the arguments structure of @a class.
+ *  @returns a @ref ObjectRef pointer to a newly allocated instance or NULL on error. If @a class has no initializer @a errno is set to @a ENOTSUP.
+ */
+void * newWithArguments (const void *const restrict class, const void *const arguments);
+
 /*!
  *  @fn void delete (void * self)
  *  @relates Object
@@ -102,9 +102,9 @@ static void * Array_copy (const void *const _self) {
 	return (void *)copyArray;
 }
 
-static struct _Bucket * Array_getStore(const void * const _self) {
+static void * Array_getStore(const void * const _self) {
 	const struct Array *self = _self;
-	return (struct _Bucket *)self->store;
+	return (void *)self->store;
 }
 
 static ObjectRef Array_getObjectAtIndex(const void * const _self, UInteger index) {
@@ -244,48 +244,44 @@ static UInteger Array_enumerateWithState(const void *const _self, FastEnumeratio
 		if (collectionCount != state->extra[0])
 			return state->mutationsPointer = NULL, 0;
 	
+	/* extra[1] is the index the next batch starts at */
 	state->itemsPointer = iobuffer;
 	UInteger count = 0;
-	UInteger numberOfIter = MIN(collectionCount, length);
-	for (UInteger i=(state->extra[1]), j=0; i<numberOfIter; i++, j++, count++)
+	UInteger numberOfIter = MIN(collectionCount - state->extra[1], length);
+	for (UInteger i=(state->extra[1]), j=0; j<numberOfIter; i++, j++, count++)
 		iobuffer[j] = getObjectAtIndex(self, i);
-	if (count!=0)
-		state->extra[1] = count;
+	state->extra[1] += count;
 	return count;
 }
 
 //const void * Array = NULL;
 //const void * ArrayClass = NULL;
 
-CO_CLASS_TYPE_INTERNAL_DECL_INIT(
-								 Array,
-								 CollectionClass,
-								 Collection,
-								 CO_OVERRIDE(constructor, ArrayClass_constructor
-											 ),
-								 CO_OVERRIDE(
-											 constructor, Array_constructor,
-											 destructor, Array_destructor,
-											 
-											 /* Overrides */
-											 getCollectionCount, Array_getCollectionCount,
-											 firstObject, Array_firstObject,
-											 lastObject, Array_lastObject,
-											 containsObject, Array_arrayContainsObject,
-											 enumerateWithState, Array_enumerateWithState,
-											 
-											 /* new */
-											 copy, Array_copy,
-											 getObjectAtIndex,
-											 Array_getObjectAtIndex,
-											 equals, Array_equals,
-											 indexOfObject, Array_indexOfObject,
-											 copyDescription, Array_copyDescription,
-											 getStore, Array_getStore
-											 ),
-								 initCollection(),
-								 deallocCollection()
-								 )
+CO_CLASS_TYPE_STATIC_DECL(
+						  Array,
+						  CollectionClass,
+						  Collection,
+						  ArrayClass_constructor,
+						  CO_OVERRIDE(
+									  ArrayClassRoot.constructor = Array_constructor,
+									  ArrayClassRoot.destructor = Array_destructor,
+									  
+									  /* Overrides */
+									  .isa.getCollectionCount = Array_getCollectionCount,
+									  .isa.firstObject = Array_firstObject,
+									  .isa.lastObject = Array_lastObject,
+									  .isa.containsObject = Array_arrayContainsObject,
+									  .isa.enumerateWithState = Array_enumerateWithState,
+									  
+									  /* new */
+									  ArrayClassRoot.copy = Array_copy,
+									  .getObjectAtIndex = Array_getObjectAtIndex,
+									  ArrayClassRoot.equals = Array_equals,
+									  .indexOfObject = Array_indexOfObject,
+									  ArrayClassRoot.copyDescription = Array_copyDescription,
+									  .getStore = Array_getStore
+									  )
+						  )
 
 
 //void initArray () {
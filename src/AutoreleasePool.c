@@ -15,7 +15,7 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <ctype.h>
-
+#include <pthread.h>
 
 #include <coassert.h>
 
@@ -39,11 +39,25 @@ struct threadAutoreleasePoolsHeadItem {
 };
 __thread TAILQ_HEAD(ThreadAutoreleasePoolsHead, threadAutoreleasePoolsHeadItem) ThreadAutoreleasePools;
 
+/* The return value hand-off slot: an object given to autoreleaseReturnValue() waits here
+ * instead of being inserted in the top pool. If the caller claims it right away with
+ * retainAutoreleasedReturnValue() the pool insertion and the retain/release pair are skipped. */
+static __thread void * ThreadAutoreleaseReturnValue = NULL;
+static UInteger AutoreleasePoolElidedReturnValues = 0;
+/* A thread exiting with a value still parked releases it from the destructor of this key, set once per thread */
+static pthread_key_t AutoreleaseReturnValueKey;
+static pthread_once_t AutoreleaseReturnValueOnce = PTHREAD_ONCE_INIT;
+static __thread bool ThreadAutoreleaseReturnValueKeySet = NO;
+
+static void __flushAutoreleaseReturnValue(void);
+
 static void * AutoreleasePool_constructor(void * _self, va_list * app) {
 	struct AutoreleasePool *self = super_constructor(AutoreleasePool, _self, app);
 	if (ThreadAutoreleasePools.tqh_last == NULL && ThreadAutoreleasePools.tqh_first == NULL) {
 		TAILQ_INIT(&ThreadAutoreleasePools);
 	}
+	/* A pending return value belongs to the enclosing pool, not to this one */
+	__flushAutoreleaseReturnValue();
 	struct threadAutoreleasePoolsHeadItem *item = MEMORY_MANAGEMENT_ALLOC(sizeof(struct threadAutoreleasePoolsHeadItem));
 	item->autoreleasePool = self;
 	TAILQ_INSERT_TAIL(&ThreadAutoreleasePools, item, entries);
@@ -63,20 +77,28 @@ static void * AutoreleasePoolClass_constructor(void * _self, va_list * app) {
 		voidf method = va_arg(ap, voidf);
 		if (selector == (voidf) addAutoreleaseObject)
 			* (voidf *) & self->addAutoreleaseObject = method;
+		else if (selector == (voidf) drainAutoreleasePool)
+			* (voidf *) & self->drainAutoreleasePool = method;
 	}
 	va_end(ap);
 	
 	return self;
 }
 
-static void * AutoreleasePool_destructor(void * _self, va_list * app) {
+static void AutoreleasePool_drainAutoreleasePool(void *const _self) {
 	struct AutoreleasePool *self = _self;
 	struct AutoreleasePoolListItem *item = NULL;
+	__flushAutoreleaseReturnValue();
 	while ( (item = SLIST_FIRST(&self->list))) {
 		SLIST_REMOVE_HEAD(&self->list, entry);
 		release((void *)item->object);
 		MEMORY_MANAGEMENT_RELEASE(item);
 	}
+}
+
+static void * AutoreleasePool_destructor(void * _self, va_list * app) {
+	struct AutoreleasePool *self = _self;
+	AutoreleasePool_drainAutoreleasePool(self);
 	
 	{
 		/* Pop other autorelease pools */
@@ -113,18 +135,15 @@ void * AutoreleasePool_retain (void * const _self) {
 
 
 
-const void * AutoreleasePool = NULL;
+CO_CLASS_STORAGE_DECL(AutoreleasePool)
 
-/*! A @ref StringClass type */
-const void * AutoreleasePoolClass = NULL;
-
-void initAutoreleasePool() {
+CO_CLASS_INIT_DECL(AutoreleasePool) {
 	memset(&ThreadAutoreleasePools, 0, sizeof(ThreadAutoreleasePools));
 	if ( ! AutoreleasePoolClass )
 		AutoreleasePoolClass = new(Class, "AutoreleasePoolClass", Class, sizeof(struct AutoreleasePoolClass),
 								   constructor, AutoreleasePoolClass_constructor);
-	if ( ! AutoreleasePool )
-		AutoreleasePool = new(AutoreleasePoolClass, "AutoreleasePool", Object, sizeof(struct AutoreleasePool),
+	if ( CO_CLASS_PENDING(AutoreleasePool) )
+		CO_CLASS_PUBLISH(AutoreleasePool, new(AutoreleasePoolClass, "AutoreleasePool", Object, sizeof(struct AutoreleasePool),
 							  constructor, AutoreleasePool_constructor,
 							  destructor, AutoreleasePool_destructor,
 							  
@@ -134,7 +153,8 @@ void initAutoreleasePool() {
 							  
 							  /* new */
 							  addAutoreleaseObject, AutoreleasePool_addAutoreleaseObject,
-							  NULL);
+							  drainAutoreleasePool, AutoreleasePool_drainAutoreleasePool,
+							  NULL));
 }
 
 void deallocAutoreleasePool() {
@@ -158,6 +178,14 @@ void addAutoreleaseObject(const void *self, const void *object) {
 	class->addAutoreleaseObject(self, object);
 }
 
+void drainAutoreleasePool(void *const self) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	
+	const struct AutoreleasePoolClass *class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->drainAutoreleasePool,ENOTSUP);
+	class->drainAutoreleasePool(self);
+}
 
 void AutoreleasePoolAddObject(const void *object) {
 	COAssertNoNullOrBailOut(object,EINVAL);
@@ -175,3 +203,49 @@ void AutoreleasePoolAddObject(const void *object) {
 	}
 }
 
+static void __flushAutoreleaseReturnValue(void) {
+	void *object = ThreadAutoreleaseReturnValue;
+	if (object == NULL) return;
+	ThreadAutoreleaseReturnValue = NULL;
+	AutoreleasePoolAddObject(object);
+}
+
+static void __releaseAutoreleaseReturnValue(void *value) {
+	void *object = ThreadAutoreleaseReturnValue;
+	ThreadAutoreleaseReturnValue = NULL;
+	if (object) release(object);
+}
+
+static void __createAutoreleaseReturnValueKey(void) {
+	pthread_key_create(&AutoreleaseReturnValueKey, __releaseAutoreleaseReturnValue);
+}
+
+void *autoreleaseReturnValue(void *const object) {
+	COAssertNoNullOrReturn(object,EINVAL,NULL);
+	
+	if (!ThreadAutoreleaseReturnValueKeySet) {
+		pthread_once(&AutoreleaseReturnValueOnce, __createAutoreleaseReturnValueKey);
+		/* Any non null value, for the destructor to be called */
+		pthread_setspecific(AutoreleaseReturnValueKey, &AutoreleaseReturnValueKey);
+		ThreadAutoreleaseReturnValueKeySet = YES;
+	}
+	__flushAutoreleaseReturnValue();
+	ThreadAutoreleaseReturnValue = object;
+	return object;
+}
+
+void *retainAutoreleasedReturnValue(void *const object) {
+	COAssertNoNullOrReturn(object,EINVAL,NULL);
+	
+	if (ThreadAutoreleaseReturnValue == object) {
+		/* The caller inherits the reference the pool would have dropped */
+		ThreadAutoreleaseReturnValue = NULL;
+		__atomic_add_fetch(&AutoreleasePoolElidedReturnValues, 1, __ATOMIC_RELAXED);
+		return object;
+	}
+	return retain(object);
+}
+
+UInteger AutoreleasePoolGetElidedReturnValueCount() {
+	return __atomic_load_n(&AutoreleasePoolElidedReturnValues, __ATOMIC_RELAXED);
+}
@@ -14,8 +14,7 @@
 #include <cobj.h>
 #include <Buffer.r>
 
-const void * Buffer = NULL;
-const void * BufferClass = NULL;
+CO_CLASS_STORAGE_DECL(Buffer)
 
 static void * Buffer_constructor (void * _self, va_list * app) {
 	struct Buffer *self = super_constructor(Buffer, _self, app);
@@ -102,12 +101,12 @@ static UInteger Buffer_getBufferLength (const void *const _self) {
 	return self->length;
 }
 
-void initBuffer() {
+CO_CLASS_INIT_DECL(Buffer) {
 	if ( ! BufferClass )
 		BufferClass = new(Class, "BufferClass", Class, sizeof(struct BufferClass),
 						  constructor, BufferClass_constructor, NULL);
-	if ( ! Buffer )
-		Buffer = new(BufferClass, "Buffer", Object, sizeof(struct Buffer),
+	if ( CO_CLASS_PENDING(Buffer) )
+		CO_CLASS_PUBLISH(Buffer, new(BufferClass, "Buffer", Object, sizeof(struct Buffer),
 					 constructor, Buffer_constructor,
 					 destructor, Buffer_destructor,
 					 
@@ -120,7 +119,7 @@ void initBuffer() {
 					 getBufferBytesOfLength, Buffer_getBufferBytesOfLength,
 					 getBufferBytesInRange, Buffer_getBufferBytesInRange,
 					 getBufferLength, Buffer_getBufferLength,
-					 NULL);
+					 NULL));
 }
 
 void deallocBuffer() {
@@ -72,28 +72,27 @@ static void * Collection_firstObject(const void * const self) {
 	return NULL;
 }
 
-static UInteger Collection_enumerateWithState(ObjectRef collection, FastEnumerationState *state, ObjectRef iobuffer[], UInteger length) {
+static UInteger Collection_enumerateWithState(const void *const collection, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
 	return 0;
 }
 
 
-CO_CLASS_TYPE_INTERNAL_DECL_DEALLOC(
-									Collection,
-									Class,
-									Object,
-									CO_OVERRIDE(constructor, CollectionClass_constructor
-												),
-									CO_OVERRIDE(
-												constructor, Collection_constructor,
-												destructor, Collection_destructor,
-												/* new */
-												getCollectionCount, Collection_getCollectionCount,
-												firstObject, Collection_firstObject,
-												lastObject, Collection_lastObject,
-												containsObject, Collection_containsObject,
-												enumerateWithState, Collection_enumerateWithState
-												),
-									)
+CO_CLASS_TYPE_STATIC_DECL(
+						  Collection,
+						  Class,
+						  Object,
+						  CollectionClass_constructor,
+						  CO_OVERRIDE(
+									  CollectionClassRoot.constructor = Collection_constructor,
+									  CollectionClassRoot.destructor = Collection_destructor,
+									  /* new */
+									  .getCollectionCount = Collection_getCollectionCount,
+									  .firstObject = Collection_firstObject,
+									  .lastObject = Collection_lastObject,
+									  .containsObject = Collection_containsObject,
+									  .enumerateWithState = Collection_enumerateWithState
+									  )
+						  )
 
 UInteger getCollectionCount(const void * const self) {
 	COAssertNoNullOrReturn(self,EINVAL,0);
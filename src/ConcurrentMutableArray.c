@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include <sys/queue.h>
+#include <time.h>
 
 #include <cobj.h>
 #include <new.h>
@@ -25,7 +26,16 @@
 static void * ConcurrentMutableArray_constructor (void * _self, va_list * app) {
 	struct ConcurrentMutableArray *self = super_constructor(ConcurrentMutableArray, _self, app);
 	pthread_mutex_init(&(self->protector), NULL);
-	pthread_cond_init(&(self->synchronization), NULL);
+	pthread_condattr_t attributes;
+	pthread_condattr_init(&attributes);
+	/* Timed waits measure against a clock that settimeofday does not move */
+	pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+	pthread_cond_init(&(self->synchronization), &attributes);
+	pthread_condattr_destroy(&attributes);
+	self->waitingConsumers = 0;
+#ifdef __PROFILING__
+	self->lockAcquisitions = self->lockHoldTime = self->maxLockHoldTime = self->lockedAt = 0;
+#endif
 	return self;
 }
 
@@ -35,145 +45,302 @@ static void * ConcurrentMutableArray_destructor (void * _self) {
 }
 
 static void * ConcurrentMutableArrayClass_constructor (void * _self, va_list *app) {
-	struct MutableArrayClass * self = super_constructor(ConcurrentMutableArrayClass, _self, app);
+	struct ConcurrentMutableArrayClass * self = super_constructor(ConcurrentMutableArrayClass, _self, app);
 	typedef void (*voidf) ();
 	voidf selector;
 	va_list ap;
 	va_copy(ap, *app);
 	while ( (selector = va_arg(ap, voidf)) ) {
-//		voidf method = va_arg(ap, voidf);
-//		if (selector == (voidf) insertObject )
-//			* (voidf *) & self->insertObject = method;
-//		else if (selector == (voidf) addObject )
-//			* (voidf *) & self->addObject = method;
-
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) popObjectWaiting )
+			* (voidf *) & self->popObjectWaiting = method;
+		else if (selector == (voidf) drainObjectsIntoArray )
+			* (voidf *) & self->drainObjectsIntoArray = method;
 	}
 	va_end(ap);
+	
+	/* Subclasses inherit the resolved implementations with the rest of the super class table */
+	const struct Classs *const class = (const struct Classs *)self;
+	if ( sizeOf(class->super) < sizeof(struct ConcurrentMutableArrayClass) ) {
+		const struct MutableArrayClass *const _super = (const struct MutableArrayClass *)class->super;
+		const struct ArrayClass *const _superArray = (const struct ArrayClass *)_super;
+		const struct CollectionClass *const _superCollection = (const struct CollectionClass *)_super;
+		self->unlockedGetCollectionCount = _superCollection->getCollectionCount;
+		self->unlockedGetObjectAtIndex = _superArray->getObjectAtIndex;
+		self->unlockedAddObject = _super->addObject;
+		self->unlockedInsertObject = _super->insertObject;
+		self->unlockedInsertObjectAtIndex = _super->insertObjectAtIndex;
+		self->unlockedRemoveObjectAtIndex = _super->removeObjectAtIndex;
+		self->unlockedEnumerateWithState = _superCollection->enumerateWithState;
+	}
 	return self;
 }
 
+#ifdef __PROFILING__
+static UInteger ConcurrentMutableArray_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UInteger)ts.tv_sec * 1000000000UL + (UInteger)ts.tv_nsec;
+}
+
+static void ConcurrentMutableArray_accountHoldTime(struct ConcurrentMutableArray *const self) {
+	UInteger held = ConcurrentMutableArray_now() - self->lockedAt;
+	self->lockHoldTime += held;
+	if ( held > self->maxLockHoldTime )
+		self->maxLockHoldTime = held;
+}
+#endif
+
+static void ConcurrentMutableArray_lock(struct ConcurrentMutableArray *const self) {
+	pthread_mutex_lock(&(self->protector));
+#ifdef __PROFILING__
+	self->lockAcquisitions++;
+	self->lockedAt = ConcurrentMutableArray_now();
+#endif
+}
+
+static void ConcurrentMutableArray_unlock(struct ConcurrentMutableArray *const self) {
+#ifdef __PROFILING__
+	ConcurrentMutableArray_accountHoldTime(self);
+#endif
+	pthread_mutex_unlock(&(self->protector));
+}
+
+void ConcurrentMutableArrayLock(struct ConcurrentMutableArray *const self) {
+	ConcurrentMutableArray_lock(self);
+}
+
+void ConcurrentMutableArrayUnlock(struct ConcurrentMutableArray *const self) {
+	ConcurrentMutableArray_unlock(self);
+}
+
+/* Waits for an addition, until deadline if there is one. Returns 0 or ETIMEDOUT. */
+static int ConcurrentMutableArray_wait(struct ConcurrentMutableArray *const self, const struct timespec *const deadline) {
+	int error = 0;
+#ifdef __PROFILING__
+	ConcurrentMutableArray_accountHoldTime(self);
+#endif
+	self->waitingConsumers++;
+	if ( deadline )
+		error = pthread_cond_timedwait(&(self->synchronization), &(self->protector), deadline);
+	else
+		pthread_cond_wait(&(self->synchronization), &(self->protector));
+	self->waitingConsumers--;
+#ifdef __PROFILING__
+	self->lockedAt = ConcurrentMutableArray_now();
+#endif
+	return error;
+}
+
+/* Wakes one waiting consumer per added object, called with the lock held */
+static void ConcurrentMutableArray_signal(struct ConcurrentMutableArray *const self, UInteger added) {
+	if ( self->waitingConsumers == 0 || added == 0 )
+		return;
+	if ( added == 1 )
+		pthread_cond_signal(&(self->synchronization));
+	else
+		pthread_cond_broadcast(&(self->synchronization));
+}
+
 static UInteger ConcurrentMutableArray_getCollectionCount(const void * const _self) {
 	struct ConcurrentMutableArray *self = (struct ConcurrentMutableArray *)_self;
-	const struct CollectionClass *const _superSuper = superclass(superclass(superclass(classOf(_self))));
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	UInteger count = _superSuper->getCollectionCount(self);
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	UInteger count = class->unlockedGetCollectionCount(self);
+	ConcurrentMutableArray_unlock(self);
 	return count;
 }
 
 static ObjectRef ConcurrentMutableArray_getObjectAtIndex(const void * const _self, UInteger index) {
 	struct ConcurrentMutableArray *self = (struct ConcurrentMutableArray *)_self;
-	const struct CollectionClass *const _superSuper = superclass(superclass(superclass(classOf(_self))));
-	const struct ArrayClass *const _super = superclass(classOf(_self));
-
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	UInteger count = _superSuper->getCollectionCount(self);
-	if ( index > count && index != 0 ) return pthread_mutex_unlock(&(self->protector)), errno = EINVAL, NULL;
-	if ( count == 0 )
-		pthread_cond_wait(&(self->synchronization),&(self->protector));
-	ObjectRef o = _super->getObjectAtIndex(self, index);
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	UInteger count = class->unlockedGetCollectionCount(self);
+	/* Only the first object is worth waiting for, any other index of an empty array is out of range */
+	if ( count == 0 && index != 0 ) return ConcurrentMutableArray_unlock(self), errno = EINVAL, NULL;
+	while ( count == 0 ) {
+		ConcurrentMutableArray_wait(self, NULL);
+		count = class->unlockedGetCollectionCount(self);
+	}
+	if ( index >= count ) return ConcurrentMutableArray_unlock(self), errno = EINVAL, NULL;
+	ObjectRef o = class->unlockedGetObjectAtIndex(self, index);
+	ConcurrentMutableArray_unlock(self);
 	return o;
 }
 
+/* By index under the lock, as a cursor into the list would dangle once another thread removed its item between two
+ * batches. The enumeration ends early if the count changed in between. */
+static UInteger ConcurrentMutableArray_enumerateWithState(const void *const _self, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
+	struct ConcurrentMutableArray *self = (struct ConcurrentMutableArray *)_self;
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
+	
+	ConcurrentMutableArray_lock(self);
+	UInteger count = class->unlockedGetCollectionCount(self);
+	if ( state->state == 0 ) {
+		state->mutationsPointer = (UInteger *)self;
+		state->extra[0] = count;
+		state->state = 1;
+	}
+	else if ( count != state->extra[0] )
+		return ConcurrentMutableArray_unlock(self), state->mutationsPointer = NULL, 0;
+	
+	state->itemsPointer = iobuffer;
+	UInteger enumerated = 0;
+	for ( ; enumerated < length && state->extra[1] + enumerated < count; enumerated++)
+		iobuffer[enumerated] = class->unlockedGetObjectAtIndex(self, state->extra[1] + enumerated);
+	state->extra[1] += enumerated;
+	ConcurrentMutableArray_unlock(self);
+	return enumerated;
+}
+
 static void ConcurrentMutableArray_addObject(void *const _self, void * const object) {
 	struct ConcurrentMutableArray *self = _self;
-	const struct CollectionClass *const _superSuper = superclass(superclass(superclass(classOf(_self))));
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
-	
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	UInteger count = _superSuper->getCollectionCount(self);
-	_super->addObject(self, object);
-	if ( count == 0 )
-		pthread_cond_signal(&(self->synchronization));
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	class->unlockedAddObject(self, object);
+	ConcurrentMutableArray_signal(self, 1);
+	ConcurrentMutableArray_unlock(self);
 }
 
 static void ConcurrentMutableArray_insertObject(void *const _self, void * const object) {
 	struct ConcurrentMutableArray *self = _self;
-	const struct CollectionClass *const _superSuper = superclass(superclass(superclass(classOf(_self))));
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	UInteger count = _superSuper->getCollectionCount(self);
-	_super->insertObject(self, object);
-	if ( count == 0 )
-		pthread_cond_signal(&(self->synchronization));
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	class->unlockedInsertObject(self, object);
+	ConcurrentMutableArray_signal(self, 1);
+	ConcurrentMutableArray_unlock(self);
 }
 
 static void ConcurrentMutableArray_insertObjectAtIndex(void *const _self, void *const object, UInteger index) {
 	struct ConcurrentMutableArray *self = _self;
-	const struct CollectionClass *const _superSuper = superclass(superclass(superclass(classOf(_self))));
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	UInteger count = _superSuper->getCollectionCount(self);
-	_super->insertObjectAtIndex(_self, object, index);
-	if ( count == 0 && index ) { errno = EINVAL; pthread_mutex_unlock(&(self->protector)); return; }
-	if ( count == 0 )
-		pthread_cond_signal(&(self->synchronization));
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	UInteger count = class->unlockedGetCollectionCount(self);
+	if ( index > count ) { errno = EINVAL; ConcurrentMutableArray_unlock(self); return; }
+	/* MutableArray inserts at either end through the dispatched methods, which would take the lock again */
+	if ( index == 0 )
+		class->unlockedInsertObject(self, object);
+	else if ( index == count )
+		class->unlockedAddObject(self, object);
+	else
+		class->unlockedInsertObjectAtIndex(self, object, index);
+	ConcurrentMutableArray_signal(self, 1);
+	ConcurrentMutableArray_unlock(self);
 }
 
 static void *ConcurrentMutableArray_copy(const void *const _self) {
 	struct ConcurrentMutableArray *self = (struct ConcurrentMutableArray *)_self;
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
-	const struct ArrayClass *const _superSuper = (const struct ArrayClass *)_super;
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
 	const struct Array *arraySelf = _self;
 	if ( arraySelf->count ==0 || getStore(self) == NULL)
-		return pthread_mutex_unlock(&(self->protector)), new(MutableArray, NULL);
+		return ConcurrentMutableArray_unlock(self), new(MutableArray, NULL);
 	
 	struct Array * copyArray = new(MutableArray, NULL);
 	ObjectRef item = NULL;
 	UInteger count = arraySelf->count;
-	for (UInteger i=0;  i<count && (item = _superSuper->getObjectAtIndex(self, i)) ; i++)
-		_super->addObject(copyArray, item);
-	pthread_mutex_unlock(&(self->protector));
+	for (UInteger i=0;  i<count && (item = class->unlockedGetObjectAtIndex(self, i)) ; i++)
+		class->unlockedAddObject(copyArray, item);
+	ConcurrentMutableArray_unlock(self);
 	return (void *)copyArray;
 }
 
 static void ConcurrentMutableArray_removeObjectAtIndex(void *const _self, UInteger index) {
 	struct ConcurrentMutableArray *self = _self;
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	_super->removeObjectAtIndex(self, index);
-	pthread_mutex_unlock(&(self->protector));
+	ConcurrentMutableArray_lock(self);
+	class->unlockedRemoveObjectAtIndex(self, index);
+	ConcurrentMutableArray_unlock(self);
 }
 
 static ObjectRef ConcurrentMutableArray_popObject(void *const _self) {
 	struct Array *const arraySelf = _self;
 	struct ConcurrentMutableArray *self = _self;
-	const struct MutableArrayClass *const _super = superclass(classOf(_self));
-	const struct ArrayClass *const _superSuper = (const struct ArrayClass *)_super;
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
 	
-	pthread_mutex_lock(&(self->protector));
-	if ( arraySelf->count <= 0 ) return pthread_mutex_unlock(&(self->protector)), (ObjectRef)NULL;
-	ObjectRef o =  _superSuper->getObjectAtIndex(self, 0);
+	ConcurrentMutableArray_lock(self);
+	if ( arraySelf->count <= 0 ) return ConcurrentMutableArray_unlock(self), (ObjectRef)NULL;
+	ObjectRef o =  class->unlockedGetObjectAtIndex(self, 0);
 	if ( o != self ) retain(o);
-	_super->removeObjectAtIndex(self, 0);
-	pthread_mutex_unlock(&(self->protector));
+	class->unlockedRemoveObjectAtIndex(self, 0);
+	ConcurrentMutableArray_unlock(self);
 	return o;
 }
 
-const void * ConcurrentMutableArray  = NULL;
-const void * ConcurrentMutableArrayClass = NULL;
+static ObjectRef ConcurrentMutableArray_popObjectWaiting(void *const _self, Integer timeout) {
+	struct ConcurrentMutableArray *self = _self;
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
+	struct timespec deadline;
+	if ( timeout > 0 ) {
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (timeout % 1000) * 1000000L;
+		if ( deadline.tv_nsec >= 1000000000L )
+			deadline.tv_sec++, deadline.tv_nsec -= 1000000000L;
+	}
+	
+	int error = 0;
+	ConcurrentMutableArray_lock(self);
+	while ( error == 0 && class->unlockedGetCollectionCount(self) == 0 )
+		error = ( timeout == 0 ) ? ETIMEDOUT : ConcurrentMutableArray_wait(self, ( timeout > 0 ) ? &deadline : NULL);
+	/* An object added right at the deadline is still taken */
+	if ( error == ETIMEDOUT && class->unlockedGetCollectionCount(self) > 0 )
+		error = 0;
+	ObjectRef o = NULL;
+	if ( error == 0 ) {
+		o = retain(class->unlockedGetObjectAtIndex(self, 0));
+		class->unlockedRemoveObjectAtIndex(self, 0);
+	}
+	ConcurrentMutableArray_unlock(self);
+	if ( error ) errno = error;
+	return o;
+}
+
+static UInteger ConcurrentMutableArray_drainObjectsIntoArray(void *const _self, void *const array, UInteger max) {
+	struct ConcurrentMutableArray *self = _self;
+	const struct ConcurrentMutableArrayClass *const class = classOf(_self);
+	if ( array == _self ) return errno = EINVAL, 0;
+	
+	ConcurrentMutableArray_lock(self);
+	UInteger count = class->unlockedGetCollectionCount(self);
+	if ( count > max )
+		count = max;
+	if ( count == 0 ) return ConcurrentMutableArray_unlock(self), 0;
+	ObjectRef *objects = malloc(count * sizeof(ObjectRef));
+	if ( objects == NULL ) return ConcurrentMutableArray_unlock(self), errno = ENOMEM, 0;
+	for (UInteger i=0; i<count; i++) {
+		objects[i] = retain(class->unlockedGetObjectAtIndex(self, 0));
+		class->unlockedRemoveObjectAtIndex(self, 0);
+	}
+	ConcurrentMutableArray_unlock(self);
+	
+	/* Added once self is unlocked: the destination may be another concurrent array, draining into self */
+	for (UInteger i=0; i<count; i++) {
+		addObject(array, objects[i]);
+		release(objects[i]);
+	}
+	free(objects);
+	return count;
+}
+
+CO_CLASS_STORAGE_DECL(ConcurrentMutableArray)
 
-void initConcurrentMutableArray () {
+CO_CLASS_INIT_DECL(ConcurrentMutableArray) {
 	initArray();
 	initMutableArray();
 	
 	if ( ! ConcurrentMutableArrayClass )
 		ConcurrentMutableArrayClass = new(MutableArrayClass, "ConcurrentMutableArrayClass", MutableArrayClass, sizeof(struct ConcurrentMutableArrayClass),
 			constructor, ConcurrentMutableArrayClass_constructor, NULL);
-	if ( ! ConcurrentMutableArray )
-		ConcurrentMutableArray = new(ConcurrentMutableArrayClass, "ConcurrentMutableArray", MutableArray, sizeof(struct ConcurrentMutableArray),
+	if ( CO_CLASS_PENDING(ConcurrentMutableArray) )
+		CO_CLASS_PUBLISH(ConcurrentMutableArray, new(ConcurrentMutableArrayClass, "ConcurrentMutableArray", MutableArray, sizeof(struct ConcurrentMutableArray),
 									 constructor, ConcurrentMutableArray_constructor,
 									 destructor, ConcurrentMutableArray_destructor,
 									 
@@ -182,6 +349,7 @@ void initConcurrentMutableArray () {
 									 
 									 getCollectionCount, ConcurrentMutableArray_getCollectionCount,
 									 getObjectAtIndex, ConcurrentMutableArray_getObjectAtIndex,
+									 enumerateWithState, ConcurrentMutableArray_enumerateWithState,
 									 
 									 addObject, ConcurrentMutableArray_addObject,
 									 insertObject, ConcurrentMutableArray_insertObject,
@@ -190,8 +358,10 @@ void initConcurrentMutableArray () {
 									 popObject, ConcurrentMutableArray_popObject,
 									 
 									 /* new */
+									 popObjectWaiting, ConcurrentMutableArray_popObjectWaiting,
+									 drainObjectsIntoArray, ConcurrentMutableArray_drainObjectsIntoArray,
 									 
-									 NULL);
+									 NULL));
 }
 
 void deallocConcurrentMutableArray () {
@@ -205,6 +375,42 @@ void deallocConcurrentMutableArray () {
 
 /* */
 
+ObjectRef popObjectWaiting(void *const self, Integer timeout) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct ConcurrentMutableArrayClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->popObjectWaiting,ENOTSUP,NULL);
+	return class->popObjectWaiting(self, timeout);
+}
+
+UInteger drainObjectsIntoArray(void *const self, void *const array, UInteger max) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	COAssertNoNullOrReturn(array,EINVAL,0);
+	const struct ConcurrentMutableArrayClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->drainObjectsIntoArray,ENOTSUP,0);
+	return class->drainObjectsIntoArray(self, array, max);
+}
+
+#ifdef __PROFILING__
+void ConcurrentMutableArrayGetLockStatistics(const void *const _self, UInteger *const acquisitions, UInteger *const holdTime, UInteger *const maxHoldTime) {
+	COAssertNoNullOrBailOut(_self,EINVAL);
+	struct ConcurrentMutableArray *self = (struct ConcurrentMutableArray *)_self;
+	
+	pthread_mutex_lock(&(self->protector));
+	if ( acquisitions ) *acquisitions = self->lockAcquisitions;
+	if ( holdTime ) *holdTime = self->lockHoldTime;
+	if ( maxHoldTime ) *maxHoldTime = self->maxLockHoldTime;
+	pthread_mutex_unlock(&(self->protector));
+}
+
+void ConcurrentMutableArrayPrintfStatistics(const void *const self) {
+	UInteger acquisitions = 0, holdTime = 0, maxHoldTime = 0;
+	ConcurrentMutableArrayGetLockStatistics(self, &acquisitions, &holdTime, &maxHoldTime);
+	printf("ConcurrentMutableArray Statistics{ lockAcquisitions:[%lu], lockHoldTime:[%lu ns], meanLockHoldTime:[%lu ns], maxLockHoldTime:[%lu ns]}\n", acquisitions, holdTime, acquisitions ? holdTime/acquisitions : 0, maxHoldTime);
+}
+#endif
+
 int arrayContainsObject(const void * const self, const void * const object);
 UInteger indexOfObject(const void * const self, const void * const object);
 
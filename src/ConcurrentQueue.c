@@ -0,0 +1,206 @@
+//
+//  ConcurrentQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <ConcurrentQueue.r>
+
+/* A bounded MPMC ring after Dmitry Vyukov's: producers and consumers each claim a position with one CAS and the
+ * sequence number of the claimed cell hands it over between them. The blocking methods park on a condition only
+ * when the ring is full or empty; the non blocking paths just check whether anyone is parked. */
+
+CO_CLASS_STORAGE_DECL(ConcurrentQueue)
+
+static void * ConcurrentQueue_constructor (void * _self, va_list * app) {
+	struct ConcurrentQueue *self = super_constructor(ConcurrentQueue, _self, app);
+	if ( self == NULL ) return NULL;
+	const UInteger size = self->isa.mask + 1;
+	/* Past this the size of the cells overflows. The destructor copes with a queue without cells */
+	if ( size > UIntegerMax / sizeof(struct _ConcurrentQueueCell) )
+		return MEMORY_MANAGEMENT_RELEASE(self), errno = EINVAL, NULL;
+
+	self->cells = malloc(size * sizeof(struct _ConcurrentQueueCell));
+	assert( self->cells != NULL );
+	if ( self->cells == NULL ) return MEMORY_MANAGEMENT_RELEASE(self), errno = ENOMEM, NULL;
+	for (UInteger i=0; i<size; i++)
+		self->cells[i].sequence = i, self->cells[i].object = NULL;
+	self->enqueuePosition = self->dequeuePosition = 0;
+	return self;
+}
+
+static ObjectRef ConcurrentQueue_pop(struct ConcurrentQueue *const self);
+
+static void * ConcurrentQueue_destructor (void * _self) {
+	struct ConcurrentQueue *self = super_destructor(ConcurrentQueue, _self);
+	ObjectRef object = NULL;
+	if ( self->cells != NULL )
+		while ( (object = ConcurrentQueue_pop(self)) )
+			release(object);
+	free(self->cells), self->cells = NULL;
+	return self;
+}
+
+/* Claims the cell at the enqueue position and fills it, without waking anyone */
+static bool ConcurrentQueue_push(struct ConcurrentQueue *const self, void *const object) {
+	struct _ConcurrentQueueCell *cell = NULL;
+	UInteger position = __atomic_load_n(&(self->enqueuePosition), __ATOMIC_RELAXED);
+	for (;;) {
+		cell = &(self->cells[position & self->isa.mask]);
+		UInteger sequence = __atomic_load_n(&(cell->sequence), __ATOMIC_ACQUIRE);
+		Integer difference = (Integer)sequence - (Integer)position;
+		if ( difference == 0 ) {
+			if ( __atomic_compare_exchange_n(&(self->enqueuePosition), &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+				break;
+		}
+		else if ( difference < 0 )
+			return NO;
+		else
+			position = __atomic_load_n(&(self->enqueuePosition), __ATOMIC_RELAXED);
+	}
+	retain(object);
+	cell->object = object;
+	__atomic_store_n(&(cell->sequence), position + 1, __ATOMIC_RELEASE);
+	return YES;
+}
+
+/* Claims the cell at the dequeue position and empties it, without waking anyone */
+static ObjectRef ConcurrentQueue_pop(struct ConcurrentQueue *const self) {
+	struct _ConcurrentQueueCell *cell = NULL;
+	UInteger position = __atomic_load_n(&(self->dequeuePosition), __ATOMIC_RELAXED);
+	for (;;) {
+		cell = &(self->cells[position & self->isa.mask]);
+		UInteger sequence = __atomic_load_n(&(cell->sequence), __ATOMIC_ACQUIRE);
+		Integer difference = (Integer)sequence - (Integer)(position + 1);
+		if ( difference == 0 ) {
+			if ( __atomic_compare_exchange_n(&(self->dequeuePosition), &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+				break;
+		}
+		else if ( difference < 0 )
+			return NULL;
+		else
+			position = __atomic_load_n(&(self->dequeuePosition), __ATOMIC_RELAXED);
+	}
+	ObjectRef object = cell->object;
+	cell->object = NULL;
+	__atomic_store_n(&(cell->sequence), position + self->isa.mask + 1, __ATOMIC_RELEASE);
+	return object;
+}
+
+static bool ConcurrentQueue_tryEnqueueObject(void *const _self, void *const object) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	if ( ! ConcurrentQueue_push(self, object) )
+		return NO;
+	QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), 1);
+	return YES;
+}
+
+static ObjectRef ConcurrentQueue_tryDequeueObject(void *const _self) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	ObjectRef object = ConcurrentQueue_pop(self);
+	if ( object != NULL )
+		QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), 1);
+	return object;
+}
+
+static UInteger ConcurrentQueue_tryEnqueueObjects(void *const _self, void *const objects[], UInteger count) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	UInteger enqueued = 0;
+	while ( enqueued < count && ConcurrentQueue_push(self, objects[enqueued]) )
+		enqueued++;
+	if ( enqueued > 0 )
+		QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), enqueued);
+	return enqueued;
+}
+
+static UInteger ConcurrentQueue_tryDequeueObjects(void *const _self, ObjectRef objects[], UInteger count) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	UInteger dequeued = 0;
+	while ( dequeued < count && (objects[dequeued] = ConcurrentQueue_pop(self)) )
+		dequeued++;
+	if ( dequeued > 0 )
+		QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), dequeued);
+	return dequeued;
+}
+
+static void ConcurrentQueue_enqueueObject(void *const _self, void *const object) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	if ( ! ConcurrentQueue_push(self, object) ) {
+		pthread_mutex_lock(&(queue->parking));
+		__atomic_add_fetch(&(queue->waitingProducers), 1, __ATOMIC_SEQ_CST);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		while ( ! ConcurrentQueue_push(self, object) )
+			pthread_cond_wait(&(queue->notFull), &(queue->parking));
+		__atomic_sub_fetch(&(queue->waitingProducers), 1, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(queue->parking));
+	}
+	QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), 1);
+}
+
+static ObjectRef ConcurrentQueue_dequeueObject(void *const _self) {
+	struct ConcurrentQueue *self = _self;
+	struct Queue *queue = _self;
+	ObjectRef object = ConcurrentQueue_pop(self);
+	if ( object == NULL ) {
+		pthread_mutex_lock(&(queue->parking));
+		__atomic_add_fetch(&(queue->waitingConsumers), 1, __ATOMIC_SEQ_CST);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		while ( (object = ConcurrentQueue_pop(self)) == NULL )
+			pthread_cond_wait(&(queue->notEmpty), &(queue->parking));
+		__atomic_sub_fetch(&(queue->waitingConsumers), 1, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(queue->parking));
+	}
+	QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), 1);
+	return object;
+}
+
+static UInteger ConcurrentQueue_getQueueCount(const void *const _self) {
+	const struct ConcurrentQueue *self = _self;
+	UInteger dequeuePosition = __atomic_load_n(&(self->dequeuePosition), __ATOMIC_ACQUIRE);
+	UInteger enqueuePosition = __atomic_load_n(&(self->enqueuePosition), __ATOMIC_ACQUIRE);
+	if ( enqueuePosition <= dequeuePosition )
+		return 0;
+	UInteger count = enqueuePosition - dequeuePosition;
+	return count > self->isa.mask + 1 ? self->isa.mask + 1 : count;
+}
+
+CO_CLASS_INIT_DECL(ConcurrentQueue) {
+	initQueue();
+
+	if ( ! ConcurrentQueueClass )
+		ConcurrentQueueClass = new(QueueClass, "ConcurrentQueueClass", QueueClass, sizeof(struct ConcurrentQueueClass), NULL);
+	if ( CO_CLASS_PENDING(ConcurrentQueue) )
+		CO_CLASS_PUBLISH(ConcurrentQueue, new(ConcurrentQueueClass, "ConcurrentQueue", Queue, sizeof(struct ConcurrentQueue),
+							  constructor, ConcurrentQueue_constructor,
+							  destructor, ConcurrentQueue_destructor,
+
+							  /* Overrides */
+							  tryEnqueueObject, ConcurrentQueue_tryEnqueueObject,
+							  tryDequeueObject, ConcurrentQueue_tryDequeueObject,
+							  tryEnqueueObjects, ConcurrentQueue_tryEnqueueObjects,
+							  tryDequeueObjects, ConcurrentQueue_tryDequeueObjects,
+							  enqueueObject, ConcurrentQueue_enqueueObject,
+							  dequeueObject, ConcurrentQueue_dequeueObject,
+							  getQueueCount, ConcurrentQueue_getQueueCount,
+							  NULL));
+}
+
+void deallocConcurrentQueue() {
+	release((void *)ConcurrentQueue), ConcurrentQueue = NULL;
+	release((void *)ConcurrentQueueClass), ConcurrentQueueClass = NULL;
+}
@@ -13,8 +13,7 @@
 #include <cobj.h>
 #include <Couple.r>
 
-const void * Couple = NULL;
-const void * CoupleClass = NULL;
+CO_CLASS_STORAGE_DECL(Couple)
 
 static void * Couple_constructor (void * _self, va_list * app) {
 	struct Couple *self = super_constructor(Couple, _self, app);
@@ -30,6 +29,18 @@ static void * Couple_constructor (void * _self, va_list * app) {
 	return self;
 }
 
+static void * Couple_initializer (void * _self, const void *const _arguments) {
+	const CoupleArguments *arguments = _arguments;
+	COAssertNoNullOrReturn(arguments,EINVAL,NULL);
+	COAssertNoNullOrReturn(arguments->key,EINVAL,NULL);
+	COAssertNoNullOrReturn(arguments->value,EINVAL,NULL);
+	
+	struct Couple *self = super_initializer(Couple, _self, _arguments);
+	self->key = retain(arguments->key);
+	self->value = retain(arguments->value);
+	return self;
+}
+
 static void * Couple_destructor (void * _self) {
 	struct Couple *self = super_destructor(Couple, _self);
 	release(self->key), release(self->value);
@@ -59,7 +70,7 @@ static void * CoupleClass_constructor (void * _self, va_list *app) {
 
 static void * Couple_copy (const void * const _self) {
 	const struct Couple *self = _self;
-	return new(Couple, getKey(self), getValue(self), NULL);
+	return newWithArguments(Couple, &(CoupleArguments){ getKey(self), getValue(self) });
 }
 
 static bool Couple_equals (const void * const _self, const void *const _other) {
@@ -122,14 +133,15 @@ static StringRef Couple_copyDescription (void *const _self) {
 	return copyDescription;
 }
 
-void initCouple() {
+CO_CLASS_INIT_DECL(Couple) {
 	if ( ! CoupleClass ) {
 		CoupleClass = new(Class, "CoupleClass", Class, sizeof(struct CoupleClass),
 						  constructor, CoupleClass_constructor, NULL);
 	}
-	if ( ! Couple ) {
-		Couple = new(CoupleClass, "Couple", Object, sizeof(struct Couple),
+	if ( CO_CLASS_PENDING(Couple) ) {
+		CO_CLASS_PUBLISH(Couple, new(CoupleClass, "Couple", Object, sizeof(struct Couple),
 					 constructor, Couple_constructor,
+					 initializer, Couple_initializer,
 					 destructor, Couple_destructor,
 					 /* Overrides */
 					 equals, Couple_equals,
@@ -142,13 +154,15 @@ void initCouple() {
 					 getValue, Couple_getValue,
 					 setKey, Couple_setKey,
 					 setValue, Couple_setValue,
-					 NULL);
+					 NULL));
 	}
 }
 
 void deallocCouple() {
-	release((void *)Couple), Couple = NULL;
-	release((void *)CoupleClass), CoupleClass = NULL;
+	if (Couple)
+		release((void *)Couple), Couple = NULL;
+	if (CoupleClass)
+		release((void *)CoupleClass), CoupleClass = NULL;
 //	free((void *)Couple), Couple = NULL;
 //	free((void *)CoupleClass), CoupleClass = NULL;
 }
@@ -151,18 +151,17 @@ static UInteger Dictionary_enumerateWithState(const void *const _self, FastEnume
 	return count;
 }
 
-const void *Dictionary = NULL;
-const void *DictionaryClass = NULL;
+CO_CLASS_STORAGE_DECL(Dictionary)
 
-void initDictionary() {
+CO_CLASS_INIT_DECL(Dictionary) {
 	initMutableArray();
 	
 	if ( ! DictionaryClass )
 		DictionaryClass = new(CollectionClass, "DictionaryClass", CollectionClass, sizeof(struct DictionaryClass),
 							  constructor, DictionaryClass_constructor,
 							  NULL);
-	if ( ! Dictionary )
-		Dictionary = new(DictionaryClass, "Dictionary", Collection, sizeof(struct Dictionary),
+	if ( CO_CLASS_PENDING(Dictionary) )
+		CO_CLASS_PUBLISH(Dictionary, new(DictionaryClass, "Dictionary", Collection, sizeof(struct Dictionary),
 						 constructor, Dictionary_constructor,
 						 
 						 /* Overrides */
@@ -175,7 +174,7 @@ void initDictionary() {
 						 objectForKey, Dictionary_objectForKey,
 						 getKeysCopy, Dictionary_getKeysCopy,
 						 getValuesCopy, Dictionary_getValuesCopy,
-						 NULL);
+						 NULL));
 }
 
 void deallocDictionary() {
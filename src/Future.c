@@ -0,0 +1,300 @@
+//
+//  Future.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <cobj.h>
+#include <Future.r>
+
+CO_CLASS_STORAGE_DECL(Future)
+
+static void * Future_constructor (void * _self, va_list * app) {
+	struct Future *self = super_constructor(Future, _self, app);
+	if ( self == NULL ) return NULL;
+	self->ready = NO;
+	self->value = NULL;
+	self->error = 0;
+	pthread_mutex_init(&(self->lock), NULL);
+	pthread_condattr_t attributes;
+	pthread_condattr_init(&attributes);
+	pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+	pthread_cond_init(&(self->completion), &attributes);
+	pthread_condattr_destroy(&attributes);
+	self->continuations = NULL;
+	self->lastContinuation = &(self->continuations);
+	return self;
+}
+
+static void * Future_destructor (void * _self) {
+	struct Future *self = super_destructor(Future, _self);
+	/* Never completed: the continuations will not run */
+	while ( self->continuations ) {
+		struct _FutureContinuation *next = self->continuations->next;
+		free(self->continuations);
+		self->continuations = next;
+	}
+	if ( self->value ) release(self->value), self->value = NULL;
+	pthread_cond_destroy(&(self->completion));
+	pthread_mutex_destroy(&(self->lock));
+	return self;
+}
+
+static void * FutureClass_constructor (void * _self, va_list *app) {
+	struct FutureClass * self = super_constructor(FutureClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) getFutureValue )
+			* (voidf *) & self->getFutureValue = method;
+		else if (selector == (voidf) isFutureReady )
+			* (voidf *) & self->isFutureReady = method;
+		else if (selector == (voidf) getFutureError )
+			* (voidf *) & self->getFutureError = method;
+		else if (selector == (voidf) thenFuture )
+			* (voidf *) & self->thenFuture = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+static void * Future_copy (const void * const _self) {
+	return retain((void *)_self);
+}
+
+/* The task of a continuation given a pool */
+static void Future_runContinuation(void *argument) {
+	struct _FutureContinuation *continuation = argument;
+	continuation->callback(continuation->future, continuation->argument);
+	release(continuation->future);
+	free(continuation);
+}
+
+static void Future_dispatch(struct Future *const self, struct _FutureContinuation *continuation) {
+	while ( continuation ) {
+		struct _FutureContinuation *next = continuation->next;
+		if ( continuation->pool ) {
+			retain(self);
+			if ( ! submitTask(continuation->pool, Future_runContinuation, continuation) )
+				Future_runContinuation(continuation);
+		}
+		else {
+			continuation->callback(self, continuation->argument);
+			free(continuation);
+		}
+		continuation = next;
+	}
+}
+
+bool FutureComplete(struct Future *const self, void *const value, int error) {
+	pthread_mutex_lock(&(self->lock));
+	if ( self->ready ) {
+		pthread_mutex_unlock(&(self->lock));
+		return errno = EALREADY, NO;
+	}
+	self->value = value ? retain(value) : NULL;
+	self->error = error;
+	__atomic_store_n(&(self->ready), YES, __ATOMIC_RELEASE);
+	struct _FutureContinuation *continuations = self->continuations;
+	self->continuations = NULL;
+	self->lastContinuation = &(self->continuations);
+	pthread_cond_broadcast(&(self->completion));
+	pthread_mutex_unlock(&(self->lock));
+
+	Future_dispatch(self, continuations);
+	return YES;
+}
+
+static ObjectRef Future_result(struct Future *const self) {
+	if ( self->error ) return errno = self->error, NULL;
+	return self->value;
+}
+
+static ObjectRef Future_getFutureValue(void *const _self, Integer timeout) {
+	struct Future *self = _self;
+	if ( __atomic_load_n(&(self->ready), __ATOMIC_ACQUIRE) )
+		return Future_result(self);
+	if ( timeout == 0 )
+		return errno = ETIMEDOUT, NULL;
+
+	struct timespec deadline;
+	if ( timeout > 0 ) {
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (timeout % 1000) * 1000000L;
+		if ( deadline.tv_nsec >= 1000000000L )
+			deadline.tv_sec++, deadline.tv_nsec -= 1000000000L;
+	}
+	int error = 0;
+	pthread_mutex_lock(&(self->lock));
+	while ( ! self->ready && error == 0 ) {
+		if ( timeout > 0 )
+			error = pthread_cond_timedwait(&(self->completion), &(self->lock), &deadline);
+		else
+			pthread_cond_wait(&(self->completion), &(self->lock));
+	}
+	bool ready = self->ready;
+	pthread_mutex_unlock(&(self->lock));
+	return ready ? Future_result(self) : (errno = ETIMEDOUT, NULL);
+}
+
+static bool Future_isFutureReady(const void *const _self) {
+	const struct Future *self = _self;
+	return __atomic_load_n(&(self->ready), __ATOMIC_ACQUIRE);
+}
+
+static int Future_getFutureError(const void *const _self) {
+	const struct Future *self = _self;
+	return __atomic_load_n(&(self->ready), __ATOMIC_ACQUIRE) ? self->error : 0;
+}
+
+static void Future_thenFuture(void *const _self, FutureCallback callback, void *const argument, ThreadPoolRef pool) {
+	struct Future *self = _self;
+	struct _FutureContinuation *continuation = malloc(sizeof(struct _FutureContinuation));
+	assert( continuation != NULL );
+	if ( continuation == NULL ) return;
+	*continuation = (struct _FutureContinuation){ self, callback, argument, pool, NULL };
+
+	pthread_mutex_lock(&(self->lock));
+	if ( ! self->ready ) {
+		*(self->lastContinuation) = continuation;
+		self->lastContinuation = &(continuation->next);
+		pthread_mutex_unlock(&(self->lock));
+		return;
+	}
+	pthread_mutex_unlock(&(self->lock));
+	Future_dispatch(self, continuation);
+}
+
+CO_CLASS_INIT_DECL(Future) {
+	if ( ! FutureClass )
+		FutureClass = new(Class, "FutureClass", Class, sizeof(struct FutureClass),
+						  constructor, FutureClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(Future) )
+		CO_CLASS_PUBLISH(Future, new(FutureClass, "Future", Object, sizeof(struct Future),
+					 constructor, Future_constructor,
+					 destructor, Future_destructor,
+
+					 /* Overrides */
+					 copy, Future_copy,
+
+					 /* new */
+					 getFutureValue, Future_getFutureValue,
+					 isFutureReady, Future_isFutureReady,
+					 getFutureError, Future_getFutureError,
+					 thenFuture, Future_thenFuture,
+					 NULL));
+}
+
+void deallocFuture() {
+	release((void *)Future), Future = NULL;
+	release((void *)FutureClass), FutureClass = NULL;
+}
+
+/* Combinators: one shared state per combined future, freed by the last continuation */
+
+struct _FutureCombination {
+	PromiseRef promise;
+	ArrayRef futures;
+	UInteger remaining;
+	UInteger continuations;
+};
+
+static void Future_endCombination(struct _FutureCombination *const combination) {
+	if ( __atomic_sub_fetch(&(combination->continuations), 1, __ATOMIC_ACQ_REL) != 0 )
+		return;
+	release(combination->promise);
+	release(combination->futures);
+	free(combination);
+}
+
+static void Future_whenAllCallback(FutureRef future, void *argument) {
+	struct _FutureCombination *combination = argument;
+	int error = getFutureError(future);
+	if ( error )
+		failPromise(combination->promise, error);
+	else if ( __atomic_sub_fetch(&(combination->remaining), 1, __ATOMIC_ACQ_REL) == 0 )
+		fulfillPromise(combination->promise, combination->futures);
+	Future_endCombination(combination);
+}
+
+static void Future_whenAnyCallback(FutureRef future, void *argument) {
+	struct _FutureCombination *combination = argument;
+	fulfillPromise(combination->promise, future);
+	Future_endCombination(combination);
+}
+
+static FutureRef Future_newCombination(const void *const futures, FutureCallback callback) {
+	const UInteger count = getCollectionCount(futures);
+	PromiseRef promise = new(Promise, NULL);
+	FutureRef future = retain(getPromiseFuture(promise));
+	if ( count == 0 ) {
+		fulfillPromise(promise, (void *)futures);
+		release(promise);
+		return future;
+	}
+
+	struct _FutureCombination *combination = malloc(sizeof(struct _FutureCombination));
+	assert( combination != NULL );
+	*combination = (struct _FutureCombination){ promise, retain((void *)futures), count, count };
+	for (UInteger i=0; i<count; i++)
+		thenFuture(getObjectAtIndex(futures, i), callback, combination, NULL);
+	return future;
+}
+
+/* API */
+
+ObjectRef getFutureValue(void *const self, Integer timeout) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct FutureClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->getFutureValue,ENOTSUP,NULL);
+	return class->getFutureValue(self, timeout);
+}
+
+bool isFutureReady(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	const struct FutureClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->isFutureReady,ENOTSUP,NO);
+	return class->isFutureReady(self);
+}
+
+int getFutureError(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,EINVAL);
+	const struct FutureClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,EINVAL);
+	COAssertNoNullOrReturn(class->getFutureError,ENOTSUP,ENOTSUP);
+	return class->getFutureError(self);
+}
+
+void thenFuture(void *const self, FutureCallback callback, void *const argument, ThreadPoolRef pool) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	COAssertNoNullOrBailOut(callback,EINVAL);
+	const struct FutureClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->thenFuture,ENOTSUP);
+	class->thenFuture(self, callback, argument, pool);
+}
+
+FutureRef newFutureWhenAll(const void *const futures) {
+	COAssertNoNullOrReturn(futures,EINVAL,NULL);
+	return Future_newCombination(futures, Future_whenAllCallback);
+}
+
+FutureRef newFutureWhenAny(const void *const futures) {
+	COAssertNoNullOrReturn(futures,EINVAL,NULL);
+	if ( getCollectionCount(futures) == 0 ) return errno = EINVAL, NULL;
+	return Future_newCombination(futures, Future_whenAnyCallback);
+}
@@ -218,6 +218,29 @@ static void * MutableArray_firstObject(const void * const _self) {
 	return (void *)item->item;
 }
 
+/* Walks the list instead of indexing it: extra[1] is the item the next batch starts at, extra[0] the count the
+ * enumeration started with, which ends it early like Array's does. */
+static UInteger MutableArray_enumerateWithState(const void *const _self, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
+	const struct Array *const self = _self;
+	const struct StoreHead *const store = getStore(self);
+	if ( state->state == 0 ) {
+		state->mutationsPointer = (UInteger *)self;
+		state->extra[0] = self->count;
+		state->extra[1] = (UInteger)( store ? store->tqh_first : NULL );
+		state->state = 1;
+	}
+	else if ( self->count != state->extra[0] )
+		return state->mutationsPointer = NULL, 0;
+	
+	state->itemsPointer = iobuffer;
+	UInteger count = 0;
+	const struct _Item *it = (const struct _Item *)state->extra[1];
+	for ( ; it != NULL && count < length; it = it->items.tqe_next, count++)
+		iobuffer[count] = (void *)it->item;
+	state->extra[1] = (UInteger)it;
+	return count;
+}
+
 static void MutableArray_removeLastObject(void * const _self) {
 	struct Array *self = _self;
 	if (self->count == 0 || self->store == NULL)
@@ -329,16 +352,15 @@ static ObjectRef MutableArray_popObject(void *const _self) {
 	return o;
 }
 
-const void * MutableArray  = NULL;
-const void * MutableArrayClass = NULL;
+CO_CLASS_STORAGE_DECL(MutableArray)
 
-void initMutableArray () {
+CO_CLASS_INIT_DECL(MutableArray) {
 	initArray();
 	if ( ! MutableArrayClass ) {
 			MutableArrayClass = new(ArrayClass, "MutableArrayClass", ArrayClass, sizeof(struct MutableArrayClass), constructor, MutableArrayClass_constructor, NULL);
 	}
-	if ( !MutableArray ) {
-		MutableArray = new(MutableArrayClass, "MutableArray", Array, sizeof(struct MutableArray),
+	if ( CO_CLASS_PENDING(MutableArray) ) {
+		CO_CLASS_PUBLISH(MutableArray, new(MutableArrayClass, "MutableArray", Array, sizeof(struct MutableArray),
 						   constructor, MutableArray_constructor,
 						   destructor, MutableArray_destructor,
 						   copy, MutableArray_copy,
@@ -350,6 +372,7 @@ void initMutableArray () {
 						   lastObject, MutableArray_lastObject,
 						   indexOfObject, MutableArray_indexOfObject,
 						   containsObject, MutableArray_arrayContainsObject,
+						   enumerateWithState, MutableArray_enumerateWithState,
 						   
 						   /* new */
 						   addObject, MutableArray_addObject,
@@ -366,7 +389,7 @@ void initMutableArray () {
 						   
 						   replaceObjectAtIndexWithObject, MutableArray_replaceObjectAtIndexWithObject,
 						   popObject, MutableArray_popObject,
-						   NULL);
+						   NULL));
 	}
 
 }
@@ -27,8 +27,7 @@
 #endif /* __MUTABLE_DICTIONARY_DEFAULT_LOAD_FACTOR */
 
 
-const void * MutableDictionary = NULL;
-const void * MutableDictionaryClass = NULL;
+CO_CLASS_STORAGE_DECL(MutableDictionary)
 
 static int __allocateLevel1(struct MutableDictionary *const self, UInteger size);
 //static void __setObjectForKey(struct MutableDictionary *const self, void *const object, const void *const key);
@@ -65,7 +64,7 @@ static void * MutableDictionary_constructor (void * _self, va_list * app) {
 	int error;
 	
 	self->loadFactor = __MUTABLE_DICTIONARY_DEFAULT_LOAD_FACTOR;
-	self->couples = new(Vector, NULL);
+	self->couples = new(Vector, 0UL, 0UL, NULL);
 	if ( self->couples == NULL ) return free(self->level1), free(self), NULL;
 	
 	/* fill the structure */
@@ -74,7 +73,7 @@ static void * MutableDictionary_constructor (void * _self, va_list * app) {
 		while ( (key = va_arg(*app, void *)) != NULL ) {
 			value = va_arg(*app, void *);
 			if (value == NULL) return release(self->couples), free(self), errno = EINVAL, NULL;
-			CoupleRef couple = new(Couple, key, value, NULL);
+			CoupleRef couple = newWithArguments(Couple, &(CoupleArguments){ key, value });
 //			insertObject(self->couples, couple), release(couple);
 			addObject(self->couples, couple), release(couple);
 		}
@@ -199,7 +198,7 @@ static int __rebuild(struct MutableDictionary *const self) {
 
 static void MutableDictionary_setObjectForKey(void *const _self, void *const object, void *const key) {
 	struct MutableDictionary *const self = _self;
-	CoupleRef couple = new(Couple, key, object, NULL);;
+	CoupleRef couple = newWithArguments(Couple, &(CoupleArguments){ key, object });
 //	UInteger newSize = __deduceSize(((struct Dictionary *)self)->count+1, self->loadFactor);
 	if ( (UInteger)(self->size * self->loadFactor) < ((struct Dictionary *)self)->count+1 ) {
 		
@@ -254,7 +253,7 @@ static void MutableDictionary_removeObjectForKey(void *const _self, void *const
 	removeObject(collisionList, couple);
 }
 
-void initMutableDictionary() {
+CO_CLASS_INIT_DECL(MutableDictionary) {
 	initCouple();
 	initDictionary();
 	initArray();
@@ -265,8 +264,8 @@ void initMutableDictionary() {
 		MutableDictionaryClass = new(DictionaryClass, "MutableDictionaryClass", DictionaryClass, sizeof(struct MutableDictionaryClass),
 							  constructor, MutableDictionaryClass_constructor, NULL);
 	}
-	if ( ! MutableDictionary ) {
-		MutableDictionary = new(MutableDictionaryClass, "MutableDictionary", Dictionary, sizeof(struct MutableDictionary),
+	if ( CO_CLASS_PENDING(MutableDictionary) ) {
+		CO_CLASS_PUBLISH(MutableDictionary, new(MutableDictionaryClass, "MutableDictionary", Dictionary, sizeof(struct MutableDictionary),
 								constructor, MutableDictionary_constructor,
 								destructor, MutableDictionary_destructor,
 								/* overrides */
@@ -276,7 +275,7 @@ void initMutableDictionary() {
 								setObjectForKey, MutableDictionary_setObjectForKey,
 								setMutableDictionaryLoadFactor, MutableDictionary_setMutableDictionaryLoadFactor,
 								removeObjectForKey, MutableDictionary_removeObjectForKey,
-								NULL);
+								NULL));
 	}
 }
 
@@ -284,8 +283,10 @@ void deallocMutableDictionary() {
 //	free((void *)MutableDictionary), MutableDictionary = NULL;
 //	free((void *)MutableDictionaryClass), MutableDictionaryClass = NULL;;
 
-	release((void *)MutableDictionary), MutableDictionary = NULL;
-	release((void *)MutableDictionaryClass), MutableDictionaryClass = NULL;
+	if (MutableDictionary)
+		release((void *)MutableDictionary), MutableDictionary = NULL;
+	if (MutableDictionaryClass)
+		release((void *)MutableDictionaryClass), MutableDictionaryClass = NULL;
 	deallocVector();
 	deallocArray();
 	deallocMutableArray();
@@ -11,12 +11,12 @@
 #include <string.h>
 #include <stdarg.h>
 #include <errno.h>
+#include <memory_management/memory_management.h>
 
 #include <cobj.h>
 #include <MutableString.r>
 
-const void * MutableString = NULL;
-const void * MutableStringClass = NULL;
+CO_CLASS_STORAGE_DECL(MutableString)
 
 static int __grow(struct MutableString *const self, UInteger minCapacity) {
 	// overflow-conscious code
@@ -31,6 +31,9 @@ static int __grow(struct MutableString *const self, UInteger minCapacity) {
 	else {
 		newCapacity = self->capacity * 2;
 	}
+	/* doubling may not be enough for a long append */
+	if (newCapacity < minCapacity)
+		newCapacity = minCapacity;
 
 	const void *newText = realloc((void *)stringSelf->text, newCapacity * sizeof(char) );
 	if ( newText == NULL ) return -1;
@@ -49,6 +52,14 @@ inline static int __ensureCapacity(struct MutableString *const self, UInteger mi
 static void * MutableString_constructor (void * _self, va_list * app) {
 	struct MutableString *self = super_constructor(MutableString, _self, app);
 	if ( self == NULL ) return NULL;
+	struct String *stringSelf = (struct String *)self;
+	/* A NULL text still gets an empty buffer, so every mutator may write through text */
+	if ( stringSelf->text == NULL ) {
+		char *text = malloc(1);
+		if ( text == NULL ) return MEMORY_MANAGEMENT_RELEASE(self), errno = ENOMEM, NULL;
+		text[0] = '\0';
+		stringSelf->text = text;
+	}
 	self->capacity = getStringLength(self) + 1;
 	return self;
 }
@@ -71,6 +82,12 @@ static void * MutableStringClass_constructor (void * _self, va_list *app) {
 		
 		else if (selector == (voidf) appendFormat )
 			* (voidf *) & self->appendFormat = method;
+		else if (selector == (voidf) appendBytes )
+			* (voidf *) & self->appendBytes = method;
+		else if (selector == (voidf) appendCharacter )
+			* (voidf *) & self->appendCharacter = method;
+		else if (selector == (voidf) reserveMutableStringCapacity )
+			* (voidf *) & self->reserveMutableStringCapacity = method;
 		
 		else if (selector == (voidf) setString )
 			* (voidf *) & self->setString = method;
@@ -91,29 +108,56 @@ static void * MutableString_copy (const void * const _self) {
 	return new(MutableString, getStringText(self), NULL);
 }
 
-static bool MutableString_equals (const void * const _self, const void *const _other) {
-	const struct String *self = _self;
-	const struct String *other = _other;
-	int result = ( _self == _other );
-	if ( ! result && (getStringLength(self) == getStringLength(other)) && self->text && other->text)
-		result = (strcmp(self->text, other->text) == 0);
-	return result;
+/* Copies length bytes at the end of self: the text is written at the known length instead of being rescanned */
+static void MutableString_appendBytes(void *const _self, const void *const bytes, UInteger length) {
+	struct MutableString *self = _self;
+	struct String *stringSelf = _self;
+	UInteger selfLength = stringSelf->length;
+	
+	if ( UIntegerMax - selfLength <= length ) { errno = ENOMEM; return; };
+	/* bytes may lie in the text of self, which growing moves */
+	const char *selfText = stringSelf->text;
+	bool inside = ( selfText && (const char *)bytes >= selfText && (const char *)bytes < selfText + self->capacity );
+	UInteger offset = inside ? (UInteger)((const char *)bytes - selfText) : 0;
+	if ( __ensureCapacity(self, selfLength + length + 1) == -1 ) { errno = ENOMEM; return; };
+	
+	char *text = (char *)stringSelf->text;
+	memmove(text + selfLength, inside ? text + offset : bytes, length);
+	text[selfLength + length] = '\0';
+	stringSelf->length += length;
+	stringSelf->_hash = 0;
 }
 
-static void MutableString_appendString(void *const _self, const void *const _other) {
+static void MutableString_appendCharacter(void *const _self, char character) {
 	struct MutableString *self = _self;
 	struct String *stringSelf = _self;
-	const struct MutableString *other = _other;
-	const char *otherText = getStringText(other);
-	
-	UInteger selfLength = getStringLength(self);
-	UInteger otherLength = getStringLength(other);
+	UInteger selfLength = stringSelf->length;
 	
-	if ( __ensureCapacity(self, selfLength + otherLength + 1) == -1 ) { errno = ENOMEM; return; };
+	if ( __ensureCapacity(self, selfLength + 2) == -1 ) { errno = ENOMEM; return; };
 	
-	char *selfText = (char *)getStringText(self);
-	strncat(selfText, otherText, otherLength);
-	stringSelf->length += otherLength;
+	char *text = (char *)stringSelf->text;
+	text[selfLength] = character;
+	text[selfLength + 1] = '\0';
+	stringSelf->length++;
+	stringSelf->_hash = 0;
+}
+
+static void MutableString_reserveMutableStringCapacity(void *const _self, UInteger capacity) {
+	struct MutableString *self = _self;
+	if ( capacity == UIntegerMax ) { errno = ENOMEM; return; };
+	/* The terminator is not part of the requested capacity */
+	if ( capacity + 1 > self->capacity ) {
+		const void *newText = realloc((void *)((struct String *)self)->text, (capacity + 1) * sizeof(char));
+		if ( newText == NULL ) { errno = ENOMEM; return; };
+		self->capacity = capacity + 1;
+		((struct String *)self)->text = newText;
+	}
+}
+
+static void MutableString_appendString(void *const _self, const void *const _other) {
+	UInteger otherLength = getStringLength(_other);
+	if ( otherLength == 0 ) return;
+	MutableString_appendBytes(_self, getStringText(_other), otherLength);
 }
 
 static UInteger MutableString_getStringLength (const void *const _self) {
@@ -121,43 +165,41 @@ static UInteger MutableString_getStringLength (const void *const _self) {
 	return self->length;
 }
 
-static void MutableString_appendFormat(void *const self, char *format, va_list *app) {
-	struct String *stringSelf = self;
-	char *selfText = NULL;
-	UInteger selfLength = getStringLength(self);
+static void MutableString_appendFormat(void *const _self, char *format, va_list *app) {
+	struct MutableString *self = _self;
+	struct String *stringSelf = _self;
+	UInteger selfLength = stringSelf->length;
 	
+	/* Formats straight into the spare capacity, formatting a second time only when it does not fit */
 	va_list copy;
 	va_copy(copy, *app);
-	int totalWritten = vsnprintf(NULL, 0, format, copy);
-	char *text = calloc((UInteger)totalWritten+1, sizeof(char));
-	if ( text == NULL ) { errno = ENOMEM, va_end(copy); return; }
-	if ( __ensureCapacity(self, selfLength + (UInteger)totalWritten + 1) == -1 ) {
-		errno = ENOMEM, va_end(copy), free(text); return; 
-	};
-	selfText = (char *)getStringText(self);
-	
-	vsnprintf(text, totalWritten+1, format, *app);
-	strncat(selfText, text, totalWritten);
-
+	int totalWritten = vsnprintf((char *)stringSelf->text + selfLength, self->capacity - selfLength, format, *app);
+	if ( totalWritten < 0 ) { errno = EINVAL, va_end(copy); return; }
+	if ( selfLength + (UInteger)totalWritten + 1 > self->capacity ) {
+		if ( __ensureCapacity(self, selfLength + (UInteger)totalWritten + 1) == -1 ) {
+			/* the first pass may have truncated into the spare capacity */
+			((char *)stringSelf->text)[selfLength] = '\0';
+			errno = ENOMEM, va_end(copy); return;
+		};
+		vsnprintf((char *)stringSelf->text + selfLength, (UInteger)totalWritten + 1, format, copy);
+	}
 	stringSelf->length += (UInteger)totalWritten;
-	
-	free(text), va_end(copy);
+	stringSelf->_hash = 0;
+	va_end(copy);
 }
 
 static void MutableString_setString(void *const _self, const void *const other) {
 	struct MutableString *self = _self;
 	struct String *stringSelf = _self;
+	if ( _self == other ) return;
 	
-	char *text = strdup(getStringText(other));
-	if ( text == NULL ) { return; }
-	
-	free((char *)getStringText(self)), stringSelf->text = NULL;
-	stringSelf->text = text;
-	
+	/* Reuses the capacity of self, other may be a slice of it */
 	UInteger otherLength = getStringLength(other);
-	stringSelf->length = otherLength;
-	self->capacity = otherLength + 1;
+	stringSelf->length = 0;
+	stringSelf->_hash = 0;
 	self->offset = 0;
+	if ( otherLength == 0 ) { ((char *)stringSelf->text)[0] = '\0'; return; }
+	MutableString_appendBytes(self, getStringText(other), otherLength);
 }
 
 static void MutableString_setMutableStringLength(void *const _self, UInteger capacity) {
@@ -176,6 +218,7 @@ static void MutableString_setMutableStringLength(void *const _self, UInteger cap
 		text[capacity] = '\0';
 		stringSelf->text = text;
 		stringSelf->length = capacity;
+		stringSelf->_hash = 0;
 	}
 	
 	self->capacity = capacity+1;
@@ -196,10 +239,11 @@ static int MutableString_insertStringAtMutableStringIndex(void *const _self, con
 	char *selfText = (char *)getStringText(self);
 	char *otherText = (char *)getStringText(other);
 	
-	memmove(selfText+(index+otherLength), selfText+index, selfLength-(index-otherLength));
+	memmove(selfText+(index+otherLength), selfText+index, selfLength-index+1);
 	strncpy(selfText+index, otherText, otherLength);
 	
 	stringSelf->length += otherLength;
+	stringSelf->_hash = 0;
 	
 	return 0;
 }
@@ -215,42 +259,47 @@ static int MutableString_deleteMutableStringCharactersInRange(void *const _self,
 	
 	memmove(selfText+range.location, selfText+MaxRange(range), selfLength-MaxRange(range)+1);
 	stringSelf->length -= range.length;
+	stringSelf->_hash = 0;
 	
 	return -1;
 }
 
 
-void initMutableString() {
+CO_CLASS_INIT_DECL(MutableString) {
 	initString();
 	
 	if ( ! MutableStringClass )
 		MutableStringClass = new(StringClass, "MutableStringClass", StringClass, sizeof(struct MutableStringClass),
 						 constructor, MutableStringClass_constructor, NULL);
-	if ( ! MutableString )
-		MutableString = new(MutableStringClass, "MutableString", String, sizeof(struct MutableString),
+	if ( CO_CLASS_PENDING(MutableString) )
+		CO_CLASS_PUBLISH(MutableString, new(MutableStringClass, "MutableString", String, sizeof(struct MutableString),
 					constructor, MutableString_constructor,
 					destructor, MutableString_destructor,
 					
 					/* Overrides */
 					copy, MutableString_copy,
-					equals, MutableString_equals,
 					getStringLength, MutableString_getStringLength,
 					
 					/* new */
 					appendString, MutableString_appendString,
 					appendFormat, MutableString_appendFormat,
+					appendBytes, MutableString_appendBytes,
+					appendCharacter, MutableString_appendCharacter,
+					reserveMutableStringCapacity, MutableString_reserveMutableStringCapacity,
 					setString, MutableString_setString,
 					setMutableStringLength, MutableString_setMutableStringLength,
 					insertStringAtMutableStringIndex, MutableString_insertStringAtMutableStringIndex,
 					deleteMutableStringCharactersInRange, MutableString_deleteMutableStringCharactersInRange,
-					NULL);
+					NULL));
 }
 
 void deallocMutableString() {
 //	free((void *)MutableString), MutableString = NULL;
 //	free((void *)MutableStringClass), MutableStringClass = NULL;
-	release((void *)MutableString), MutableString = NULL;
-	release((void *)MutableStringClass), MutableStringClass = NULL;
+	if (MutableString)
+		release((void *)MutableString), MutableString = NULL;
+	if (MutableStringClass)
+		release((void *)MutableStringClass), MutableStringClass = NULL;
 	deallocString();
 }
 
@@ -282,6 +331,34 @@ void appendFormat(void *const self, char *format, ...) {
 	va_end(ap);
 }
 
+void appendBytes(void *const self, const void *const bytes, UInteger length) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	COAssertNoNullOrBailOut(bytes,EINVAL);
+	
+	const struct MutableStringClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->appendBytes,ENOTSUP);
+	class->appendBytes(self, bytes, length);
+}
+
+void appendCharacter(void *const self, char character) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	
+	const struct MutableStringClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->appendCharacter,ENOTSUP);
+	class->appendCharacter(self, character);
+}
+
+void reserveMutableStringCapacity(void *const self, UInteger capacity) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	
+	const struct MutableStringClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->reserveMutableStringCapacity,ENOTSUP);
+	class->reserveMutableStringCapacity(self, capacity);
+}
+
 
 void setString(void *const self, const void *const other) {
 	COAssertNoNullOrBailOut(self,EINVAL);
@@ -0,0 +1,127 @@
+//
+//  Promise.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <Promise.r>
+
+CO_CLASS_STORAGE_DECL(Promise)
+
+static void * Promise_constructor (void * _self, va_list * app) {
+	/* Created before the object is set up, so that giving it back does not run its destructor */
+	FutureRef future = new(Future, NULL);
+	if ( future == NULL ) return MEMORY_MANAGEMENT_RELEASE(_self), NULL;
+	struct Promise *self = super_constructor(Promise, _self, app);
+	self->future = future;
+	return self;
+}
+
+static void * Promise_destructor (void * _self) {
+	struct Promise *self = super_destructor(Promise, _self);
+	/* A broken promise: nobody will complete the future any more */
+	if ( ! isFutureReady(self->future) )
+		FutureComplete(self->future, NULL, ECANCELED);
+	release(self->future), self->future = NULL;
+	return self;
+}
+
+static void * PromiseClass_constructor (void * _self, va_list *app) {
+	struct PromiseClass * self = super_constructor(PromiseClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) getPromiseFuture )
+			* (voidf *) & self->getPromiseFuture = method;
+		else if (selector == (voidf) fulfillPromise )
+			* (voidf *) & self->fulfillPromise = method;
+		else if (selector == (voidf) failPromise )
+			* (voidf *) & self->failPromise = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+static void * Promise_copy (const void * const _self) {
+	return NULL;
+}
+
+static FutureRef Promise_getPromiseFuture(const void *const _self) {
+	const struct Promise *self = _self;
+	return self->future;
+}
+
+static bool Promise_fulfillPromise(void *const _self, void *const value) {
+	struct Promise *self = _self;
+	return FutureComplete(self->future, value, 0);
+}
+
+static bool Promise_failPromise(void *const _self, int error) {
+	struct Promise *self = _self;
+	return FutureComplete(self->future, NULL, error);
+}
+
+CO_CLASS_INIT_DECL(Promise) {
+	initFuture();
+
+	if ( ! PromiseClass )
+		PromiseClass = new(Class, "PromiseClass", Class, sizeof(struct PromiseClass),
+						   constructor, PromiseClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(Promise) )
+		CO_CLASS_PUBLISH(Promise, new(PromiseClass, "Promise", Object, sizeof(struct Promise),
+					  constructor, Promise_constructor,
+					  destructor, Promise_destructor,
+
+					  /* Overrides */
+					  copy, Promise_copy,
+
+					  /* new */
+					  getPromiseFuture, Promise_getPromiseFuture,
+					  fulfillPromise, Promise_fulfillPromise,
+					  failPromise, Promise_failPromise,
+					  NULL));
+}
+
+void deallocPromise() {
+	release((void *)Promise), Promise = NULL;
+	release((void *)PromiseClass), PromiseClass = NULL;
+}
+
+/* API */
+
+FutureRef getPromiseFuture(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct PromiseClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->getPromiseFuture,ENOTSUP,NULL);
+	return class->getPromiseFuture(self);
+}
+
+bool fulfillPromise(void *const self, void *const value) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(value,EINVAL,NO);
+	const struct PromiseClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->fulfillPromise,ENOTSUP,NO);
+	return class->fulfillPromise(self, value);
+}
+
+bool failPromise(void *const self, int error) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	if ( error == 0 ) return errno = EINVAL, NO;
+	const struct PromiseClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->failPromise,ENOTSUP,NO);
+	return class->failPromise(self, error);
+}
@@ -0,0 +1,190 @@
+//
+//  Queue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <Queue.r>
+
+CO_CLASS_STORAGE_DECL(Queue)
+
+static void * Queue_constructor (void * _self, va_list * app) {
+	UInteger capacity = va_arg(*app, UInteger);
+	/* Past this the rounded up size overflows. Checked before the object is set up, so that giving it back does not
+	 * run its destructor */
+	if ( capacity > UIntegerMax / 2 + 1 )
+		return MEMORY_MANAGEMENT_RELEASE(_self), errno = EINVAL, NULL;
+	struct Queue *self = super_constructor(Queue, _self, app);
+
+	UInteger size = 2;
+	while ( size < capacity )
+		size <<= 1;
+
+	self->mask = size - 1;
+	self->waitingProducers = self->waitingConsumers = 0;
+	pthread_mutex_init(&(self->parking), NULL);
+	pthread_cond_init(&(self->notFull), NULL);
+	pthread_cond_init(&(self->notEmpty), NULL);
+	return self;
+}
+
+static void * Queue_destructor (void * _self) {
+	struct Queue *self = super_destructor(Queue, _self);
+	pthread_cond_destroy(&(self->notEmpty));
+	pthread_cond_destroy(&(self->notFull));
+	pthread_mutex_destroy(&(self->parking));
+	return self;
+}
+
+static void * QueueClass_constructor (void * _self, va_list *app) {
+	struct QueueClass * self = super_constructor(QueueClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) tryEnqueueObject )
+			* (voidf *) & self->tryEnqueueObject = method;
+		else if (selector == (voidf) tryDequeueObject )
+			* (voidf *) & self->tryDequeueObject = method;
+		else if (selector == (voidf) tryEnqueueObjects )
+			* (voidf *) & self->tryEnqueueObjects = method;
+		else if (selector == (voidf) tryDequeueObjects )
+			* (voidf *) & self->tryDequeueObjects = method;
+		else if (selector == (voidf) enqueueObject )
+			* (voidf *) & self->enqueueObject = method;
+		else if (selector == (voidf) dequeueObject )
+			* (voidf *) & self->dequeueObject = method;
+		else if (selector == (voidf) getQueueCapacity )
+			* (voidf *) & self->getQueueCapacity = method;
+		else if (selector == (voidf) getQueueCount )
+			* (voidf *) & self->getQueueCount = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+static void * Queue_copy (const void * const _self) {
+	return NULL;
+}
+
+/* Wakes the threads parked on condition, if any, after count objects changed hands */
+void QueueWake(struct Queue *const self, UInteger *const waiting, pthread_cond_t *const condition, UInteger count) {
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if ( __atomic_load_n(waiting, __ATOMIC_RELAXED) == 0 )
+		return;
+	pthread_mutex_lock(&(self->parking));
+	if ( count > 1 )
+		pthread_cond_broadcast(condition);
+	else
+		pthread_cond_signal(condition);
+	pthread_mutex_unlock(&(self->parking));
+}
+
+static UInteger Queue_getQueueCapacity(const void *const _self) {
+	const struct Queue *self = _self;
+	return self->mask + 1;
+}
+
+CO_CLASS_INIT_DECL(Queue) {
+	if ( ! QueueClass )
+		QueueClass = new(Class, "QueueClass", Class, sizeof(struct QueueClass),
+						 constructor, QueueClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(Queue) )
+		CO_CLASS_PUBLISH(Queue, new(QueueClass, "Queue", Object, sizeof(struct Queue),
+					   constructor, Queue_constructor,
+					   destructor, Queue_destructor,
+
+					   /* Overrides */
+					   copy, Queue_copy,
+
+					   /* new */
+					   getQueueCapacity, Queue_getQueueCapacity,
+					   NULL));
+}
+
+void deallocQueue() {
+	release((void *)Queue), Queue = NULL;
+	release((void *)QueueClass), QueueClass = NULL;
+}
+
+/* API */
+
+bool tryEnqueueObject(void *const self, void *const object) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(object,EINVAL,NO);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->tryEnqueueObject,ENOTSUP,NO);
+	return class->tryEnqueueObject(self, object);
+}
+
+ObjectRef tryDequeueObject(void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->tryDequeueObject,ENOTSUP,NULL);
+	return class->tryDequeueObject(self);
+}
+
+UInteger tryEnqueueObjects(void *const self, void *const objects[], UInteger count) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	COAssertNoNullOrReturn(objects,EINVAL,0);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->tryEnqueueObjects,ENOTSUP,0);
+	return class->tryEnqueueObjects(self, objects, count);
+}
+
+UInteger tryDequeueObjects(void *const self, ObjectRef objects[], UInteger count) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	COAssertNoNullOrReturn(objects,EINVAL,0);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->tryDequeueObjects,ENOTSUP,0);
+	return class->tryDequeueObjects(self, objects, count);
+}
+
+void enqueueObject(void *const self, void *const object) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	COAssertNoNullOrBailOut(object,EINVAL);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->enqueueObject,ENOTSUP);
+	class->enqueueObject(self, object);
+}
+
+ObjectRef dequeueObject(void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->dequeueObject,ENOTSUP,NULL);
+	return class->dequeueObject(self);
+}
+
+UInteger getQueueCapacity(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getQueueCapacity,ENOTSUP,0);
+	return class->getQueueCapacity(self);
+}
+
+UInteger getQueueCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct QueueClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getQueueCount,ENOTSUP,0);
+	return class->getQueueCount(self);
+}
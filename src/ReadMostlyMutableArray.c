@@ -0,0 +1,262 @@
+//
+//  ReadMostlyMutableArray.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <ReadMostlyMutableArray.r>
+
+/* Copy on write with epoch based reclamation. The contents live in the ConcurrentMutableArray we inherit from and every
+ * modification goes through it, then publishes a fresh Array snapshot. A reader announces itself by incrementing, in
+ * the slot of its thread, the counter of the parity of the current epoch before loading the snapshot. After swapping
+ * the snapshot a writer flips the epoch and waits for the counters of the old parity to drain, twice, so that a reader
+ * which loaded the epoch before the previous flip is waited for too. Only then is the replaced snapshot released. */
+
+CO_CLASS_STORAGE_DECL(ReadMostlyMutableArray)
+
+#define ReadMostlyMutableArraySuper ((const struct ConcurrentMutableArrayClass *)ConcurrentMutableArray)
+
+static UInteger ReadMostlyMutableArrayNextSlot = 0;
+static __thread UInteger ReadMostlyMutableArraySlot = 0;
+
+#ifdef __PROFILING__
+static UInteger ReadMostlyMutableArray_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UInteger)ts.tv_sec * 1000000000UL + (UInteger)ts.tv_nsec;
+}
+#endif
+
+/* Threads are given slots round robin the first time they read any ReadMostlyMutableArray */
+static struct _ReadMostlyReaderSlot * ReadMostlyMutableArray_slot(struct ReadMostlyMutableArray *const self) {
+	if ( ReadMostlyMutableArraySlot == 0 )
+		ReadMostlyMutableArraySlot = __atomic_add_fetch(&ReadMostlyMutableArrayNextSlot, 1, __ATOMIC_RELAXED);
+	return &(self->slots[ReadMostlyMutableArraySlot % self->slotCount]);
+}
+
+static UInteger * ReadMostlyMutableArray_enter(struct ReadMostlyMutableArray *const self) {
+	struct _ReadMostlyReaderSlot *const slot = ReadMostlyMutableArray_slot(self);
+	UInteger *const readers = &(slot->readers[__atomic_load_n(&(self->epoch), __ATOMIC_ACQUIRE) & 1]);
+	__atomic_add_fetch(readers, 1, __ATOMIC_SEQ_CST);
+	return readers;
+}
+
+static void ReadMostlyMutableArray_exit(UInteger *const readers) {
+	__atomic_sub_fetch(readers, 1, __ATOMIC_RELEASE);
+}
+
+static struct Array * ReadMostlyMutableArray_snapshot(struct ReadMostlyMutableArray *const self) {
+	return __atomic_load_n(&(self->snapshot), __ATOMIC_SEQ_CST);
+}
+
+/* Flips the epoch and waits until no reader is left in the previous one */
+static void ReadMostlyMutableArray_flip(struct ReadMostlyMutableArray *const self) {
+	UInteger previous = __atomic_fetch_add(&(self->epoch), 1, __ATOMIC_SEQ_CST) & 1;
+	for (UInteger i=0; i<self->slotCount; i++)
+		while ( __atomic_load_n(&(self->slots[i].readers[previous]), __ATOMIC_SEQ_CST) != 0 )
+			sched_yield();
+}
+
+/* A flat Array of the current contents, enumerated in one pass under the lock of the ConcurrentMutableArray */
+static struct Array * ReadMostlyMutableArray_newSnapshot(struct ReadMostlyMutableArray *const self) {
+	const struct ConcurrentMutableArrayClass *const class = classOf(self);
+	struct Array *const snapshot = new(Array, NULL);
+
+	ConcurrentMutableArrayLock((struct ConcurrentMutableArray *)self);
+	const UInteger count = class->unlockedGetCollectionCount(self);
+	struct _Bucket *const buckets = count ? calloc(count, sizeof(struct _Bucket)) : NULL;
+	assert( count == 0 || buckets != NULL );
+
+	UInteger i = 0;
+	if ( buckets != NULL ) {
+		FastEnumerationState state;
+		memset(&state, 0, sizeof(FastEnumerationState));
+		void *batch[16];
+		UInteger enumerated = 0;
+		while ( (enumerated = class->unlockedEnumerateWithState(self, &state, batch, 16)) )
+			for (UInteger j=0; j<enumerated; j++)
+				buckets[i++].item = retain(state.itemsPointer[j]);
+	}
+	ConcurrentMutableArrayUnlock((struct ConcurrentMutableArray *)self);
+
+	snapshot->store = buckets;
+	snapshot->count = i;
+	return snapshot;
+}
+
+/* Makes the current contents visible to readers, returns once nobody reads the replaced snapshot any more */
+static void ReadMostlyMutableArray_publish(struct ReadMostlyMutableArray *const self) {
+	pthread_mutex_lock(&(self->publishing));
+	struct Array *const replaced = __atomic_exchange_n(&(self->snapshot), ReadMostlyMutableArray_newSnapshot(self), __ATOMIC_SEQ_CST);
+#ifdef __PROFILING__
+	UInteger start = ReadMostlyMutableArray_now();
+#endif
+	ReadMostlyMutableArray_flip(self);
+	ReadMostlyMutableArray_flip(self);
+#ifdef __PROFILING__
+	self->publications++;
+	self->gracePeriodTime += ReadMostlyMutableArray_now() - start;
+#endif
+	pthread_mutex_unlock(&(self->publishing));
+	release(replaced);
+}
+
+static void * ReadMostlyMutableArray_constructor (void * _self, va_list * app) {
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	UInteger slotCount = processors > 0 ? (UInteger)processors : 1;
+	/* Allocated before the object is set up, so that giving it back does not run its destructor */
+	struct _ReadMostlyReaderSlot *slots = calloc(slotCount, sizeof(struct _ReadMostlyReaderSlot));
+	assert( slots != NULL );
+	if ( slots == NULL ) return MEMORY_MANAGEMENT_RELEASE(_self), errno = ENOMEM, NULL;
+	struct ReadMostlyMutableArray *self = super_constructor(ReadMostlyMutableArray, _self, app);
+	if ( self == NULL ) return free(slots), NULL;
+	self->slots = slots;
+	self->slotCount = slotCount;
+	self->epoch = 0;
+	pthread_mutex_init(&(self->publishing), NULL);
+#ifdef __PROFILING__
+	self->publications = self->gracePeriodTime = 0;
+#endif
+	self->snapshot = ReadMostlyMutableArray_newSnapshot(self);
+	return self;
+}
+
+static void * ReadMostlyMutableArray_destructor (void * _self) {
+	/* Emptying the contents may still publish */
+	struct ReadMostlyMutableArray *self = super_destructor(ReadMostlyMutableArray, _self);
+	release(self->snapshot), self->snapshot = NULL;
+	free(self->slots), self->slots = NULL;
+	pthread_mutex_destroy(&(self->publishing));
+	return self;
+}
+
+static UInteger ReadMostlyMutableArray_getCollectionCount(const void *const _self) {
+	struct ReadMostlyMutableArray *self = (struct ReadMostlyMutableArray *)_self;
+	UInteger *const readers = ReadMostlyMutableArray_enter(self);
+	UInteger count = ReadMostlyMutableArray_snapshot(self)->count;
+	ReadMostlyMutableArray_exit(readers);
+	return count;
+}
+
+static ObjectRef ReadMostlyMutableArray_getObjectAtIndex(const void *const _self, UInteger index) {
+	struct ReadMostlyMutableArray *self = (struct ReadMostlyMutableArray *)_self;
+	UInteger *const readers = ReadMostlyMutableArray_enter(self);
+	const struct Array *const snapshot = ReadMostlyMutableArray_snapshot(self);
+	ObjectRef o = NULL;
+	if ( index < snapshot->count )
+		o = (ObjectRef)((const struct _Bucket *)snapshot->store)[index].item;
+	ReadMostlyMutableArray_exit(readers);
+	if ( o == NULL ) errno = EINVAL;
+	return o;
+}
+
+static void * ReadMostlyMutableArray_copy(const void *const _self) {
+	struct ReadMostlyMutableArray *self = (struct ReadMostlyMutableArray *)_self;
+	UInteger *const readers = ReadMostlyMutableArray_enter(self);
+	MutableArrayRef copy = newMutableArrayFromArray(ReadMostlyMutableArray_snapshot(self));
+	ReadMostlyMutableArray_exit(readers);
+	return copy;
+}
+
+static void ReadMostlyMutableArray_addObject(void *const _self, void *const object) {
+	ReadMostlyMutableArraySuper->isa.addObject(_self, object);
+	ReadMostlyMutableArray_publish(_self);
+}
+
+static void ReadMostlyMutableArray_insertObject(void *const _self, void *const object) {
+	ReadMostlyMutableArraySuper->isa.insertObject(_self, object);
+	ReadMostlyMutableArray_publish(_self);
+}
+
+static void ReadMostlyMutableArray_insertObjectAtIndex(void *const _self, void *const object, UInteger index) {
+	ReadMostlyMutableArraySuper->isa.insertObjectAtIndex(_self, object, index);
+	ReadMostlyMutableArray_publish(_self);
+}
+
+static void ReadMostlyMutableArray_removeObjectAtIndex(void *const _self, UInteger index) {
+	ReadMostlyMutableArraySuper->isa.removeObjectAtIndex(_self, index);
+	ReadMostlyMutableArray_publish(_self);
+}
+
+static ObjectRef ReadMostlyMutableArray_popObject(void *const _self) {
+	ObjectRef o = ReadMostlyMutableArraySuper->isa.popObject(_self);
+	if ( o != NULL )
+		ReadMostlyMutableArray_publish(_self);
+	return o;
+}
+
+static ObjectRef ReadMostlyMutableArray_popObjectWaiting(void *const _self, Integer timeout) {
+	ObjectRef o = ReadMostlyMutableArraySuper->popObjectWaiting(_self, timeout);
+	if ( o != NULL )
+		ReadMostlyMutableArray_publish(_self);
+	return o;
+}
+
+static UInteger ReadMostlyMutableArray_drainObjectsIntoArray(void *const _self, void *const array, UInteger max) {
+	UInteger count = ReadMostlyMutableArraySuper->drainObjectsIntoArray(_self, array, max);
+	if ( count > 0 )
+		ReadMostlyMutableArray_publish(_self);
+	return count;
+}
+
+CO_CLASS_INIT_DECL(ReadMostlyMutableArray) {
+	initConcurrentMutableArray();
+
+	if ( ! ReadMostlyMutableArrayClass )
+		ReadMostlyMutableArrayClass = new(ConcurrentMutableArrayClass, "ReadMostlyMutableArrayClass", ConcurrentMutableArrayClass, sizeof(struct ReadMostlyMutableArrayClass), NULL);
+	if ( CO_CLASS_PENDING(ReadMostlyMutableArray) )
+		CO_CLASS_PUBLISH(ReadMostlyMutableArray, new(ReadMostlyMutableArrayClass, "ReadMostlyMutableArray", ConcurrentMutableArray, sizeof(struct ReadMostlyMutableArray),
+									 constructor, ReadMostlyMutableArray_constructor,
+									 destructor, ReadMostlyMutableArray_destructor,
+
+									 /* Overrides */
+									 copy, ReadMostlyMutableArray_copy,
+
+									 getCollectionCount, ReadMostlyMutableArray_getCollectionCount,
+									 getObjectAtIndex, ReadMostlyMutableArray_getObjectAtIndex,
+
+									 addObject, ReadMostlyMutableArray_addObject,
+									 insertObject, ReadMostlyMutableArray_insertObject,
+									 insertObjectAtIndex, ReadMostlyMutableArray_insertObjectAtIndex,
+									 removeObjectAtIndex, ReadMostlyMutableArray_removeObjectAtIndex,
+									 popObject, ReadMostlyMutableArray_popObject,
+									 popObjectWaiting, ReadMostlyMutableArray_popObjectWaiting,
+									 drainObjectsIntoArray, ReadMostlyMutableArray_drainObjectsIntoArray,
+									 NULL));
+}
+
+void deallocReadMostlyMutableArray() {
+	release((void *)ReadMostlyMutableArray), ReadMostlyMutableArray = NULL;
+	release((void *)ReadMostlyMutableArrayClass), ReadMostlyMutableArrayClass = NULL;
+}
+
+#ifdef __PROFILING__
+void ReadMostlyMutableArrayGetStatistics(const void *const _self, UInteger *const publications, UInteger *const gracePeriodTime) {
+	COAssertNoNullOrBailOut(_self,EINVAL);
+	struct ReadMostlyMutableArray *self = (struct ReadMostlyMutableArray *)_self;
+
+	pthread_mutex_lock(&(self->publishing));
+	if ( publications ) *publications = self->publications;
+	if ( gracePeriodTime ) *gracePeriodTime = self->gracePeriodTime;
+	pthread_mutex_unlock(&(self->publishing));
+}
+
+void ReadMostlyMutableArrayPrintfStatistics(const void *const self) {
+	UInteger publications = 0, gracePeriodTime = 0;
+	ReadMostlyMutableArrayGetStatistics(self, &publications, &gracePeriodTime);
+	printf("ReadMostlyMutableArray Statistics{ publications:[%lu], gracePeriodTime:[%lu ns], meanGracePeriodTime:[%lu ns]}\n", publications, gracePeriodTime, publications ? gracePeriodTime/publications : 0);
+}
+#endif
@@ -0,0 +1,598 @@
+//
+//  Rope.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <Rope.r>
+#include <StringSlice.r>
+
+CO_CLASS_STORAGE_DECL(Rope)
+
+/* Nodes */
+
+static inline UInteger Rope_length(const struct _RopeNode *const node) {
+	return node ? node->length : 0;
+}
+
+static inline UInteger Rope_count(const struct _RopeNode *const node) {
+	return node ? node->count : 0;
+}
+
+static inline void Rope_update(struct _RopeNode *const node) {
+	node->length = Rope_length(node->left) + node->range.length + Rope_length(node->right);
+	node->count = Rope_count(node->left) + 1 + Rope_count(node->right);
+}
+
+static inline const char * Rope_chunkText(const struct _RopeNode *const node) {
+	return (const char *)((const struct String *)node->chunk)->text + node->range.location;
+}
+
+/* xorshift64* */
+static UInteger Rope_nextPriority(struct Rope *const self) {
+	UInteger x = self->seed;
+	x ^= x >> 12, x ^= x << 25, x ^= x >> 27;
+	self->seed = x;
+	return x * 0x2545F4914F6CDD1DULL;
+}
+
+/* A node of range of chunk, which it retains */
+static struct _RopeNode * Rope_newNode(const void *const chunk, Range range, UInteger priority) {
+	struct _RopeNode *node = calloc(1, sizeof(struct _RopeNode));
+	if ( node == NULL ) return errno = ENOMEM, NULL;
+	node->chunk = retain((void *)chunk);
+	node->range = range;
+	node->priority = priority;
+	Rope_update(node);
+	return node;
+}
+
+static void Rope_freeNodes(struct _RopeNode *node) {
+	while ( node ) {
+		struct _RopeNode *right = node->right;
+		Rope_freeNodes(node->left);
+		release(node->chunk);
+		free(node);
+		node = right;
+	}
+}
+
+/* The same tree, sharing the chunks */
+static struct _RopeNode * Rope_cloneNodes(const struct _RopeNode *const node) {
+	if ( node == NULL ) return NULL;
+	struct _RopeNode *clone = Rope_newNode(node->chunk, node->range, node->priority);
+	if ( clone == NULL ) return NULL;
+	clone->left = Rope_cloneNodes(node->left);
+	clone->right = Rope_cloneNodes(node->right);
+	if ( (node->left && clone->left == NULL) || (node->right && clone->right == NULL) )
+		return Rope_freeNodes(clone), errno = ENOMEM, NULL;
+	Rope_update(clone);
+	return clone;
+}
+
+/* The text of left followed by that of right, the node of greater priority on top */
+static struct _RopeNode * Rope_merge(struct _RopeNode *const left, struct _RopeNode *const right) {
+	if ( left == NULL ) return right;
+	if ( right == NULL ) return left;
+	if ( left->priority >= right->priority ) {
+		left->right = Rope_merge(left->right, right);
+		Rope_update(left);
+		return left;
+	}
+	right->left = Rope_merge(left, right->left);
+	Rope_update(right);
+	return right;
+}
+
+/* Splits node into its first position characters and the rest, the chunk the position falls within shared by two
+ * nodes. Nothing is changed when the node this needs cannot be allocated. */
+static int Rope_split(struct _RopeNode *const node, UInteger position, struct _RopeNode **const left, struct _RopeNode **const right) {
+	if ( node == NULL ) return *left = *right = NULL, 0;
+	UInteger leftLength = Rope_length(node->left);
+	if ( position <= leftLength ) {
+		struct _RopeNode *rest = NULL;
+		if ( Rope_split(node->left, position, left, &rest) == -1 ) return -1;
+		node->left = rest;
+		Rope_update(node);
+		return *right = node, 0;
+	}
+	if ( position >= leftLength + node->range.length ) {
+		struct _RopeNode *first = NULL;
+		if ( Rope_split(node->right, position - leftLength - node->range.length, &first, right) == -1 ) return -1;
+		node->right = first;
+		Rope_update(node);
+		return *left = node, 0;
+	}
+	/* The second part of the chunk takes the priority of the node, to stay above the right subtree */
+	UInteger offset = position - leftLength;
+	struct _RopeNode *second = Rope_newNode(node->chunk, MakeRange(node->range.location + offset, node->range.length - offset), node->priority);
+	if ( second == NULL ) return -1;
+	second->right = node->right;
+	Rope_update(second);
+	node->right = NULL;
+	node->range.length = offset;
+	Rope_update(node);
+	return *left = node, *right = second, 0;
+}
+
+/* The node holding the character at index, and where in its range */
+static struct _RopeNode * Rope_nodeAtIndex(struct _RopeNode *node, UInteger index, UInteger *const offset) {
+	while ( node ) {
+		UInteger leftLength = Rope_length(node->left);
+		if ( index < leftLength )
+			node = node->left;
+		else if ( index - leftLength < node->range.length )
+			return *offset = index - leftLength, node;
+		else
+			index -= leftLength + node->range.length, node = node->right;
+	}
+	return NULL;
+}
+
+/* Adds grown characters, or removes shrunk ones, to the lengths on the way to the node holding index: to be called
+ * before the range of that node changes, as the way depends on it */
+static void Rope_resizeToIndex(struct _RopeNode *node, UInteger index, UInteger grown, UInteger shrunk) {
+	while ( node ) {
+		node->length = node->length + grown - shrunk;
+		UInteger leftLength = Rope_length(node->left);
+		if ( index < leftLength )
+			node = node->left;
+		else if ( index - leftLength < node->range.length )
+			return;
+		else
+			index -= leftLength + node->range.length, node = node->right;
+	}
+}
+
+/* Copies range of the text of node to buffer */
+static void Rope_copyNodes(const struct _RopeNode *node, Range range, char *buffer) {
+	while ( node && range.length ) {
+		UInteger leftLength = Rope_length(node->left);
+		if ( range.location < leftLength ) {
+			UInteger inLeft = leftLength - range.location < range.length ? leftLength - range.location : range.length;
+			Rope_copyNodes(node->left, MakeRange(range.location, inLeft), buffer);
+			buffer += inLeft, range.location += inLeft, range.length -= inLeft;
+			continue;
+		}
+		UInteger offset = range.location - leftLength;
+		if ( offset < node->range.length ) {
+			UInteger inNode = node->range.length - offset < range.length ? node->range.length - offset : range.length;
+			memcpy(buffer, Rope_chunkText(node) + offset, inNode);
+			buffer += inNode, range.location += inNode, range.length -= inNode;
+			continue;
+		}
+		range.location -= leftLength + node->range.length;
+		node = node->right;
+	}
+}
+
+/* Edits */
+
+static void Rope_edited(struct Rope *const self) {
+	struct String *stringSelf = (struct String *)self;
+	stringSelf->length = Rope_length(self->root);
+	stringSelf->_hash = 0;
+	self->flat = NO;
+}
+
+/* A chunk of the text of node with the length bytes of text inserted at offset, or removed from it when text is NULL */
+static StringRef Rope_editedChunk(const struct _RopeNode *const node, UInteger offset, const char *const text, UInteger length) {
+	UInteger chunkLength = text ? node->range.length + length : node->range.length - length;
+	struct String *chunk = String_newWithLength(chunkLength);
+	if ( chunk == NULL ) return errno = ENOMEM, NULL;
+	char *cursor = (char *)chunk->text;
+	memcpy(cursor, Rope_chunkText(node), offset), cursor += offset;
+	if ( text ) memcpy(cursor, text, length), cursor += length;
+	UInteger rest = text ? offset : offset + length;
+	memcpy(cursor, Rope_chunkText(node) + rest, node->range.length - rest);
+	return chunk;
+}
+
+/* Inserts the length bytes of text at index: copied into the chunk they touch when it stays short, else a node of
+ * range of chunk, or of a copy of text when chunk is NULL */
+static int Rope_insert(struct Rope *const self, UInteger index, const char *const text, UInteger length, const void *const chunk, Range range) {
+	struct String *stringSelf = (struct String *)self;
+	if ( index > stringSelf->length ) return errno = EINVAL, -1;
+	if ( length == 0 ) return 0;
+
+	/* The chunk ending at index, or starting there at the start of the text */
+	UInteger at = index ? index - 1 : 0, offset = 0;
+	struct _RopeNode *node = Rope_nodeAtIndex(self->root, at, &offset);
+	if ( node && node->range.length + length <= ROPE_CHUNK_CAPACITY ) {
+		StringRef edited = Rope_editedChunk(node, index ? offset + 1 : 0, text, length);
+		if ( edited == NULL ) return -1;
+		Rope_resizeToIndex(self->root, at, length, 0);
+		release(node->chunk);
+		node->chunk = edited;
+		node->range = MakeRange(0, node->range.length + length);
+		return Rope_edited(self), 0;
+	}
+
+	StringRef copied = chunk ? NULL : newWithArguments(String, &(StringArguments){ text, length });
+	if ( chunk == NULL && copied == NULL ) return errno = ENOMEM, -1;
+	struct _RopeNode *inserted = Rope_newNode(chunk ? chunk : copied, chunk ? range : MakeRange(0, length), Rope_nextPriority(self));
+	if ( copied ) release(copied);
+	if ( inserted == NULL ) return -1;
+	struct _RopeNode *left = NULL, *right = NULL;
+	if ( Rope_split(self->root, index, &left, &right) == -1 ) return Rope_freeNodes(inserted), -1;
+	self->root = Rope_merge(Rope_merge(left, inserted), right);
+	return Rope_edited(self), 0;
+}
+
+static int Rope_delete(struct Rope *const self, Range range) {
+	struct String *stringSelf = (struct String *)self;
+	if ( MaxRange(range) > stringSelf->length || MaxRange(range) < range.location ) return errno = EINVAL, -1;
+	if ( range.length == 0 ) return 0;
+
+	/* Within a single chunk: its range shrinks when the deleted characters start or end it, short ones are copied */
+	UInteger offset = 0;
+	struct _RopeNode *node = Rope_nodeAtIndex(self->root, range.location, &offset);
+	if ( offset + range.length <= node->range.length && range.length < node->range.length ) {
+		bool edge = ( offset == 0 || offset + range.length == node->range.length );
+		if ( edge || node->range.length - range.length <= ROPE_CHUNK_CAPACITY ) {
+			StringRef edited = edge ? NULL : Rope_editedChunk(node, offset, NULL, range.length);
+			if ( ! edge && edited == NULL ) return -1;
+			Rope_resizeToIndex(self->root, range.location, 0, range.length);
+			if ( edited ) {
+				release(node->chunk);
+				node->chunk = edited;
+				node->range = MakeRange(0, node->range.length - range.length);
+			}
+			else
+				node->range = MakeRange(node->range.location + (offset ? 0 : range.length), node->range.length - range.length);
+			return Rope_edited(self), 0;
+		}
+	}
+
+	struct _RopeNode *before = NULL, *rest = NULL, *deleted = NULL, *after = NULL;
+	if ( Rope_split(self->root, range.location, &before, &rest) == -1 ) return -1;
+	if ( Rope_split(rest, range.length, &deleted, &after) == -1 ) {
+		self->root = Rope_merge(before, rest);
+		return -1;
+	}
+	Rope_freeNodes(deleted);
+	self->root = Rope_merge(before, after);
+	return Rope_edited(self), 0;
+}
+
+/* A plain String with the text of other, retained, and the range of it other spans */
+static StringRef Rope_chunk(const void *const other, Range *const range) {
+	if ( classOf(other) == StringSlice ) {
+		const struct StringSlice *slice = other;
+		*range = slice->range;
+		return retain(slice->parent);
+	}
+	*range = MakeRange(0, getStringLength(other));
+	if ( classOf(other) == String )
+		return retain((void *)other);
+	/* The text of a subclass may change or move */
+	return newWithArguments(String, &(StringArguments){ getStringText(other), range->length });
+}
+
+static int Rope_insertString(struct Rope *const self, const void *const other, UInteger index) {
+	UInteger length = getStringLength(other);
+	if ( length == 0 ) return index > ((struct String *)self)->length ? (errno = EINVAL, -1) : 0;
+	/* Short texts are copied into a chunk anyway */
+	if ( length <= ROPE_CHUNK_CAPACITY / 2 )
+		return Rope_insert(self, index, getStringText(other), length, NULL, MakeRange(0, 0));
+	Range range;
+	StringRef chunk = Rope_chunk(other, &range);
+	if ( chunk == NULL ) return errno = ENOMEM, -1;
+	int result = Rope_insert(self, index, getStringText(chunk) + range.location, length, chunk, range);
+	release(chunk);
+	return result;
+}
+
+/* Rope */
+
+static void * Rope_setText(struct Rope *const self, const char *const text, UInteger length) {
+	struct String *stringSelf = (struct String *)self;
+	self->seed = 0x9E3779B97F4A7C15ULL ^ (UInteger)(uintptr_t)self;
+	stringSelf->length = 0;
+	/* The destructor frees whatever chunks were made before the failure */
+	if ( text && length && Rope_insert(self, 0, text, length, NULL, MakeRange(0, 0)) == -1 )
+		return MEMORY_MANAGEMENT_RELEASE(self), NULL;
+	return Rope_edited(self), self;
+}
+
+static void * Rope_constructor (void * _self, va_list * app) {
+	/* The text of String is only that materialized, the chunks are made here */
+	struct Rope *self = super_constructor(String, _self, app);
+	const char *text = va_arg(*app, const char *);
+	return Rope_setText(self, text, text ? strlen(text) : 0);
+}
+
+static void * Rope_initializer (void * _self, const void *const _arguments) {
+	const StringArguments *arguments = _arguments;
+	struct Rope *self = super_initializer(String, _self, _arguments);
+	if ( arguments == NULL || arguments->text == NULL )
+		return Rope_setText(self, NULL, 0);
+	return Rope_setText(self, arguments->text, arguments->length == StringArgumentsNullTerminated ? strlen(arguments->text) : arguments->length);
+}
+
+static void * Rope_destructor (void * _self) {
+	struct Rope *self = super_destructor(Rope, _self);
+	Rope_freeNodes(self->root), self->root = NULL;
+	return self;
+}
+
+static void * RopeClass_constructor (void * _self, va_list *app) {
+	struct RopeClass * self = super_constructor(RopeClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) getRopeChunkAtIndex )
+			* (voidf *) & self->getRopeChunkAtIndex = method;
+		else if (selector == (voidf) getRopeChunkCount )
+			* (voidf *) & self->getRopeChunkCount = method;
+		else if (selector == (voidf) copyRopeAsString )
+			* (voidf *) & self->copyRopeAsString = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+/* Shares the chunks */
+static void * Rope_copy (const void *const _self) {
+	const struct Rope *self = _self;
+	struct Rope *copy = new(Rope, NULL);
+	if ( copy == NULL ) return NULL;
+	copy->root = Rope_cloneNodes(self->root);
+	if ( self->root && copy->root == NULL ) return release(copy), NULL;
+	Rope_edited(copy);
+	((struct String *)copy)->_hash = ((const struct String *)self)->_hash;
+	return copy;
+}
+
+static StringRef Rope_copyRopeAsString(const void *const _self) {
+	const struct Rope *self = _self;
+	UInteger length = Rope_length(self->root);
+	struct String *string = String_newWithLength(length);
+	if ( string == NULL ) return NULL;
+	Rope_copyNodes(self->root, MakeRange(0, length), (char *)string->text);
+	return string;
+}
+
+/* Compared a chunk at a time, the rope left as it is */
+static bool Rope_equals (const void *const _self, const void *const _other) {
+	const struct Rope *self = _self;
+	if ( _self == _other ) return YES;
+	UInteger length = ((const struct String *)self)->length;
+	if ( getStringLength(_other) != length ) return NO;
+	const char *otherText = length ? getStringText(_other) : "";
+	if ( otherText == NULL ) return NO;
+	RopeChunks chunks = MakeRopeChunks(self);
+	const char *text;
+	UInteger chunkLength;
+	while ( nextRopeChunk(&chunks, &text, &chunkLength) ) {
+		if ( memcmp(text, otherText, chunkLength) != 0 ) return NO;
+		otherText += chunkLength;
+	}
+	return YES;
+}
+
+/* Materializes the text, kept until the next edit */
+static const char * Rope_getStringText (const void *const _self) {
+	struct Rope *self = (struct Rope *)_self;
+	struct MutableString *mutableSelf = (struct MutableString *)self;
+	struct String *stringSelf = (struct String *)self;
+	if ( ! self->flat ) {
+		UInteger length = stringSelf->length;
+		if ( length + 1 > mutableSelf->capacity ) {
+			void *text = realloc((void *)stringSelf->text, length + 1);
+			if ( text == NULL ) return errno = ENOMEM, NULL;
+			stringSelf->text = text;
+			mutableSelf->capacity = length + 1;
+		}
+		Rope_copyNodes(self->root, MakeRange(0, length), (char *)stringSelf->text);
+		((char *)stringSelf->text)[length] = '\0';
+		self->flat = YES;
+	}
+	return stringSelf->text;
+}
+
+static int Rope_characterAtIndex(const void *const _self, void *const character, UInteger index) {
+	const struct Rope *self = _self;
+	UInteger offset = 0;
+	const struct _RopeNode *node = character ? Rope_nodeAtIndex(self->root, index, &offset) : NULL;
+	if ( node == NULL ) return errno = EINVAL, -1;
+	*(char *)character = Rope_chunkText(node)[offset];
+	return 0;
+}
+
+static int Rope_getCharactersInRange(const void *const _self, void *const restrict buffer, Range range) {
+	const struct Rope *self = _self;
+	if ( buffer == NULL || MaxRange(range) > ((const struct String *)self)->length || MaxRange(range) < range.location )
+		return errno = EINVAL, -1;
+	Rope_copyNodes(self->root, range, buffer);
+	return 0;
+}
+
+static StringRef Rope_copyStringByAppendingString(const void *restrict const _self, const void *restrict const _other) {
+	struct Rope *copy = Rope_copy(_self);
+	if ( copy && Rope_insertString(copy, _other, ((struct String *)copy)->length) == -1 )
+		return release(copy), NULL;
+	return copy;
+}
+
+static const char * Rope_getRopeChunkAtIndex(const void *const _self, UInteger index, UInteger *length) {
+	const struct Rope *self = _self;
+	UInteger offset = 0;
+	const struct _RopeNode *node = Rope_nodeAtIndex(self->root, index, &offset);
+	if ( node == NULL ) return errno = EINVAL, NULL;
+	*length = node->range.length - offset;
+	return Rope_chunkText(node) + offset;
+}
+
+static UInteger Rope_getRopeChunkCount(const void *const _self) {
+	const struct Rope *self = _self;
+	return Rope_count(self->root);
+}
+
+/* Mutable */
+
+static void Rope_appendString(void *const _self, const void *const other) {
+	Rope_insertString(_self, other, ((struct String *)_self)->length);
+}
+
+static void Rope_appendBytes(void *const _self, const void *const bytes, UInteger length) {
+	Rope_insert(_self, ((struct String *)_self)->length, bytes, length, NULL, MakeRange(0, 0));
+}
+
+static void Rope_appendCharacter(void *const _self, char character) {
+	Rope_insert(_self, ((struct String *)_self)->length, &character, 1, NULL, MakeRange(0, 0));
+}
+
+static void Rope_appendFormat(void *const _self, char *format, va_list *app) {
+	char buffer[STRING_FORMAT_CAPACITY];
+	va_list copy;
+	va_copy(copy, *app);
+	int totalWritten = vsnprintf(buffer, sizeof(buffer), format, *app);
+	if ( totalWritten < 0 ) { errno = EINVAL, va_end(copy); return; }
+	if ( (UInteger)totalWritten < sizeof(buffer) )
+		Rope_appendBytes(_self, buffer, (UInteger)totalWritten);
+	else {
+		char *text = malloc((UInteger)totalWritten + 1);
+		if ( text == NULL ) { errno = ENOMEM, va_end(copy); return; }
+		vsnprintf(text, (UInteger)totalWritten + 1, format, copy);
+		Rope_appendBytes(_self, text, (UInteger)totalWritten);
+		free(text);
+	}
+	va_end(copy);
+}
+
+static void Rope_reserveMutableStringCapacity(void *const _self, UInteger capacity) {
+	/* Chunks are allocated as the text is inserted */
+}
+
+static void Rope_setString(void *const _self, const void *const other) {
+	struct Rope *self = _self;
+	if ( _self == other ) return;
+	/* other may share chunks with self */
+	struct _RopeNode *root = self->root;
+	self->root = NULL;
+	Rope_edited(self);
+	Rope_insertString(self, other, 0);
+	Rope_freeNodes(root);
+}
+
+/* Truncates, or pads with null bytes */
+static void Rope_setMutableStringLength(void *const _self, UInteger length) {
+	struct String *stringSelf = _self;
+	UInteger selfLength = stringSelf->length;
+	if ( length < selfLength ) {
+		Rope_delete(_self, MakeRange(length, selfLength - length));
+		return;
+	}
+	if ( length == selfLength ) return;
+	struct String *padding = String_newWithLength(length - selfLength);
+	if ( padding == NULL ) { errno = ENOMEM; return; }
+	memset((char *)padding->text, '\0', length - selfLength);
+	Rope_insertString(_self, padding, selfLength);
+	release(padding);
+}
+
+static int Rope_insertStringAtMutableStringIndex(void *const _self, const void *const other, UInteger index) {
+	return Rope_insertString(_self, other, index);
+}
+
+static int Rope_deleteMutableStringCharactersInRange(void *const _self, Range range) {
+	return Rope_delete(_self, range);
+}
+
+CO_CLASS_INIT_DECL(Rope) {
+	initMutableString();
+	initStringSlice();
+
+	if ( ! RopeClass )
+		RopeClass = new(MutableStringClass, "RopeClass", MutableStringClass, sizeof(struct RopeClass),
+						constructor, RopeClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(Rope) )
+		CO_CLASS_PUBLISH(Rope, new(RopeClass, "Rope", MutableString, sizeof(struct Rope),
+				   constructor, Rope_constructor,
+				   initializer, Rope_initializer,
+				   destructor, Rope_destructor,
+
+				   /* Overrides */
+				   copy, Rope_copy,
+				   equals, Rope_equals,
+				   copyDescription, Rope_copyRopeAsString,
+				   getStringText, Rope_getStringText,
+				   characterAtIndex, Rope_characterAtIndex,
+				   getCharactersInRange, Rope_getCharactersInRange,
+				   copyStringByAppendingString, Rope_copyStringByAppendingString,
+				   appendString, Rope_appendString,
+				   appendFormat, Rope_appendFormat,
+				   appendBytes, Rope_appendBytes,
+				   appendCharacter, Rope_appendCharacter,
+				   reserveMutableStringCapacity, Rope_reserveMutableStringCapacity,
+				   setString, Rope_setString,
+				   setMutableStringLength, Rope_setMutableStringLength,
+				   insertStringAtMutableStringIndex, Rope_insertStringAtMutableStringIndex,
+				   deleteMutableStringCharactersInRange, Rope_deleteMutableStringCharactersInRange,
+
+				   /* new */
+				   getRopeChunkAtIndex, Rope_getRopeChunkAtIndex,
+				   getRopeChunkCount, Rope_getRopeChunkCount,
+				   copyRopeAsString, Rope_copyRopeAsString,
+				   NULL));
+}
+
+void deallocRope() {
+	release((void *)Rope), Rope = NULL;
+	release((void *)RopeClass), RopeClass = NULL;
+}
+
+/* API */
+
+RopeChunks MakeRopeChunks(const void *const rope) {
+	return (RopeChunks){ rope, 0 };
+}
+
+bool nextRopeChunk(RopeChunks *const chunks, const char **text, UInteger *length) {
+	COAssertNoNullOrReturn(chunks,EINVAL,NO);
+	COAssertNoNullOrReturn(chunks->rope,EINVAL,NO);
+	if ( chunks->location >= getStringLength(chunks->rope) ) return NO;
+	/* Found again from the top, so that a chunk edited under the enumeration is never left dangling */
+	UInteger chunkLength = 0;
+	const char *chunk = getRopeChunkAtIndex(chunks->rope, chunks->location, &chunkLength);
+	if ( chunk == NULL ) return NO;
+	*text = chunk, *length = chunkLength;
+	chunks->location += chunkLength;
+	return YES;
+}
+
+const char *getRopeChunkAtIndex(const void *const self, UInteger index, UInteger *length) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	COAssertNoNullOrReturn(length,EINVAL,NULL);
+	const struct RopeClass *class = classOf(self);
+	COAssertNoNullOrReturn(class->getRopeChunkAtIndex,ENOTSUP,NULL);
+	return class->getRopeChunkAtIndex(self, index, length);
+}
+
+StringRef copyRopeAsString(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct RopeClass *class = classOf(self);
+	COAssertNoNullOrReturn(class->copyRopeAsString,ENOTSUP,NULL);
+	return class->copyRopeAsString(self);
+}
+
+UInteger getRopeChunkCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct RopeClass *class = classOf(self);
+	COAssertNoNullOrReturn(class->getRopeChunkCount,ENOTSUP,0);
+	return class->getRopeChunkCount(self);
+}
@@ -0,0 +1,209 @@
+//
+//  SPSCQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <SPSCQueue.r>
+
+CO_CLASS_STORAGE_DECL(SPSCQueue)
+
+static void * SPSCQueue_constructor (void * _self, va_list * app) {
+	struct SPSCQueue *self = super_constructor(SPSCQueue, _self, app);
+	if ( self == NULL ) return NULL;
+	const UInteger size = self->isa.mask + 1;
+	/* Past this the size of the slots overflows. The destructor copes with a queue without slots */
+	if ( size > UIntegerMax / sizeof(void *) )
+		return MEMORY_MANAGEMENT_RELEASE(self), errno = EINVAL, NULL;
+
+	self->slots = calloc(size, sizeof(void *));
+	assert( self->slots != NULL );
+	if ( self->slots == NULL ) return MEMORY_MANAGEMENT_RELEASE(self), errno = ENOMEM, NULL;
+	self->tail = self->cachedHead = 0;
+	self->head = self->cachedTail = 0;
+	return self;
+}
+
+static ObjectRef SPSCQueue_pop(struct SPSCQueue *const self);
+
+static void * SPSCQueue_destructor (void * _self) {
+	struct SPSCQueue *self = super_destructor(SPSCQueue, _self);
+	ObjectRef object = NULL;
+	if ( self->slots != NULL )
+		while ( (object = SPSCQueue_pop(self)) )
+			release(object);
+	free(self->slots), self->slots = NULL;
+	return self;
+}
+
+/* Returns how many slots the producer may fill, re-reading head only when the cached one says fewer than wanted */
+static UInteger SPSCQueue_free(struct SPSCQueue *const self, UInteger wanted) {
+	const UInteger capacity = self->isa.mask + 1;
+	UInteger free = capacity - (self->tail - self->cachedHead);
+	if ( free < wanted ) {
+		self->cachedHead = __atomic_load_n(&(self->head), __ATOMIC_ACQUIRE);
+		free = capacity - (self->tail - self->cachedHead);
+	}
+	return free;
+}
+
+/* Returns how many slots the consumer may empty, re-reading tail only when the cached one says fewer than wanted */
+static UInteger SPSCQueue_available(struct SPSCQueue *const self, UInteger wanted) {
+	UInteger available = self->cachedTail - self->head;
+	if ( available < wanted ) {
+		self->cachedTail = __atomic_load_n(&(self->tail), __ATOMIC_ACQUIRE);
+		available = self->cachedTail - self->head;
+	}
+	return available;
+}
+
+static UInteger SPSCQueue_pushObjects(struct SPSCQueue *const self, void *const objects[], UInteger count) {
+	UInteger free = SPSCQueue_free(self, count);
+	if ( count > free )
+		count = free;
+	UInteger tail = self->tail;
+	for (UInteger i=0; i<count; i++) {
+		retain(objects[i]);
+		self->slots[(tail + i) & self->isa.mask] = objects[i];
+	}
+	if ( count > 0 )
+		__atomic_store_n(&(self->tail), tail + count, __ATOMIC_RELEASE);
+	return count;
+}
+
+static UInteger SPSCQueue_popObjects(struct SPSCQueue *const self, ObjectRef objects[], UInteger count) {
+	UInteger available = SPSCQueue_available(self, count);
+	if ( count > available )
+		count = available;
+	UInteger head = self->head;
+	for (UInteger i=0; i<count; i++) {
+		void **slot = &(self->slots[(head + i) & self->isa.mask]);
+		objects[i] = *slot;
+		*slot = NULL;
+	}
+	if ( count > 0 )
+		__atomic_store_n(&(self->head), head + count, __ATOMIC_RELEASE);
+	return count;
+}
+
+static bool SPSCQueue_push(struct SPSCQueue *const self, void *const object) {
+	void *objects[1] = { object };
+	return SPSCQueue_pushObjects(self, objects, 1) == 1;
+}
+
+static ObjectRef SPSCQueue_pop(struct SPSCQueue *const self) {
+	ObjectRef objects[1] = { NULL };
+	SPSCQueue_popObjects(self, objects, 1);
+	return objects[0];
+}
+
+static bool SPSCQueue_tryEnqueueObject(void *const _self, void *const object) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	if ( ! SPSCQueue_push(self, object) )
+		return NO;
+	QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), 1);
+	return YES;
+}
+
+static ObjectRef SPSCQueue_tryDequeueObject(void *const _self) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	ObjectRef object = SPSCQueue_pop(self);
+	if ( object != NULL )
+		QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), 1);
+	return object;
+}
+
+static UInteger SPSCQueue_tryEnqueueObjects(void *const _self, void *const objects[], UInteger count) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	UInteger enqueued = SPSCQueue_pushObjects(self, objects, count);
+	if ( enqueued > 0 )
+		QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), 1);
+	return enqueued;
+}
+
+static UInteger SPSCQueue_tryDequeueObjects(void *const _self, ObjectRef objects[], UInteger count) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	UInteger dequeued = SPSCQueue_popObjects(self, objects, count);
+	if ( dequeued > 0 )
+		QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), 1);
+	return dequeued;
+}
+
+static void SPSCQueue_enqueueObject(void *const _self, void *const object) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	if ( ! SPSCQueue_push(self, object) ) {
+		pthread_mutex_lock(&(queue->parking));
+		__atomic_add_fetch(&(queue->waitingProducers), 1, __ATOMIC_SEQ_CST);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		while ( ! SPSCQueue_push(self, object) )
+			pthread_cond_wait(&(queue->notFull), &(queue->parking));
+		__atomic_sub_fetch(&(queue->waitingProducers), 1, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(queue->parking));
+	}
+	QueueWake(queue, &(queue->waitingConsumers), &(queue->notEmpty), 1);
+}
+
+static ObjectRef SPSCQueue_dequeueObject(void *const _self) {
+	struct SPSCQueue *self = _self;
+	struct Queue *queue = _self;
+	ObjectRef object = SPSCQueue_pop(self);
+	if ( object == NULL ) {
+		pthread_mutex_lock(&(queue->parking));
+		__atomic_add_fetch(&(queue->waitingConsumers), 1, __ATOMIC_SEQ_CST);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		while ( (object = SPSCQueue_pop(self)) == NULL )
+			pthread_cond_wait(&(queue->notEmpty), &(queue->parking));
+		__atomic_sub_fetch(&(queue->waitingConsumers), 1, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(queue->parking));
+	}
+	QueueWake(queue, &(queue->waitingProducers), &(queue->notFull), 1);
+	return object;
+}
+
+static UInteger SPSCQueue_getQueueCount(const void *const _self) {
+	const struct SPSCQueue *self = _self;
+	UInteger head = __atomic_load_n(&(self->head), __ATOMIC_ACQUIRE);
+	UInteger tail = __atomic_load_n(&(self->tail), __ATOMIC_ACQUIRE);
+	return tail - head;
+}
+
+CO_CLASS_INIT_DECL(SPSCQueue) {
+	initQueue();
+
+	if ( ! SPSCQueueClass )
+		SPSCQueueClass = new(QueueClass, "SPSCQueueClass", QueueClass, sizeof(struct SPSCQueueClass), NULL);
+	if ( CO_CLASS_PENDING(SPSCQueue) )
+		CO_CLASS_PUBLISH(SPSCQueue, new(SPSCQueueClass, "SPSCQueue", Queue, sizeof(struct SPSCQueue),
+						constructor, SPSCQueue_constructor,
+						destructor, SPSCQueue_destructor,
+
+						/* Overrides */
+						tryEnqueueObject, SPSCQueue_tryEnqueueObject,
+						tryDequeueObject, SPSCQueue_tryDequeueObject,
+						tryEnqueueObjects, SPSCQueue_tryEnqueueObjects,
+						tryDequeueObjects, SPSCQueue_tryDequeueObjects,
+						enqueueObject, SPSCQueue_enqueueObject,
+						dequeueObject, SPSCQueue_dequeueObject,
+						getQueueCount, SPSCQueue_getQueueCount,
+						NULL));
+}
+
+void deallocSPSCQueue() {
+	release((void *)SPSCQueue), SPSCQueue = NULL;
+	release((void *)SPSCQueueClass), SPSCQueueClass = NULL;
+}
@@ -15,13 +15,19 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <ctype.h>
+#include <math.h>
+#include <limits.h>
 
 #include <coassert.h>
 #include <corange.h>
 #include <codefinitions.h>
 
+#include <cosearch.h>
+#include <coutf8.h>
 #include <StringObject.h>
 #include <StringObject.r>
+#include <Array.h>
+#include <foreach.h>
 #include <new.h>
 #include <Object.h>
 #include <Object.r>
@@ -29,6 +35,13 @@
 
 extern int errno;
 
+/* Short texts of plain Strings are stored inline. The subclasses own a heap buffer they may grow or replace. */
+static char * String_allocateText(struct String *const self, UInteger length) {
+	if ( length < STRING_INLINE_CAPACITY && classOf(self) == String )
+		return self->inlineText;
+	return malloc(length + 1);
+}
+
 static void * String_constructor (void * _self, va_list * app) {
 	struct String *self = super_constructor(String, _self, app);
 	
@@ -37,10 +50,33 @@ static void * String_constructor (void * _self, va_list * app) {
 		self->length = 0;
 		return self;
 	}
-	self->text = strdup(text);
-	assert(self->text != NULL);
-	if ( self->text == NULL ) return free(self), NULL;
-	self->length = strlen(self->text);
+	UInteger length = strlen(text);
+	char *copy = String_allocateText(self, length);
+	assert(copy != NULL);
+	if ( copy == NULL ) return free(self), NULL;
+	memcpy(copy, text, length + 1);
+	self->text = copy;
+	self->length = length;
+	self->_hash = 0;
+	return self;
+}
+
+static void * String_initializer (void * _self, const void *const _arguments) {
+	struct String *self = super_initializer(String, _self, _arguments);
+	const StringArguments *arguments = _arguments;
+	
+	if (NULL==arguments || NULL==arguments->text) {
+		self->length = 0;
+		return self;
+	}
+	UInteger length = arguments->length == StringArgumentsNullTerminated ? strlen(arguments->text) : arguments->length;
+	char *text = String_allocateText(self, length);
+	assert(text != NULL);
+	if ( text == NULL ) return NULL;
+	memcpy(text, arguments->text, length);
+	text[length] = '\0';
+	self->text = text;
+	self->length = length;
 	self->_hash = 0;
 	return self;
 }
@@ -75,6 +111,9 @@ static void * StringClass_constructor (void * _self, va_list *app) {
 		
 		else if (selector == (voidf) copyStringByTrimmingSpaces )
 			* (voidf *) & self->copyStringByTrimmingSpaces = method;
+		
+		else if (selector == (voidf) rangeOfStringWithOptionsInRange )
+			* (voidf *) & self->rangeOfStringWithOptionsInRange = method;
 	}
 	va_end(ap);
 	return self;
@@ -82,13 +121,17 @@ static void * StringClass_constructor (void * _self, va_list *app) {
 
 static void * String_destructor (void * _self) {
 	struct String *self = super_destructor(String, _self);
-	free((char *)self->text), self->text = NULL;
+	if ( self->text != self->inlineText )
+		free((char *)self->text);
+	self->text = NULL;
 	return self;
 }
 
 static void * String_copy (const void *const _self) {
 	const struct String *self = _self;
-	StringRef _copy = new(String, self->text, NULL);
+	/* Immutable and immortal, an interned String is its own copy */
+	if ( self->interned ) return (void *)self;
+	StringRef _copy = newWithArguments(String, &(StringArguments){ self->text, self->length });
 	struct String *copy = _copy;
 	copy->_hash = self->_hash;
 	return _copy;
@@ -97,13 +140,26 @@ static void * String_copy (const void *const _self) {
 static bool String_equals (const void * const _self, const void *const _other) {
 	const struct String *self = _self;
 	const struct String *other = _other;
-	const struct Classs *const _super = (const struct Classs *const )super(_self);
+	if ( self == other ) return YES;
+	/* There is a single interned String per text */
+	if ( self->interned && other->interned ) return NO;
+	/* Every String keeps its length, and its hash once computed, in the instance: either differing tells the texts apart */
+	UInteger length = self->length;
+	if ( length != other->length ) return NO;
+	if ( self->_hash && other->_hash && self->_hash != other->_hash ) return NO;
+	if ( length == 0 ) return YES;
 	
-	
-	bool result = _super->equals(_self, _other);
-	if ( ! result && (getStringLength(self) == getStringLength(other)) && self->text && other->text)
-		result = (strcmp(self->text, other->text) == 0);
-	return result;
+	/* Bounded by the length: the text of a StringSlice is not null terminated. The text of other is asked for, a Rope
+	 * materializing its own only on demand. */
+	const char *otherText = classOf(other) == String ? other->text : getStringText(other);
+	return self->text && otherText && memcmp(self->text, otherText, length) == 0;
+}
+
+static UInteger String_hashText(const char *restrict text, UInteger length) {
+	UInteger hash = 0;
+	for(UInteger i = 0; i < length; text++, i++)
+		hash =  (UInteger)(*text) + (hash << 6) + (hash << 16) - hash;
+	return hash;
 }
 
 static UInteger String_hash(const void *const _self) {
@@ -119,50 +175,102 @@ static UInteger String_hash(const void *const _self) {
 //			((struct String *)self)->_hash = h;
 //        }
 		
-		UInteger hash = 0;
-		const char *restrict text = getStringText(self);
-		for(UInteger i = 0; i < self->length; text++, i++)
-			hash =  (UInteger)(*text) + (hash << 6) + (hash << 16) - hash;
-		((struct String *)self)->_hash = hash;
+		((struct String *)self)->_hash = String_hashText(getStringText(self), self->length);
 	}
 	return self->_hash;
 }
 
+static void * String_retain (void *const _self) {
+	struct String *self = _self;
+	/* Interned Strings are never counted, their text is shared for the life of the process */
+	if ( self->interned ) return self;
+	return Object_retain(_self);
+}
+
+static void String_release (void *const _self) {
+	struct String *self = _self;
+	if ( ! self->interned )
+		Object_release(_self);
+}
+
+static UInteger String_retainCount (const void *const _self) {
+	const struct String *self = _self;
+	return self->interned ? UIntegerMax : Object_retainCount(_self);
+}
+
+struct String * String_newWithLength(UInteger length) {
+	struct String *self = new(String, NULL);
+	if ( self == NULL ) return NULL;
+	char *text = String_allocateText(self, length);
+	assert(text != NULL);
+	if ( text == NULL ) return release(self), NULL;
+	text[length] = '\0';
+	self->text = text;
+	self->length = length;
+	self->_hash = 0;
+	return self;
+}
+
+/* A new instance of class with the null terminated text, of length characters, copied once */
+static StringRef String_newWithText(const void *const _class, const char *const text, UInteger length) {
+	if ( _class == String )
+		return newWithArguments(String, &(StringArguments){ text, length });
+	return new(_class, text, NULL);
+}
+
 static StringRef String_newStringWithFormat(const void *const _class, const char *const format, va_list *ap) {
 	StringRef newString = NULL;
-	char buffer[BUFSIZ];
-	memset(buffer, '\0', BUFSIZ);
+	/* The first pass both sizes the text and, when it is short, writes it */
+	char buffer[STRING_FORMAT_CAPACITY];
 	
 	va_list copy;
 	va_copy(copy, *ap);
 	
-	int totalWritten = vsnprintf(buffer, BUFSIZ, format, *ap);
-	if (totalWritten>= BUFSIZ) {
-		char *newBuffer = calloc((UInteger)totalWritten+1, sizeof(char));
+	int totalWritten = vsnprintf(buffer, sizeof(buffer), format, *ap);
+	if ( totalWritten < 0 )
+		errno = EINVAL;
+	else if ( (UInteger)totalWritten < sizeof(buffer) )
+		newString = String_newWithText(_class, buffer, (UInteger)totalWritten);
+	else if ( _class == String ) {
+		/* The second pass writes into the storage of the new String */
+		struct String *string = String_newWithLength((UInteger)totalWritten);
+		if ( string ) vsnprintf((char *)string->text, (UInteger)totalWritten+1, format, copy);
+		newString = string;
+	}
+	else {
+		char *newBuffer = malloc((UInteger)totalWritten+1);
 		assert(newBuffer != NULL);
-		vsnprintf(newBuffer, totalWritten+1, format, copy);
-		newString = new(_class, newBuffer, NULL);
-		free(newBuffer);
+		if ( newBuffer ) {
+			vsnprintf(newBuffer, (UInteger)totalWritten+1, format, copy);
+			newString = new(_class, newBuffer, NULL);
+			free(newBuffer);
+		}
 	}
-	else
-		newString = new(_class, buffer, NULL);
 	va_end(copy);
 	return newString;
 }
 
+/* Writes the digits of value ending at end, returns where they start */
+static char * String_writeDigits(char *end, UInteger value) {
+	do {
+		*--end = (char)('0' + value % 10);
+		value /= 10;
+	} while ( value );
+	return end;
+}
+
 static StringRef String_copyStringByAppendingString(const void *restrict const _self, const void *restrict const _other) {
 	const struct String *self = _self;
 	const struct String *other = _other;
-	return newStringWithFormat(classOf(self), "%s%s", getStringText(self), getStringText(other), NULL);
+	return newStringWithStrings(classOf(self), self, other, NULL);
 }
 
 static StringRef String_copyDescription(const void *restrict const _self) {
 	const struct String *self = _self;
-	return new(String, getStringText(self), NULL);
+	return newWithArguments(String, &(StringArguments){ getStringText(self), getStringLength(self) });
 }
 
-const void * String = NULL;
-const void * StringClass = NULL;
+CO_CLASS_STORAGE_DECL(String)
 
 static const char * String_getStringText (const void *const _self) {
 	const struct String *self = _self;
@@ -182,12 +290,28 @@ static SComparisonResult String_compareWithOptions (const void *const _self, con
 	const struct String *self = _self;
 	const struct String *other = _other;
 	SComparisonResult result = SSame;
+	if ( self == other ) return SSame;
+	/* Bounded by the lengths, null bytes compared as any other, the shorter text coming first when it is a prefix of the other */
+	UInteger selfLength = getStringLength(self), otherLength = getStringLength(other);
+	UInteger length = selfLength < otherLength ? selfLength : otherLength;
+	const char *selfText = selfLength ? getStringText(self) : "", *otherText = otherLength ? getStringText(other) : "";
 	if (options == SStringComparingOptionLiteralSearch )
-		result = strcmp(getStringText(self), getStringText(other));
+		result = memcmp(selfText, otherText, length);
 	else if (options == SStringComparingOptionCaseInsensitiveSearch )
-		result =  strcasecmp(getStringText(self), getStringText(other));
-	else if (options == SStringComparingOptionLocalizedCompare )
-		result = strcoll(getStringText(self), getStringText(other));
+		result = COCompareCaseInsensitive(selfText, otherText, length);
+	else if (options == SStringComparingOptionLocalizedCompare ) {
+		if ( selfText[selfLength] == '\0' && otherText[otherLength] == '\0' )
+			result = strcoll(selfText, otherText);
+		else { /* strcoll needs null terminated texts */
+			char *selfCopy = strndup(selfText, selfLength), *otherCopy = strndup(otherText, otherLength);
+			assert( selfCopy != NULL && otherCopy != NULL );
+			result = strcoll(selfCopy, otherCopy);
+			free(selfCopy), free(otherCopy);
+		}
+		return result < 0 ? SAscending : (result > 0 ? SDescending : SSame);
+	}
+	if ( result == 0 && selfLength != otherLength )
+		result = selfLength < otherLength ? -1 : 1;
 	
 	if (result<0)
 		return SAscending;
@@ -248,6 +372,25 @@ static inline void __rtrim(const char *restrict s, Range *restrict ioRange) {
 
 static inline void __trim(const char *restrict s, Range *restrict ioRange) { __ltrim(s, ioRange), __rtrim(s, ioRange); }
 
+static Range String_rangeOfStringWithOptionsInRange(const void *const self, const void *const other, SStringComparingOptions options, Range range) {
+	if ( MaxRange(range) > getStringLength(self) || MaxRange(range) < range.location ) return errno = EINVAL, MakeRange(NotFound, 0);
+	UInteger otherLength = getStringLength(other);
+	if ( otherLength == 0 || otherLength > range.length ) return MakeRange(NotFound, 0);
+	
+	const bool backwards = ( options & SStringComparingOptionBackwardsSearch ), caseInsensitive = ( options & SStringComparingOptionCaseInsensitiveSearch );
+	/* Anchored, the only candidate is where the range starts, or ends backwards */
+	if ( options & SStringComparingOptionAnchoredSearch )
+		range = MakeRange(backwards ? MaxRange(range) - otherLength : range.location, otherLength);
+	
+	const char *text = getStringText(self) + range.location, *otherText = getStringText(other);
+	const char *found = NULL;
+	if ( backwards )
+		found = caseInsensitive ? COSearchBackwardCaseInsensitive(text, range.length, otherText, otherLength) : COSearchBackward(text, range.length, otherText, otherLength);
+	else
+		found = caseInsensitive ? COSearchForwardCaseInsensitive(text, range.length, otherText, otherLength) : COSearchForward(text, range.length, otherText, otherLength);
+	return found ? MakeRange(range.location + (UInteger)(found - text), otherLength) : MakeRange(NotFound, 0);
+}
+
 static StringRef String_copyStringByTrimmingSpaces(const void *const self) {
 	Range range = MakeRange(0, getStringLength(self));
 	const char *text = getStringText(self);
@@ -255,27 +398,111 @@ static StringRef String_copyStringByTrimmingSpaces(const void *const self) {
 	
 	__trim( text, &range);
 	
-	char *result = strndup(text + range.location, range.length);
-	if ( result == NULL ) return NULL;
-	
-	StringRef copy = new(String, result, NULL);
-	free(result);
+	return newWithArguments(String, &(StringArguments){ text + range.location, range.length });
+}
+
+
+/* Interning */
+static struct _StringInternShard StringInternShards[STRING_INTERN_SHARDS];
+static pthread_once_t StringInternOnce = PTHREAD_ONCE_INIT;
+
+static void String_initInternTable(void) {
+	for (UInteger i=0; i<STRING_INTERN_SHARDS; i++)
+		pthread_mutex_init(&StringInternShards[i].lock, NULL);
+}
+
+/* Spreads the bits of a String hash, whose high bits are all zero for short texts, over the shards and the slots */
+static inline UInteger String_internMix(UInteger hash) {
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdUL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53UL;
+	return hash ^ (hash >> 33);
+}
+
+static struct String ** String_internSlot(struct String **strings, UInteger capacity, UInteger mixed, UInteger hash, const char *text, UInteger length) {
+	UInteger mask = capacity - 1;
+	for (UInteger i = (mixed >> 6) & mask; ; i = (i + 1) & mask) {
+		struct String *string = strings[i];
+		if ( string == NULL || (string->_hash == hash && string->length == length && memcmp(string->text, text, length) == 0) )
+			return strings + i;
+	}
+}
+
+static int String_growInternShard(struct _StringInternShard *const shard) {
+	UInteger capacity = shard->capacity ? shard->capacity * 2 : 64;
+	struct String **strings = calloc(capacity, sizeof(struct String *));
+	if ( strings == NULL ) return -1;
+	for (UInteger i=0; i<shard->capacity; i++) {
+		struct String *string = shard->strings[i];
+		if ( string ) {
+			UInteger mask = capacity - 1, j = (String_internMix(string->_hash) >> 6) & mask;
+			while ( strings[j] ) j = (j + 1) & mask;
+			strings[j] = string;
+		}
+	}
+	free(shard->strings);
+	shard->strings = strings;
+	shard->capacity = capacity;
+	return 0;
+}
+
+static StringRef String_intern(const char *const text, UInteger length) {
+	pthread_once(&StringInternOnce, String_initInternTable);
+	UInteger hash = String_hashText(text, length), mixed = String_internMix(hash);
+	struct _StringInternShard *const shard = StringInternShards + (mixed & (STRING_INTERN_SHARDS - 1));
 	
-	return copy;
+	pthread_mutex_lock(&shard->lock);
+	shard->lookups++;
+	struct String *string = NULL;
+	/* Kept at most three quarters full, the probe always ends */
+	if ( (shard->count + 1) * 4 > shard->capacity * 3 && String_growInternShard(shard) != 0 ) {
+		pthread_mutex_unlock(&shard->lock);
+		return errno = ENOMEM, NULL;
+	}
+	struct String **slot = String_internSlot(shard->strings, shard->capacity, mixed, hash, text, length);
+	if ( *slot )
+		string = *slot, shard->hits++;
+	else if ( (string = String_newWithLength(length)) ) {
+		memcpy((char *)string->text, text, length);
+		string->_hash = hash;
+		string->interned = YES;
+		*slot = string;
+		shard->count++;
+		shard->bytes += sizeof(struct String) + (string->text != string->inlineText ? length + 1 : 0);
+	}
+	pthread_mutex_unlock(&shard->lock);
+	return string;
 }
 
+static void String_emptyInternTable(void) {
+	for (UInteger i=0; i<STRING_INTERN_SHARDS; i++) {
+		struct _StringInternShard *const shard = StringInternShards + i;
+		for (UInteger j=0; j<shard->capacity; j++) {
+			struct String *string = shard->strings[j];
+			if ( string ) string->interned = NO, release(string);
+		}
+		free(shard->strings);
+		shard->strings = NULL;
+		shard->capacity = shard->count = shard->bytes = shard->lookups = shard->hits = 0;
+	}
+}
 
-void initString() {
+CO_CLASS_INIT_DECL(String) {
 	if ( ! StringClass )
 		StringClass = new(Class, "StringClass", Class, sizeof(struct StringClass), constructor, StringClass_constructor, NULL);
-	if ( ! String )
-		String = new(StringClass, "String", Object, sizeof(struct String),
+	if ( CO_CLASS_PENDING(String) )
+		CO_CLASS_PUBLISH(String, new(StringClass, "String", Object, sizeof(struct String),
 					 constructor, String_constructor,
+					 initializer, String_initializer,
 					 destructor, String_destructor,
 					 copy, String_copy,
 					 equals, String_equals,
 					 hash, String_hash,
 					 copyDescription, String_copyDescription,
+					 retain, String_retain,
+					 release, String_release,
+					 retainCount, String_retainCount,
 					 
 					 /* new */
 					 getStringText, String_getStringText,
@@ -289,14 +516,18 @@ void initString() {
 					 
 					 
 					 copyStringByTrimmingSpaces, String_copyStringByTrimmingSpaces,
-					 NULL);
+					 rangeOfStringWithOptionsInRange, String_rangeOfStringWithOptionsInRange,
+					 NULL));
 }
 
 void deallocString() {
 //	free((void *)String);
 //	free((void *)StringClass);
-	release((void *)String);
-	release((void *)StringClass);
+	String_emptyInternTable();
+	if (String)
+		release((void *)String);
+	if (StringClass)
+		release((void *)StringClass);
 	String = NULL;
 	StringClass = NULL;
 }
@@ -330,7 +561,7 @@ StringRef newStringWithFormat(const void *const _class, const void *format, ...)
 	COAssertNoNullOrReturn(_class,EINVAL,NULL);
 	COAssertNoNullOrReturn(format,EINVAL,NULL);
 	
-	const struct StringClass *const class = _class;
+	const struct StringClass *const class = COResolveClass(_class);
 	COAssertNoNullOrReturn(class,EINVAL,NULL);
 	COAssertNoNullOrReturn(class->newStringWithFormat,ENOTSUP,NULL);
 	
@@ -342,6 +573,113 @@ StringRef newStringWithFormat(const void *const _class, const void *format, ...)
 	return newString;
 }
 
+StringRef newStringWithInteger(const void *const _class, Integer value) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	const void *const class = COResolveClass(_class);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	
+	char buffer[24];
+	char *end = buffer + sizeof(buffer) - 1;
+	*end = '\0';
+	char *text = String_writeDigits(end, value < 0 ? 0 - (UInteger)value : (UInteger)value);
+	if ( value < 0 ) *--text = '-';
+	return String_newWithText(class, text, (UInteger)(end - text));
+}
+
+StringRef newStringWithDouble(const void *const _class, double value, UInteger decimals) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	const void *const class = COResolveClass(_class);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	
+	static const double scales[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+	double magnitude = value < 0 ? -value : value;
+	/* Out of the exact range of the fixed point path, NaN and infinities included */
+	if ( decimals >= sizeof(scales)/sizeof(scales[0]) || ! (magnitude * scales[decimals] < 9e18) )
+		return newStringWithFormat(class, "%.*f", (int)decimals, value, NULL);
+	
+	UInteger scaled = (UInteger)(magnitude * scales[decimals] + 0.5);
+	UInteger scale = (UInteger)scales[decimals];
+	char buffer[48];
+	char *end = buffer + sizeof(buffer) - 1;
+	*end = '\0';
+	char *text = end;
+	if ( decimals ) {
+		char *fraction = String_writeDigits(end, scaled % scale);
+		while ( end - fraction < (long)decimals )
+			*--fraction = '0';
+		*--fraction = '.';
+		text = fraction;
+	}
+	text = String_writeDigits(text, scaled / scale);
+	if ( signbit(value) ) *--text = '-';
+	return String_newWithText(class, text, (UInteger)(end - text));
+}
+
+StringRef newStringWithStrings(const void *const _class, const void *const first, ...) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	const void *const class = COResolveClass(_class);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	
+	va_list ap;
+	UInteger length = 0;
+	va_start(ap, first);
+	for (const void *string = first; string; string = va_arg(ap, const void *))
+		length += getStringLength(string);
+	va_end(ap);
+	
+	/* Copied straight into the new String, or into a buffer for the constructor of a subclass */
+	struct String *string = NULL;
+	char *text = NULL;
+	if ( class == String ) {
+		string = String_newWithLength(length);
+		text = string ? (char *)string->text : NULL;
+	}
+	else
+		text = malloc(length + 1);
+	assert(text != NULL);
+	if ( text == NULL ) return NULL;
+	
+	char *cursor = text;
+	va_start(ap, first);
+	for (const void *part = first; part; part = va_arg(ap, const void *)) {
+		UInteger partLength = getStringLength(part);
+		if ( partLength ) memcpy(cursor, getStringText(part), partLength);
+		cursor += partLength;
+	}
+	va_end(ap);
+	*cursor = '\0';
+	
+	if ( string ) return string;
+	StringRef newString = new(class, text, NULL);
+	free(text);
+	return newString;
+}
+
+StringRef componentsJoinedByString(const void *const array, const void *const separator) {
+	COAssertNoNullOrReturn(array,EINVAL,NULL);
+	/* Fast enumeration walks the collection once per pass, indexing a MutableArray would walk its list per component */
+	UInteger count = getCollectionCount(array);
+	UInteger separatorLength = separator ? getStringLength(separator) : 0;
+	UInteger length = count ? (count - 1) * separatorLength : 0;
+	foreach_start(const void *, component, array) {
+		length += getStringLength(component);
+	} foreach_end()
+	
+	struct String *string = String_newWithLength(length);
+	if ( string == NULL ) return NULL;
+	char *cursor = (char *)string->text;
+	const char *separatorText = separatorLength ? getStringText(separator) : NULL;
+	bool first = true;
+	foreach_start(const void *, component, array) {
+		if ( !first && separatorLength ) memcpy(cursor, separatorText, separatorLength), cursor += separatorLength;
+		first = false;
+		UInteger componentLength = getStringLength(component);
+		if ( componentLength ) memcpy(cursor, getStringText(component), componentLength);
+		cursor += componentLength;
+	} foreach_end()
+	return string;
+}
+
 SComparisonResult compare(const void *const self, const void *const other) {
 	COAssertNoNullOrReturn(self,EINVAL,-2);
 	COAssertNoNullOrReturn(other,EINVAL,-2);
@@ -392,4 +730,119 @@ StringRef copyStringByTrimmingSpaces(const void *const self) {
 	return class->copyStringByTrimmingSpaces(self);
 }
 
+Range rangeOfString(const void *const self, const void *const other) {
+	return rangeOfStringWithOptions(self, other, 0);
+}
 
+Range rangeOfStringWithOptions(const void *const self, const void *const other, SStringComparingOptions options) {
+	COAssertNoNullOrReturn(self,EINVAL,MakeRange(NotFound, 0));
+	return rangeOfStringWithOptionsInRange(self, other, options, MakeRange(0, getStringLength(self)));
+}
+
+Range rangeOfStringWithOptionsInRange(const void *const self, const void *const other, SStringComparingOptions options, Range range) {
+	COAssertNoNullOrReturn(self,EINVAL,MakeRange(NotFound, 0));
+	COAssertNoNullOrReturn(other,EINVAL,MakeRange(NotFound, 0));
+	const struct StringClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,MakeRange(NotFound, 0));
+	COAssertNoNullOrReturn(class->rangeOfStringWithOptionsInRange,ENOTSUP,MakeRange(NotFound, 0));
+	return class->rangeOfStringWithOptionsInRange(self, other, options, range);
+}
+
+StringSearch MakeStringSearch(const void *const string, const void *const needle, SStringComparingOptions options) {
+	StringSearch search = { string, needle, options, MakeRange(0, string ? getStringLength(string) : 0) };
+	return search;
+}
+
+Range nextRangeOfString(StringSearch *const search) {
+	COAssertNoNullOrReturn(search,EINVAL,MakeRange(NotFound, 0));
+	if ( search->range.length == 0 ) return MakeRange(NotFound, 0);
+	Range found = rangeOfStringWithOptionsInRange(search->string, search->needle, search->options, search->range);
+	if ( found.location == NotFound )
+		search->range.length = 0;
+	else if ( search->options & SStringComparingOptionBackwardsSearch )
+		search->range.length = found.location - search->range.location;
+	else
+		search->range = MakeRange(MaxRange(found), MaxRange(search->range) - MaxRange(found));
+	return found;
+}
+
+StringRef internString(const void *const string) {
+	COAssertNoNullOrReturn(string,EINVAL,NULL);
+	const struct String *self = string;
+	if ( classOf(self) == String && self->interned ) return (StringRef)self;
+	UInteger length = getStringLength(string);
+	return String_intern(length ? getStringText(string) : "", length);
+}
+
+StringRef internStringWithText(const char *const text, UInteger length) {
+	COAssertNoNullOrReturn(text,EINVAL,NULL);
+	return String_intern(text, length);
+}
+
+StringInternStatistics getStringInternStatistics(void) {
+	StringInternStatistics statistics = { 0, 0, 0, 0, 0 };
+	pthread_once(&StringInternOnce, String_initInternTable);
+	for (UInteger i=0; i<STRING_INTERN_SHARDS; i++) {
+		struct _StringInternShard *const shard = StringInternShards + i;
+		pthread_mutex_lock(&shard->lock);
+		statistics.count += shard->count;
+		statistics.bytes += shard->bytes;
+		statistics.tableBytes += shard->capacity * sizeof(struct String *);
+		statistics.lookups += shard->lookups;
+		statistics.hits += shard->hits;
+		pthread_mutex_unlock(&shard->lock);
+	}
+	return statistics;
+}
+
+/* UTF-8 */
+
+StringRef newStringWithUTF8Text(const void *const _class, const char *const text, UInteger length) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	COAssertNoNullOrReturn(text,EINVAL,NULL);
+	const void *const class = COResolveClass(_class);
+	if ( ! COUTF8Validate(text, length) ) return errno = EILSEQ, NULL;
+	if ( class != String ) {
+		char *copy = strndup(text, length);
+		if ( copy == NULL ) return errno = ENOMEM, NULL;
+		StringRef newString = new(class, copy, NULL);
+		free(copy);
+		return newString;
+	}
+	struct String *string = String_newWithLength(length);
+	if ( string == NULL ) return NULL;
+	memcpy((char *)string->text, text, length);
+	string->utf8 = StringUTF8Valid;
+	return string;
+}
+
+bool isStringValidUTF8(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	struct String *string = (struct String *)self;
+	if ( string->utf8 != StringUTF8Unknown ) return string->utf8 == StringUTF8Valid;
+	UInteger length = getStringLength(self);
+	bool valid = length == 0 || COUTF8Validate(getStringText(self), length);
+	/* The text of the subclasses may change */
+	if ( classOf(self) == String )
+		string->utf8 = valid ? StringUTF8Valid : StringUTF8Invalid;
+	return valid;
+}
+
+UInteger getStringUTF8Length(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NotFound);
+	if ( ! isStringValidUTF8(self) ) return errno = EILSEQ, NotFound;
+	UInteger length = getStringLength(self);
+	return length ? COUTF8CountCodePoints(getStringText(self), length) : 0;
+}
+
+Range rangeOfUTF8CharacterAtIndex(const void *const self, UInteger index) {
+	COAssertNoNullOrReturn(self,EINVAL,MakeRange(NotFound, 0));
+	if ( ! isStringValidUTF8(self) ) return errno = EILSEQ, MakeRange(NotFound, 0);
+	UInteger length = getStringLength(self);
+	const char *text = getStringText(self);
+	UInteger location = length ? COUTF8OffsetOfCodePoint(text, length, index) : NotFound;
+	if ( location == NotFound ) return errno = EINVAL, MakeRange(NotFound, 0);
+	/* The length of a valid sequence follows from its lead byte */
+	unsigned char lead = (unsigned char)text[location];
+	return MakeRange(location, lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4);
+}
@@ -0,0 +1,163 @@
+//
+//  StringSlice.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <StringSlice.r>
+
+CO_CLASS_STORAGE_DECL(StringSlice)
+
+/* Points self at range of parent, the text of String skipped as the slice does not own one */
+static void * StringSlice_slice(struct StringSlice *const self, const void *const _parent, Range range) {
+	struct String *stringSelf = (struct String *)self;
+	/* The destructor gives back a slice of nothing as well */
+	self->parent = NULL;
+	if ( _parent == NULL || MaxRange(range) > getStringLength(_parent) || MaxRange(range) < range.location )
+		return MEMORY_MANAGEMENT_RELEASE(self), errno = EINVAL, NULL;
+
+	StringRef parent = NULL;
+	if ( classOf(_parent) == StringSlice ) {
+		const struct StringSlice *slice = _parent;
+		parent = retain(slice->parent);
+		range.location += slice->range.location;
+	}
+	else if ( classOf(_parent) == String )
+		parent = retain((void *)_parent);
+	else /* The text of a subclass may change or move */
+		parent = newWithArguments(String, &(StringArguments){ getStringText(_parent), getStringLength(_parent) });
+
+	const char *text = getStringText(parent);
+	self->parent = parent;
+	self->range = range;
+	stringSelf->text = text ? text + range.location : NULL;
+	stringSelf->length = range.length;
+	stringSelf->_hash = 0;
+	return self;
+}
+
+static void * StringSlice_constructor (void * _self, va_list * app) {
+	struct StringSlice *self = super_constructor(String, _self, app);
+	const void *parent = va_arg(*app, const void *);
+	Range range = va_arg(*app, Range);
+	return StringSlice_slice(self, parent, range);
+}
+
+static void * StringSlice_initializer (void * _self, const void *const _arguments) {
+	const StringSliceArguments *arguments = _arguments;
+	COAssertNoNullOrReturn(arguments,EINVAL,NULL);
+	struct StringSlice *self = super_initializer(String, _self, _arguments);
+	return StringSlice_slice(self, arguments->parent, arguments->range);
+}
+
+static void * StringSlice_destructor (void * _self) {
+	/* The text is the parent's */
+	((struct String *)_self)->text = NULL;
+	struct StringSlice *self = super_destructor(StringSlice, _self);
+	if ( self->parent ) release(self->parent), self->parent = NULL;
+	return self;
+}
+
+static void * StringSliceClass_constructor (void * _self, va_list *app) {
+	struct StringSliceClass * self = super_constructor(StringSliceClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) getStringSliceParent )
+			* (voidf *) & self->getStringSliceParent = method;
+		else if (selector == (voidf) getStringSliceRange )
+			* (voidf *) & self->getStringSliceRange = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+/* Materializes the slice */
+static void * StringSlice_copy (const void * const _self) {
+	const struct String *self = _self;
+	StringRef _copy = newWithArguments(String, &(StringArguments){ self->text, self->length });
+	struct String *copy = _copy;
+	if ( copy ) copy->_hash = self->_hash;
+	return _copy;
+}
+
+static StringRef StringSlice_copyStringByAppendingString(const void *restrict const _self, const void *restrict const _other) {
+	/* A plain String: the constructor of a slice takes a parent */
+	return newStringWithStrings(String, _self, _other, NULL);
+}
+
+static StringRef StringSlice_getStringSliceParent(const void *const _self) {
+	const struct StringSlice *self = _self;
+	return self->parent;
+}
+
+static Range StringSlice_getStringSliceRange(const void *const _self) {
+	const struct StringSlice *self = _self;
+	return self->range;
+}
+
+CO_CLASS_INIT_DECL(StringSlice) {
+	initString();
+
+	if ( ! StringSliceClass )
+		StringSliceClass = new(StringClass, "StringSliceClass", StringClass, sizeof(struct StringSliceClass),
+							   constructor, StringSliceClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(StringSlice) )
+		CO_CLASS_PUBLISH(StringSlice, new(StringSliceClass, "StringSlice", String, sizeof(struct StringSlice),
+						  constructor, StringSlice_constructor,
+						  initializer, StringSlice_initializer,
+						  destructor, StringSlice_destructor,
+
+						  /* Overrides */
+						  copy, StringSlice_copy,
+						  copyDescription, StringSlice_copy,
+						  copyStringByAppendingString, StringSlice_copyStringByAppendingString,
+
+						  /* new */
+						  getStringSliceParent, StringSlice_getStringSliceParent,
+						  getStringSliceRange, StringSlice_getStringSliceRange,
+						  NULL));
+}
+
+void deallocStringSlice() {
+	release((void *)StringSlice), StringSlice = NULL;
+	release((void *)StringSliceClass), StringSliceClass = NULL;
+}
+
+/* API */
+
+StringRef newStringSlice(const void *const string, Range range) {
+	COAssertNoNullOrReturn(string,EINVAL,NULL);
+	if ( MaxRange(range) > getStringLength(string) || MaxRange(range) < range.location )
+		return errno = EINVAL, NULL;
+	return newWithArguments(StringSlice, &(StringSliceArguments){ string, range });
+}
+
+StringRef getStringSliceParent(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct StringSliceClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->getStringSliceParent,ENOTSUP,NULL);
+	return class->getStringSliceParent(self);
+}
+
+Range getStringSliceRange(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,MakeRange(0, 0));
+	const struct StringSliceClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,MakeRange(0, 0));
+	COAssertNoNullOrReturn(class->getStringSliceRange,ENOTSUP,MakeRange(0, 0));
+	return class->getStringSliceRange(self);
+}
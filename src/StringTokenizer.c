@@ -0,0 +1,241 @@
+//
+//  StringTokenizer.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <cosearch.h>
+#include <StringTokenizer.r>
+#include <StringSlice.r>
+
+CO_CLASS_STORAGE_DECL(StringTokenizer)
+
+/* A separator of the text of string, which must outlive it */
+static void StringTokenizer_separatorWithString(struct _StringTokenizerSeparator *const separator, const void *const string) {
+	memset(separator, 0, sizeof(*separator));
+	separator->length = getStringLength(string);
+	separator->text = separator->length ? getStringText(string) : "";
+}
+
+static void StringTokenizer_separatorWithCharacters(struct _StringTokenizerSeparator *const separator, const char *characters) {
+	memset(separator, 0, sizeof(*separator));
+	separator->length = 1;
+	UInteger count = 0;
+	for (const unsigned char *c = (const unsigned char *)characters; *c; c++) {
+		if ( ! (separator->characters[*c >> 3] & (1 << (*c & 7))) )
+			count++;
+		separator->characters[*c >> 3] |= (unsigned char)(1 << (*c & 7));
+		separator->character = (char)*c;
+	}
+	/* A single character is searched for with memchr, no character at all separates nothing */
+	if ( count == 1 )
+		separator->text = &separator->character;
+	else if ( count == 0 )
+		separator->text = "", separator->length = 0;
+}
+
+/* Where the separator next occurs in text from location on, or length if it does not */
+static UInteger StringTokenizer_fieldEnd(const struct _StringTokenizerSeparator *const separator, const char *const text, UInteger length, UInteger location) {
+	if ( separator->text == NULL ) {
+		for (const unsigned char *c = (const unsigned char *)text + location, *end = (const unsigned char *)text + length; c < end; c++)
+			if ( separator->characters[*c >> 3] & (1 << (*c & 7)) )
+				return (UInteger)(c - (const unsigned char *)text);
+		return length;
+	}
+	if ( separator->length == 0 ) return length;
+	const char *found = separator->length == 1
+		? memchr(text + location, *separator->text, length - location)
+		: COSearchForward(text + location, length - location, separator->text, separator->length);
+	return found ? (UInteger)(found - text) : length;
+}
+
+/* The plain String whose text the fields of string are slices of, retained, and the range of it that string spans */
+static StringRef StringTokenizer_root(const void *const string, Range *const range) {
+	if ( classOf(string) == StringSlice ) {
+		const struct StringSlice *slice = string;
+		*range = slice->range;
+		return retain(slice->parent);
+	}
+	*range = MakeRange(0, getStringLength(string));
+	if ( classOf(string) == String )
+		return retain((void *)string);
+	/* The text of a subclass may change or move */
+	return newWithArguments(String, &(StringArguments){ getStringText(string), range->length });
+}
+
+/* Points the slice at range of its root, as new(StringSlice, root, range, NULL) would */
+static void StringTokenizer_repoint(struct StringSlice *const slice, Range range) {
+	struct String *stringSlice = (struct String *)slice;
+	stringSlice->text = getStringText(slice->parent) + range.location;
+	stringSlice->length = range.length;
+	stringSlice->_hash = 0;
+	slice->range = range;
+}
+
+static void * StringTokenizer_tokenize(struct StringTokenizer *const self, const void *const string, const void *const separator, const char *const characters) {
+	/* Nothing is retained yet, so the destructor has nothing to give back */
+	if ( string == NULL || (separator == NULL && characters == NULL) )
+		return MEMORY_MANAGEMENT_RELEASE(self), errno = EINVAL, NULL;
+	self->root = StringTokenizer_root(string, &self->range);
+	if ( separator ) {
+		/* Kept for its text */
+		self->separatorString = copy(separator);
+		StringTokenizer_separatorWithString(&self->separator, self->separatorString);
+	}
+	else
+		StringTokenizer_separatorWithCharacters(&self->separator, characters);
+	return self;
+}
+
+static void * StringTokenizer_constructor (void * _self, va_list * app) {
+	struct StringTokenizer *self = super_constructor(StringTokenizer, _self, app);
+	const void *string = va_arg(*app, const void *);
+	const void *separator = va_arg(*app, const void *);
+	return StringTokenizer_tokenize(self, string, separator, NULL);
+}
+
+static void * StringTokenizer_initializer (void * _self, const void *const _arguments) {
+	const StringTokenizerArguments *arguments = _arguments;
+	COAssertNoNullOrReturn(arguments,EINVAL,NULL);
+	/* Collection has no initializer of its own, nor anything to set up */
+	struct StringTokenizer *self = Object_initializer(_self, _arguments);
+	return StringTokenizer_tokenize(self, arguments->string, arguments->separator, arguments->characters);
+}
+
+static void StringTokenizer_releaseFields(struct StringTokenizer *const self) {
+	for (UInteger i=0; i<STRING_TOKENIZER_BATCH; i++)
+		if ( self->fields[i] ) release(self->fields[i]), self->fields[i] = NULL;
+}
+
+static void * StringTokenizer_destructor (void * _self) {
+	struct StringTokenizer *self = super_destructor(StringTokenizer, _self);
+	StringTokenizer_releaseFields(self);
+	if ( self->separatorString ) release(self->separatorString), self->separatorString = NULL;
+	if ( self->root ) release(self->root), self->root = NULL;
+	return self;
+}
+
+static UInteger StringTokenizer_getCollectionCount(const void *const _self) {
+	const struct StringTokenizer *self = _self;
+	const char *text = getStringText(self->root);
+	UInteger count = 1, end = MaxRange(self->range);
+	for (UInteger location = self->range.location; (location = StringTokenizer_fieldEnd(&self->separator, text, end, location)) < end; location += self->separator.length)
+		count++;
+	return count;
+}
+
+/* state->extra[0] is where the next field starts in the root, state->state 2 once the last field was handed out */
+static UInteger StringTokenizer_enumerateWithState(const void *const _self, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
+	struct StringTokenizer *self = (struct StringTokenizer *)_self;
+	if ( state->state == 0 ) {
+		state->mutationsPointer = &self->mutations;
+		state->extra[0] = self->range.location;
+		state->state = 1;
+	}
+	if ( state->state == 2 ) return StringTokenizer_releaseFields(self), 0;
+
+	const char *text = getStringText(self->root);
+	UInteger end = MaxRange(self->range), location = state->extra[0], count = 0;
+	if ( length > STRING_TOKENIZER_BATCH ) length = STRING_TOKENIZER_BATCH;
+	for (; count<length && state->state == 1; count++) {
+		UInteger fieldEnd = StringTokenizer_fieldEnd(&self->separator, text, end, location);
+		Range range = MakeRange(location, fieldEnd - location);
+		/* A field only the tokenizer holds is re-pointed, one retained elsewhere is left to its owners */
+		StringRef field = self->fields[count];
+		if ( field && retainCount(field) == 1 )
+			StringTokenizer_repoint(field, range);
+		else {
+			if ( field ) release(field);
+			self->fields[count] = new(StringSlice, self->root, range, NULL);
+		}
+		if ( fieldEnd == end )
+			state->state = 2;
+		else
+			location = fieldEnd + self->separator.length;
+	}
+	state->extra[0] = location;
+	state->itemsPointer = (void **)self->fields;
+	return count;
+}
+
+static VectorRef StringTokenizer_components(const void *const string, const struct _StringTokenizerSeparator *const separator) {
+	Range range;
+	StringRef root = StringTokenizer_root(string, &range);
+	VectorRef components = new(Vector, 0UL, 0UL, NULL);
+	const char *text = getStringText(root);
+	UInteger end = MaxRange(range), location = range.location;
+	for (;;) {
+		UInteger fieldEnd = StringTokenizer_fieldEnd(separator, text, end, location);
+		StringRef field = new(StringSlice, root, MakeRange(location, fieldEnd - location), NULL);
+		addObject(components, field);
+		release(field);
+		if ( fieldEnd == end ) break;
+		location = fieldEnd + separator->length;
+	}
+	release(root);
+	return components;
+}
+
+CO_CLASS_INIT_DECL(StringTokenizer) {
+	initCollection();
+	initStringSlice();
+	initVector();
+
+	if ( ! StringTokenizerClass )
+		StringTokenizerClass = new(CollectionClass, "StringTokenizerClass", CollectionClass, sizeof(struct StringTokenizerClass), NULL);
+	if ( CO_CLASS_PENDING(StringTokenizer) )
+		CO_CLASS_PUBLISH(StringTokenizer, new(StringTokenizerClass, "StringTokenizer", Collection, sizeof(struct StringTokenizer),
+							  constructor, StringTokenizer_constructor,
+							  initializer, StringTokenizer_initializer,
+							  destructor, StringTokenizer_destructor,
+
+							  /* Overrides */
+							  getCollectionCount, StringTokenizer_getCollectionCount,
+							  enumerateWithState, StringTokenizer_enumerateWithState,
+							  NULL));
+}
+
+void deallocStringTokenizer() {
+	release((void *)StringTokenizer), StringTokenizer = NULL;
+	release((void *)StringTokenizerClass), StringTokenizerClass = NULL;
+}
+
+/* API */
+
+StringTokenizerRef newStringTokenizer(const void *const string, const void *const separator) {
+	COAssertNoNullOrReturn(string,EINVAL,NULL);
+	COAssertNoNullOrReturn(separator,EINVAL,NULL);
+	return newWithArguments(StringTokenizer, &(StringTokenizerArguments){ string, separator, NULL });
+}
+
+StringTokenizerRef newStringTokenizerWithCharacters(const void *const string, const char *const characters) {
+	COAssertNoNullOrReturn(string,EINVAL,NULL);
+	COAssertNoNullOrReturn(characters,EINVAL,NULL);
+	return newWithArguments(StringTokenizer, &(StringTokenizerArguments){ string, NULL, characters });
+}
+
+VectorRef componentsSeparatedByString(const void *const self, const void *const separator) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	COAssertNoNullOrReturn(separator,EINVAL,NULL);
+	struct _StringTokenizerSeparator stringSeparator;
+	StringTokenizer_separatorWithString(&stringSeparator, separator);
+	return StringTokenizer_components(self, &stringSeparator);
+}
+
+VectorRef componentsSeparatedByCharacters(const void *const self, const char *const characters) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	COAssertNoNullOrReturn(characters,EINVAL,NULL);
+	struct _StringTokenizerSeparator charactersSeparator;
+	StringTokenizer_separatorWithCharacters(&charactersSeparator, characters);
+	return StringTokenizer_components(self, &charactersSeparator);
+}
@@ -6,16 +6,23 @@
 //  Copyright (c) 2013 George Boumis. All rights reserved.
 //
 
+/* Affinity and two argument pthread_setname_np are GNU extensions; elsewhere affinity is not supported */
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdarg.h>
+#include <unistd.h>
+#include <sched.h>
 #include <pthread.h>
 
 #include <cobj.h>
 #include <Thread.r>
 
-const void * Thread = NULL;
-const void * ThreadClass = NULL;
+CO_CLASS_STORAGE_DECL(Thread)
 
 static void * Thread_constructor (void * _self, va_list * app) {
 	struct Thread *self = super_constructor(Thread, _self, app);
@@ -27,10 +34,36 @@ static void * Thread_constructor (void * _self, va_list * app) {
 	
 	void *threadArgument = va_arg(*app, void *);
 	self->threadArgument = threadArgument;
+	memset(&(self->attributes), 0, sizeof(ThreadAttributes));
+	self->name[0] = '\0';
+	self->started = NO;
 
 	return self;
 }
 
+static void * Thread_initializer (void * _self, const void *const _arguments) {
+	const ThreadArguments *arguments = _arguments;
+	COAssertNoNullOrReturn(arguments,EINVAL,NULL);
+	COAssertNoNullOrReturn(arguments->function,EINVAL,NULL);
+	
+	struct Thread *self = super_initializer(Thread, _self, _arguments);
+	self->threadFunction = arguments->function;
+	self->threadArgument = arguments->argument;
+	memset(&(self->attributes), 0, sizeof(ThreadAttributes));
+	self->name[0] = '\0';
+	self->started = NO;
+	if ( arguments->attributes ) {
+		self->attributes = *(arguments->attributes);
+		/* The name is copied, the caller's string need not outlive self */
+		if ( self->attributes.name ) {
+			strncpy(self->name, self->attributes.name, THREAD_NAME_LENGTH - 1);
+			self->name[THREAD_NAME_LENGTH - 1] = '\0';
+		}
+		self->attributes.name = NULL;
+	}
+	return self;
+}
+
 static void * Thread_destructor (void * _self) {
 	struct Thread *self = super_destructor(Thread, _self);
 	return self;
@@ -50,6 +83,8 @@ static void * ThreadClass_constructor (void * _self, va_list *app) {
 			* (voidf *) & self->joinThread = method;
 		else if (selector == (voidf) getPthread )
 			* (voidf *) & self->getPthread = method;
+		else if (selector == (voidf) pinThreadToProcessor )
+			* (voidf *) & self->pinThreadToProcessor = method;
 	}
 	va_end(ap);
 	return self;
@@ -71,28 +106,124 @@ static bool Thread_equals (const void * const _self, const void *const _other) {
 			);
 }
 
+#define THREAD_AFFINITY_WORD_BITS (8 * sizeof(UInteger))
+
+static bool Thread_hasAffinity(const ThreadAttributes *const attributes) {
+	for (UInteger i=0; i<THREAD_AFFINITY_PROCESSORS / THREAD_AFFINITY_WORD_BITS; i++)
+		if ( attributes->affinity[i] )
+			return YES;
+	return NO;
+}
+
+#if defined(__linux__)
+static void Thread_getCPUSet(const ThreadAttributes *const attributes, cpu_set_t *const set) {
+	CPU_ZERO(set);
+	for (UInteger processor=0; processor<THREAD_AFFINITY_PROCESSORS && processor<CPU_SETSIZE; processor++)
+		if ( attributes->affinity[processor / THREAD_AFFINITY_WORD_BITS] & ((UInteger)1 << (processor % THREAD_AFFINITY_WORD_BITS)) )
+			CPU_SET(processor, set);
+}
+#endif
+
+/* Translates the attributes of self, returns an error number */
+static int Thread_makeAttributes(const struct Thread *const self, pthread_attr_t *const attributes) {
+	int error = pthread_attr_init(attributes);
+	if ( error ) return error;
+	if ( self->attributes.stackSize )
+		error = pthread_attr_setstacksize(attributes, self->attributes.stackSize);
+	if ( ! error && self->attributes.detached )
+		error = pthread_attr_setdetachstate(attributes, PTHREAD_CREATE_DETACHED);
+	if ( ! error && self->attributes.explicitScheduling ) {
+		struct sched_param parameters = { .sched_priority = self->attributes.schedulingPriority };
+		error = pthread_attr_setinheritsched(attributes, PTHREAD_EXPLICIT_SCHED);
+		if ( ! error ) error = pthread_attr_setschedpolicy(attributes, self->attributes.schedulingPolicy);
+		if ( ! error ) error = pthread_attr_setschedparam(attributes, &parameters);
+	}
+	if ( ! error && Thread_hasAffinity(&(self->attributes)) ) {
+#if defined(__linux__)
+		cpu_set_t set;
+		Thread_getCPUSet(&(self->attributes), &set);
+		error = pthread_attr_setaffinity_np(attributes, sizeof(cpu_set_t), &set);
+#else
+		error = ENOTSUP;
+#endif
+	}
+	if ( error ) pthread_attr_destroy(attributes);
+	return error;
+}
+
+/* Names the thread from within, so that a detached thread is never named after it exited */
+static void * Thread_run(void *argument) {
+	struct Thread *self = argument;
+	voidf threadFunction = self->threadFunction;
+	void *threadArgument = self->threadArgument;
+#if defined(__linux__)
+	pthread_setname_np(pthread_self(), self->name);
+#elif defined(__APPLE__)
+	pthread_setname_np(self->name);
+#endif
+	release(self);
+	return threadFunction(threadArgument);
+}
+
 static void Thread_startThread(const void *const _self) {
 	struct Thread *self = (struct Thread *)_self;
-	pthread_create(&(self->thread), NULL, self->threadFunction, self->threadArgument);
+	pthread_attr_t attributes;
+	int error = Thread_makeAttributes(self, &attributes);
+	if ( error ) { errno = error; return; }
+
+	bool named = ( self->name[0] != '\0' );
+	if ( named )
+		error = pthread_create(&(self->thread), &attributes, Thread_run, retain(self));
+	else
+		error = pthread_create(&(self->thread), &attributes, self->threadFunction, self->threadArgument);
+	pthread_attr_destroy(&attributes);
+	if ( error ) {
+		if ( named ) release(self);
+		errno = error;
+		return;
+	}
+	self->started = YES;
 }
 
 static void Thread_joinThread(const void *const _self, void **exit) {
 	struct Thread *self = (struct Thread *)_self;
+	if ( ! self->started || self->attributes.detached ) { errno = EINVAL; return; }
 	pthread_join(self->thread, exit);
 }
 
+static bool Thread_pinThreadToProcessor(void *const _self, UInteger processor) {
+#if defined(__linux__)
+	struct Thread *self = _self;
+	if ( processor >= THREAD_AFFINITY_PROCESSORS ) return errno = EINVAL, NO;
+	memset(self->attributes.affinity, 0, sizeof(self->attributes.affinity));
+	ThreadAttributesAddProcessor(&(self->attributes), processor);
+	if ( ! self->started )
+		return YES;
+	/* A detached thread may be gone, its pthread_t with it */
+	if ( self->attributes.detached ) return errno = EINVAL, NO;
+	cpu_set_t set;
+	Thread_getCPUSet(&(self->attributes), &set);
+	int error = pthread_setaffinity_np(self->thread, sizeof(cpu_set_t), &set);
+	if ( error ) return errno = error, NO;
+	return YES;
+#else
+	return errno = ENOTSUP, NO;
+#endif
+}
+
 static pthread_t *Thread_getPthread(const void *const _self) {
 	struct Thread *self = (struct Thread *)_self;
 	return &(self->thread);
 }
 
-void initThread() {
+CO_CLASS_INIT_DECL(Thread) {
 	if ( ! ThreadClass )
 		ThreadClass = new(Class, "ThreadClass", Class, sizeof(struct ThreadClass),
 						  constructor, ThreadClass_constructor, NULL);
-	if ( ! Thread )
-		Thread = new(ThreadClass, "Thread", Object, sizeof(struct Thread),
+	if ( CO_CLASS_PENDING(Thread) )
+		CO_CLASS_PUBLISH(Thread, new(ThreadClass, "Thread", Object, sizeof(struct Thread),
 					 constructor, Thread_constructor,
+					 initializer, Thread_initializer,
 					 destructor, Thread_destructor,
 					 
 					 /* Oveerrides */
@@ -103,7 +234,8 @@ void initThread() {
 					 startThread, Thread_startThread,
 					 joinThread, Thread_joinThread,
 					 getPthread, Thread_getPthread,
-					 NULL);
+					 pinThreadToProcessor, Thread_pinThreadToProcessor,
+					 NULL));
 }
 
 void deallocThread() {
@@ -140,3 +272,27 @@ pthread_t * getPthread(const void *const self) {
 	return class->getPthread(self);
 }
 
+bool pinThreadToProcessor(void *const self, UInteger processor) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	const struct ThreadClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->pinThreadToProcessor,ENOTSUP,NO);
+	return class->pinThreadToProcessor(self, processor);
+}
+
+bool pinThreadsToProcessors(const void *const threads, UInteger firstProcessor) {
+	COAssertNoNullOrReturn(threads,EINVAL,NO);
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	UInteger processorCount = processors > 0 ? (UInteger)processors : 1;
+	UInteger count = getCollectionCount(threads);
+	for (UInteger i=0; i<count; i++)
+		if ( ! pinThreadToProcessor(getObjectAtIndex(threads, i), (firstProcessor + i) % processorCount) )
+			return NO;
+	return YES;
+}
+
+void ThreadAttributesAddProcessor(ThreadAttributes *const attributes, UInteger processor) {
+	COAssertNoNullOrBailOut(attributes,EINVAL);
+	if ( processor >= THREAD_AFFINITY_PROCESSORS ) { errno = EINVAL; return; }
+	attributes->affinity[processor / THREAD_AFFINITY_WORD_BITS] |= (UInteger)1 << (processor % THREAD_AFFINITY_WORD_BITS);
+}
@@ -0,0 +1,675 @@
+//
+//  ThreadPool.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <ThreadPool.r>
+
+/* Tasks are counted twice: pending while they sit in a deque, unfinished until they returned. Idle workers park on
+ * work once pending is zero; a submitter only takes the parking lock when it sees a parked worker, both sides
+ * publishing their counter before reading the other one. waitForTasks parks on finished until unfinished is zero.
+ * Shutting down first waits for unfinished to drop to zero, then stops the workers. */
+
+CO_CLASS_STORAGE_DECL(ThreadPool)
+
+#define THREAD_POOL_INITIAL_DEQUE_CAPACITY 64
+
+/* The worker running on the current thread, if any, so that tasks submitting tasks push on their own deque */
+static __thread struct _ThreadPoolWorker *ThreadPoolCurrentWorker = NULL;
+
+static void * ThreadPool_work(void *argument);
+
+static void * ThreadPool_constructor (void * _self, va_list * app) {
+	UInteger workerCount = va_arg(*app, UInteger);
+	if ( workerCount == 0 ) {
+		long processors = sysconf(_SC_NPROCESSORS_ONLN);
+		workerCount = processors > 0 ? (UInteger)processors : 1;
+	}
+
+	/* Allocated before the object is set up, so that giving it back does not run its destructor */
+	struct _ThreadPoolWorker *workers = calloc(workerCount, sizeof(struct _ThreadPoolWorker));
+	assert( workers != NULL );
+	if ( workers == NULL ) return MEMORY_MANAGEMENT_RELEASE(_self), errno = ENOMEM, NULL;
+	struct ThreadPool *self = super_constructor(ThreadPool, _self, app);
+	self->workers = workers;
+	self->workerCount = workerCount;
+	self->nextWorker = 0;
+	self->pending = self->unfinished = self->idleWorkers = 0;
+	self->shuttingDown = self->stopping = NO;
+	pthread_mutex_init(&(self->parking), NULL);
+	pthread_cond_init(&(self->work), NULL);
+	pthread_cond_init(&(self->finished), NULL);
+
+	for (UInteger i=0; i<workerCount; i++) {
+		struct _ThreadPoolWorker *worker = &(self->workers[i]);
+		worker->pool = self;
+		worker->index = i;
+		pthread_mutex_init(&(worker->lock), NULL);
+		worker->tasks = malloc(THREAD_POOL_INITIAL_DEQUE_CAPACITY * sizeof(struct _ThreadPoolTask));
+		assert( worker->tasks != NULL );
+		worker->mask = THREAD_POOL_INITIAL_DEQUE_CAPACITY - 1;
+		worker->top = worker->bottom = 0;
+		worker->completed = worker->stolen = 0;
+	}
+	for (UInteger i=0; i<workerCount; i++) {
+		self->workers[i].thread = new(Thread, ThreadPool_work, &(self->workers[i]), NULL);
+		startThread(self->workers[i].thread);
+	}
+	return self;
+}
+
+static void ThreadPool_shutdownThreadPool(void *const _self);
+
+static void * ThreadPool_destructor (void * _self) {
+	struct ThreadPool *self = super_destructor(ThreadPool, _self);
+	ThreadPool_shutdownThreadPool(self);
+	for (UInteger i=0; i<self->workerCount; i++) {
+		struct _ThreadPoolWorker *worker = &(self->workers[i]);
+		release(worker->thread), worker->thread = NULL;
+		free(worker->tasks), worker->tasks = NULL;
+		pthread_mutex_destroy(&(worker->lock));
+	}
+	free(self->workers), self->workers = NULL;
+	pthread_cond_destroy(&(self->finished));
+	pthread_cond_destroy(&(self->work));
+	pthread_mutex_destroy(&(self->parking));
+	return self;
+}
+
+static void * ThreadPoolClass_constructor (void * _self, va_list *app) {
+	struct ThreadPoolClass * self = super_constructor(ThreadPoolClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) submitTask )
+			* (voidf *) & self->submitTask = method;
+		else if (selector == (voidf) waitForTasks )
+			* (voidf *) & self->waitForTasks = method;
+		else if (selector == (voidf) shutdownThreadPool )
+			* (voidf *) & self->shutdownThreadPool = method;
+		else if (selector == (voidf) getThreadPoolWorkerCount )
+			* (voidf *) & self->getThreadPoolWorkerCount = method;
+		else if (selector == (voidf) getThreadPoolPendingTaskCount )
+			* (voidf *) & self->getThreadPoolPendingTaskCount = method;
+		else if (selector == (voidf) getThreadPoolCompletedTaskCount )
+			* (voidf *) & self->getThreadPoolCompletedTaskCount = method;
+		else if (selector == (voidf) getThreadPoolStolenTaskCount )
+			* (voidf *) & self->getThreadPoolStolenTaskCount = method;
+		else if (selector == (voidf) parallelForRange )
+			* (voidf *) & self->parallelForRange = method;
+		else if (selector == (voidf) parallelMapIntoVector )
+			* (voidf *) & self->parallelMapIntoVector = method;
+		else if (selector == (voidf) parallelReduce )
+			* (voidf *) & self->parallelReduce = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+static void * ThreadPool_copy (const void * const _self) {
+	return NULL;
+}
+
+static void ThreadPool_push(struct _ThreadPoolWorker *const worker, struct _ThreadPoolTask task) {
+	pthread_mutex_lock(&(worker->lock));
+	if ( worker->bottom - worker->top > worker->mask ) {
+		UInteger capacity = 2 * (worker->mask + 1);
+		struct _ThreadPoolTask *tasks = malloc(capacity * sizeof(struct _ThreadPoolTask));
+		assert( tasks != NULL );
+		for (UInteger i=worker->top; i<worker->bottom; i++)
+			tasks[i & (capacity - 1)] = worker->tasks[i & worker->mask];
+		free(worker->tasks);
+		worker->tasks = tasks;
+		worker->mask = capacity - 1;
+	}
+	worker->tasks[worker->bottom & worker->mask] = task;
+	worker->bottom++;
+	pthread_mutex_unlock(&(worker->lock));
+}
+
+/* The newest task, for the owner */
+static bool ThreadPool_pop(struct _ThreadPoolWorker *const worker, struct _ThreadPoolTask *const task) {
+	bool found = NO;
+	pthread_mutex_lock(&(worker->lock));
+	if ( worker->bottom != worker->top ) {
+		worker->bottom--;
+		*task = worker->tasks[worker->bottom & worker->mask];
+		found = YES;
+	}
+	pthread_mutex_unlock(&(worker->lock));
+	return found;
+}
+
+/* The oldest task, for a thief */
+static bool ThreadPool_take(struct _ThreadPoolWorker *const victim, struct _ThreadPoolTask *const task) {
+	bool found = NO;
+	pthread_mutex_lock(&(victim->lock));
+	if ( victim->bottom != victim->top ) {
+		*task = victim->tasks[victim->top & victim->mask];
+		victim->top++;
+		found = YES;
+	}
+	pthread_mutex_unlock(&(victim->lock));
+	return found;
+}
+
+static bool ThreadPool_steal(struct _ThreadPoolWorker *const worker, struct _ThreadPoolTask *const task) {
+	struct ThreadPool *pool = worker->pool;
+	for (UInteger i=1; i<pool->workerCount; i++) {
+		struct _ThreadPoolWorker *victim = &(pool->workers[(worker->index + i) % pool->workerCount]);
+		if ( ThreadPool_take(victim, task) ) {
+			__atomic_store_n(&(worker->stolen), worker->stolen + 1, __ATOMIC_RELAXED);
+			return YES;
+		}
+	}
+	return NO;
+}
+
+/* Sleeps until there is work. Returns NO when the worker must stop. */
+static bool ThreadPool_park(struct ThreadPool *const self) {
+	pthread_mutex_lock(&(self->parking));
+	__atomic_add_fetch(&(self->idleWorkers), 1, __ATOMIC_SEQ_CST);
+	while ( __atomic_load_n(&(self->pending), __ATOMIC_SEQ_CST) == 0 && ! self->stopping )
+		pthread_cond_wait(&(self->work), &(self->parking));
+	__atomic_sub_fetch(&(self->idleWorkers), 1, __ATOMIC_SEQ_CST);
+	bool keepWorking = ! self->stopping;
+	pthread_mutex_unlock(&(self->parking));
+	return keepWorking;
+}
+
+static void ThreadPool_finish(struct ThreadPool *const self) {
+	if ( __atomic_sub_fetch(&(self->unfinished), 1, __ATOMIC_SEQ_CST) != 0 )
+		return;
+	pthread_mutex_lock(&(self->parking));
+	pthread_cond_broadcast(&(self->finished));
+	pthread_mutex_unlock(&(self->parking));
+}
+
+static void * ThreadPool_work(void *argument) {
+	struct _ThreadPoolWorker *worker = argument;
+	struct ThreadPool *pool = worker->pool;
+	ThreadPoolCurrentWorker = worker;
+	AutoreleasePoolRef autoreleasePool = new(AutoreleasePool, NULL);
+
+	struct _ThreadPoolTask task;
+	for (;;) {
+		if ( ThreadPool_pop(worker, &task) || ThreadPool_steal(worker, &task) ) {
+			__atomic_sub_fetch(&(pool->pending), 1, __ATOMIC_SEQ_CST);
+			task.function(task.argument);
+			drainAutoreleasePool(autoreleasePool);
+			__atomic_store_n(&(worker->completed), worker->completed + 1, __ATOMIC_RELAXED);
+			ThreadPool_finish(pool);
+		}
+		else if ( ! ThreadPool_park(pool) )
+			break;
+	}
+
+	release(autoreleasePool);
+	ThreadPoolCurrentWorker = NULL;
+	return NULL;
+}
+
+static bool ThreadPool_submitTask(void *const _self, ThreadPoolFunction function, void *const argument) {
+	struct ThreadPool *self = _self;
+	struct _ThreadPoolWorker *worker = ThreadPoolCurrentWorker;
+	/* Counted before checking, so that a shutdown in progress waits for the task if it gets through */
+	__atomic_add_fetch(&(self->unfinished), 1, __ATOMIC_SEQ_CST);
+	if ( worker == NULL || worker->pool != self ) {
+		if ( __atomic_load_n(&(self->shuttingDown), __ATOMIC_SEQ_CST) ) {
+			ThreadPool_finish(self);
+			return errno = ECANCELED, NO;
+		}
+		worker = &(self->workers[__atomic_fetch_add(&(self->nextWorker), 1, __ATOMIC_RELAXED) % self->workerCount]);
+	}
+
+	ThreadPool_push(worker, (struct _ThreadPoolTask){ function, argument });
+	__atomic_add_fetch(&(self->pending), 1, __ATOMIC_SEQ_CST);
+	if ( __atomic_load_n(&(self->idleWorkers), __ATOMIC_SEQ_CST) > 0 ) {
+		pthread_mutex_lock(&(self->parking));
+		pthread_cond_signal(&(self->work));
+		pthread_mutex_unlock(&(self->parking));
+	}
+	return YES;
+}
+
+static void ThreadPool_waitForTasks(void *const _self) {
+	struct ThreadPool *self = _self;
+	pthread_mutex_lock(&(self->parking));
+	while ( __atomic_load_n(&(self->unfinished), __ATOMIC_SEQ_CST) != 0 )
+		pthread_cond_wait(&(self->finished), &(self->parking));
+	pthread_mutex_unlock(&(self->parking));
+}
+
+static void ThreadPool_shutdownThreadPool(void *const _self) {
+	struct ThreadPool *self = _self;
+	if ( __atomic_exchange_n(&(self->shuttingDown), YES, __ATOMIC_SEQ_CST) )
+		return;
+	ThreadPool_waitForTasks(self);
+
+	pthread_mutex_lock(&(self->parking));
+	self->stopping = YES;
+	pthread_cond_broadcast(&(self->work));
+	pthread_mutex_unlock(&(self->parking));
+	for (UInteger i=0; i<self->workerCount; i++)
+		joinThread(self->workers[i].thread, NULL);
+}
+
+static UInteger ThreadPool_getThreadPoolWorkerCount(const void *const _self) {
+	const struct ThreadPool *self = _self;
+	return self->workerCount;
+}
+
+static UInteger ThreadPool_getThreadPoolPendingTaskCount(const void *const _self) {
+	const struct ThreadPool *self = _self;
+	return __atomic_load_n(&(self->pending), __ATOMIC_RELAXED);
+}
+
+static UInteger ThreadPool_getThreadPoolCompletedTaskCount(const void *const _self) {
+	const struct ThreadPool *self = _self;
+	UInteger completed = 0;
+	for (UInteger i=0; i<self->workerCount; i++)
+		completed += __atomic_load_n(&(self->workers[i].completed), __ATOMIC_RELAXED);
+	return completed;
+}
+
+static UInteger ThreadPool_getThreadPoolStolenTaskCount(const void *const _self) {
+	const struct ThreadPool *self = _self;
+	UInteger stolen = 0;
+	for (UInteger i=0; i<self->workerCount; i++)
+		stolen += __atomic_load_n(&(self->workers[i].stolen), __ATOMIC_RELAXED);
+	return stolen;
+}
+
+/* Parallel algorithms: one runner task per worker claims chunks of the index range from a shared cursor until it is
+ * exhausted, inside its own autorelease pool. Runners that start after the end merely drop their reference, so a
+ * caller only waits for the indexes actually claimed; from a worker of the pool, the caller runs a runner itself
+ * instead of waiting for one that may sit in its own deque. Adaptive chunks take half the remaining share of a
+ * runner, never less than THREAD_POOL_MINIMUM_CHUNK; ordered chunks cut the range in THREAD_POOL_ORDERED_CHUNKS. */
+
+#define THREAD_POOL_MINIMUM_CHUNK 64
+#define THREAD_POOL_ORDERED_CHUNKS 256
+
+enum _ThreadPoolParallelKind { ThreadPoolParallelRange, ThreadPoolParallelMap, ThreadPoolParallelReduce };
+
+struct _ThreadPoolParallel {
+	enum _ThreadPoolParallelKind kind;
+	ThreadPoolParallelOptions options;
+	const void *collection;
+	UInteger count;
+	UInteger runners;
+	UInteger chunkSize;
+	void *context;
+	ParallelRangeFunction rangeFunction;
+	ParallelMapFunction mapFunction;
+	ParallelReduceFunction reduceFunction;
+	ParallelCombineFunction combineFunction;
+	/* Maps and reductions: the objects of the collection, gathered in one pass since indexing a list walks it */
+	ObjectRef *objects;
+	ObjectRef *results;
+	void *result;
+	UInteger resultSize;
+	/* Reductions: the identity every partial starts from, and with ordered chunks one partial per chunk */
+	void *identity;
+	char *partials;
+	char cursorPadding[CO_CACHE_LINE_SIZE];
+	UInteger cursor;
+	char donePadding[CO_CACHE_LINE_SIZE];
+	UInteger references;
+	/* Under lock */
+	UInteger done;
+	pthread_mutex_t lock;
+	pthread_cond_t finished;
+};
+
+static void ThreadPool_releaseParallel(struct _ThreadPoolParallel *const parallel) {
+	if ( __atomic_sub_fetch(&(parallel->references), 1, __ATOMIC_ACQ_REL) != 0 )
+		return;
+	pthread_cond_destroy(&(parallel->finished));
+	pthread_mutex_destroy(&(parallel->lock));
+	free(parallel->identity);
+	free(parallel->partials);
+	free(parallel);
+}
+
+/* Claims the next chunk, NO once the range is exhausted */
+static bool ThreadPool_claimChunk(struct _ThreadPoolParallel *const parallel, Range *const chunk) {
+	UInteger location = __atomic_load_n(&(parallel->cursor), __ATOMIC_RELAXED);
+	UInteger length = 0;
+	do {
+		if ( location >= parallel->count )
+			return NO;
+		length = parallel->chunkSize;
+		if ( ! (parallel->options & ThreadPoolParallelOrdered) ) {
+			UInteger share = (parallel->count - location) / (2 * parallel->runners);
+			if ( share > length ) length = share;
+		}
+		if ( length > parallel->count - location ) length = parallel->count - location;
+	} while ( ! __atomic_compare_exchange_n(&(parallel->cursor), &location, location + length, YES, __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+	*chunk = MakeRange(location, length);
+	return YES;
+}
+
+static void ThreadPool_runParallel(void *argument) {
+	struct _ThreadPoolParallel *parallel = argument;
+	AutoreleasePoolRef autoreleasePool = new(AutoreleasePool, NULL);
+	void *partial = NULL;
+	if ( parallel->kind == ThreadPoolParallelReduce && ! (parallel->options & ThreadPoolParallelOrdered) ) {
+		partial = malloc(parallel->resultSize);
+		assert( partial != NULL );
+		memcpy(partial, parallel->identity, parallel->resultSize);
+	}
+
+	UInteger done = 0;
+	Range chunk;
+	while ( ThreadPool_claimChunk(parallel, &chunk) ) {
+		switch ( parallel->kind ) {
+			case ThreadPoolParallelRange:
+				parallel->rangeFunction(parallel->collection, chunk, parallel->context);
+				break;
+			case ThreadPoolParallelMap:
+				for (UInteger i=chunk.location; i<MaxRange(chunk); i++) {
+					ObjectRef result = parallel->mapFunction(parallel->objects[i], parallel->context);
+					parallel->results[i] = result ? retain(result) : NULL;
+				}
+				break;
+			case ThreadPoolParallelReduce: {
+				void *accumulator = partial;
+				if ( accumulator == NULL )
+					accumulator = parallel->partials + (chunk.location / parallel->chunkSize) * parallel->resultSize;
+				for (UInteger i=chunk.location; i<MaxRange(chunk); i++)
+					parallel->reduceFunction(accumulator, parallel->objects[i], parallel->context);
+				break;
+			}
+		}
+		drainAutoreleasePool(autoreleasePool);
+		done += chunk.length;
+	}
+	release(autoreleasePool);
+
+	if ( done > 0 ) {
+		pthread_mutex_lock(&(parallel->lock));
+		if ( partial )
+			parallel->combineFunction(parallel->result, partial, parallel->context);
+		parallel->done += done;
+		if ( parallel->done == parallel->count )
+			pthread_cond_broadcast(&(parallel->finished));
+		pthread_mutex_unlock(&(parallel->lock));
+	}
+	free(partial);
+	ThreadPool_releaseParallel(parallel);
+}
+
+static bool ThreadPool_parallel(struct ThreadPool *const self, struct _ThreadPoolParallel *const parallel) {
+	if ( parallel->count == 0 )
+		return free(parallel), YES;
+
+	struct _ThreadPoolWorker *worker = ThreadPoolCurrentWorker;
+	bool participating = ( worker != NULL && worker->pool == self );
+	UInteger chunks = (parallel->count + THREAD_POOL_MINIMUM_CHUNK - 1) / THREAD_POOL_MINIMUM_CHUNK;
+	UInteger runners = self->workerCount < chunks ? self->workerCount : chunks;
+	parallel->runners = runners;
+	parallel->chunkSize = THREAD_POOL_MINIMUM_CHUNK;
+	if ( parallel->options & ThreadPoolParallelOrdered ) {
+		UInteger chunkSize = (parallel->count + THREAD_POOL_ORDERED_CHUNKS - 1) / THREAD_POOL_ORDERED_CHUNKS;
+		if ( chunkSize > parallel->chunkSize ) parallel->chunkSize = chunkSize;
+	}
+	if ( parallel->kind == ThreadPoolParallelReduce ) {
+		parallel->identity = malloc(parallel->resultSize);
+		assert( parallel->identity != NULL );
+		if ( parallel->identity == NULL ) return free(parallel), errno = ENOMEM, NO;
+		memcpy(parallel->identity, parallel->result, parallel->resultSize);
+	}
+	if ( parallel->kind == ThreadPoolParallelReduce && (parallel->options & ThreadPoolParallelOrdered) ) {
+		chunks = (parallel->count + parallel->chunkSize - 1) / parallel->chunkSize;
+		parallel->partials = malloc(chunks * parallel->resultSize);
+		assert( parallel->partials != NULL );
+		if ( parallel->partials == NULL ) return free(parallel->identity), free(parallel), errno = ENOMEM, NO;
+		for (UInteger i=0; i<chunks; i++)
+			memcpy(parallel->partials + i * parallel->resultSize, parallel->identity, parallel->resultSize);
+	}
+	parallel->cursor = parallel->done = 0;
+	parallel->references = runners + 1;
+	pthread_mutex_init(&(parallel->lock), NULL);
+	pthread_cond_init(&(parallel->finished), NULL);
+
+	UInteger submitted = participating ? 1 : 0;
+	for ( ; submitted<runners; submitted++)
+		if ( ! submitTask(self, ThreadPool_runParallel, parallel) )
+			break;
+	if ( submitted == 0 ) {
+		/* Shutting down: nobody will run anything */
+		parallel->references = 1;
+		ThreadPool_releaseParallel(parallel);
+		return errno = ECANCELED, NO;
+	}
+	/* The runners that could not be submitted */
+	__atomic_sub_fetch(&(parallel->references), runners - submitted, __ATOMIC_ACQ_REL);
+	if ( participating )
+		ThreadPool_runParallel(parallel);
+
+	pthread_mutex_lock(&(parallel->lock));
+	while ( parallel->done != parallel->count )
+		pthread_cond_wait(&(parallel->finished), &(parallel->lock));
+	pthread_mutex_unlock(&(parallel->lock));
+
+	if ( parallel->partials ) {
+		chunks = (parallel->count + parallel->chunkSize - 1) / parallel->chunkSize;
+		for (UInteger i=0; i<chunks; i++)
+			parallel->combineFunction(parallel->result, parallel->partials + i * parallel->resultSize, parallel->context);
+	}
+	ThreadPool_releaseParallel(parallel);
+	return YES;
+}
+
+static struct _ThreadPoolParallel * ThreadPool_newParallel(enum _ThreadPoolParallelKind kind, const void *const collection, void *const context, ThreadPoolParallelOptions options) {
+	struct _ThreadPoolParallel *parallel = calloc(1, sizeof(struct _ThreadPoolParallel));
+	assert( parallel != NULL );
+	if ( parallel == NULL ) return errno = ENOMEM, NULL;
+	parallel->kind = kind;
+	parallel->options = options;
+	parallel->collection = collection;
+	parallel->count = getCollectionCount(collection);
+	parallel->context = context;
+	return parallel;
+}
+
+/* The objects of the collection in order, not retained: like the indices handed to a range, they are only valid
+ * while the collection is not mutated. The caller frees the array once the parallel operation returned. */
+static ObjectRef * ThreadPool_gatherObjects(struct _ThreadPoolParallel *const parallel) {
+	ObjectRef *objects = malloc((parallel->count ? parallel->count : 1) * sizeof(ObjectRef));
+	assert( objects != NULL );
+	if ( objects == NULL ) return errno = ENOMEM, NULL;
+	UInteger gathered = 0;
+	foreach_start(ObjectRef, object, parallel->collection) {
+		if ( gathered < parallel->count )
+			objects[gathered++] = object;
+	} foreach_end()
+	parallel->count = gathered;
+	return parallel->objects = objects;
+}
+
+static bool ThreadPool_parallelForRange(void *const _self, const void *const collection, ParallelRangeFunction function, void *const context, ThreadPoolParallelOptions options) {
+	struct _ThreadPoolParallel *parallel = ThreadPool_newParallel(ThreadPoolParallelRange, collection, context, options);
+	if ( parallel == NULL ) return NO;
+	parallel->rangeFunction = function;
+	return ThreadPool_parallel(_self, parallel);
+}
+
+static bool ThreadPool_parallelMapIntoVector(void *const _self, const void *const collection, void *const vector, ParallelMapFunction function, void *const context, ThreadPoolParallelOptions options) {
+	struct _ThreadPoolParallel *parallel = ThreadPool_newParallel(ThreadPoolParallelMap, collection, context, options);
+	if ( parallel == NULL ) return NO;
+	ObjectRef *objects = ThreadPool_gatherObjects(parallel);
+	if ( objects == NULL ) return free(parallel), NO;
+	UInteger count = parallel->count;
+	ObjectRef *results = calloc(count ? count : 1, sizeof(ObjectRef));
+	assert( results != NULL );
+	if ( results == NULL ) return free(objects), free(parallel), errno = ENOMEM, NO;
+	parallel->mapFunction = function;
+	parallel->results = results;
+
+	bool mapped = ThreadPool_parallel(_self, parallel);
+	if ( mapped )
+		for (UInteger i=0; i<count; i++)
+			if ( results[i] )
+				addObject(vector, results[i]), release(results[i]);
+	free(results);
+	free(objects);
+	return mapped;
+}
+
+static bool ThreadPool_parallelReduce(void *const _self, const void *const collection, void *const result, UInteger resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *const context, ThreadPoolParallelOptions options) {
+	struct _ThreadPoolParallel *parallel = ThreadPool_newParallel(ThreadPoolParallelReduce, collection, context, options);
+	if ( parallel == NULL ) return NO;
+	ObjectRef *objects = ThreadPool_gatherObjects(parallel);
+	if ( objects == NULL ) return free(parallel), NO;
+	parallel->reduceFunction = reduce;
+	parallel->combineFunction = combine;
+	parallel->result = result;
+	parallel->resultSize = resultSize;
+	bool reduced = ThreadPool_parallel(_self, parallel);
+	free(objects);
+	return reduced;
+}
+
+CO_CLASS_INIT_DECL(ThreadPool) {
+	initThread();
+	initAutoreleasePool();
+
+	if ( ! ThreadPoolClass )
+		ThreadPoolClass = new(Class, "ThreadPoolClass", Class, sizeof(struct ThreadPoolClass),
+							  constructor, ThreadPoolClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(ThreadPool) )
+		CO_CLASS_PUBLISH(ThreadPool, new(ThreadPoolClass, "ThreadPool", Object, sizeof(struct ThreadPool),
+						 constructor, ThreadPool_constructor,
+						 destructor, ThreadPool_destructor,
+
+						 /* Overrides */
+						 copy, ThreadPool_copy,
+
+						 /* new */
+						 submitTask, ThreadPool_submitTask,
+						 waitForTasks, ThreadPool_waitForTasks,
+						 shutdownThreadPool, ThreadPool_shutdownThreadPool,
+						 getThreadPoolWorkerCount, ThreadPool_getThreadPoolWorkerCount,
+						 getThreadPoolPendingTaskCount, ThreadPool_getThreadPoolPendingTaskCount,
+						 getThreadPoolCompletedTaskCount, ThreadPool_getThreadPoolCompletedTaskCount,
+						 getThreadPoolStolenTaskCount, ThreadPool_getThreadPoolStolenTaskCount,
+						 parallelForRange, ThreadPool_parallelForRange,
+						 parallelMapIntoVector, ThreadPool_parallelMapIntoVector,
+						 parallelReduce, ThreadPool_parallelReduce,
+						 NULL));
+}
+
+void deallocThreadPool() {
+	release((void *)ThreadPool), ThreadPool = NULL;
+	release((void *)ThreadPoolClass), ThreadPoolClass = NULL;
+}
+
+/* API */
+
+bool submitTask(void *const self, ThreadPoolFunction function, void *const argument) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(function,EINVAL,NO);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->submitTask,ENOTSUP,NO);
+	return class->submitTask(self, function, argument);
+}
+
+void waitForTasks(void *const self) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->waitForTasks,ENOTSUP);
+	class->waitForTasks(self);
+}
+
+void shutdownThreadPool(void *const self) {
+	COAssertNoNullOrBailOut(self,EINVAL);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrBailOut(class,EINVAL);
+	COAssertNoNullOrBailOut(class->shutdownThreadPool,ENOTSUP);
+	class->shutdownThreadPool(self);
+}
+
+UInteger getThreadPoolWorkerCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getThreadPoolWorkerCount,ENOTSUP,0);
+	return class->getThreadPoolWorkerCount(self);
+}
+
+UInteger getThreadPoolPendingTaskCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getThreadPoolPendingTaskCount,ENOTSUP,0);
+	return class->getThreadPoolPendingTaskCount(self);
+}
+
+UInteger getThreadPoolCompletedTaskCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getThreadPoolCompletedTaskCount,ENOTSUP,0);
+	return class->getThreadPoolCompletedTaskCount(self);
+}
+
+UInteger getThreadPoolStolenTaskCount(const void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,0);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,0);
+	COAssertNoNullOrReturn(class->getThreadPoolStolenTaskCount,ENOTSUP,0);
+	return class->getThreadPoolStolenTaskCount(self);
+}
+
+bool parallelForRange(void *const self, const void *const collection, ParallelRangeFunction function, void *const context, ThreadPoolParallelOptions options) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(collection,EINVAL,NO);
+	COAssertNoNullOrReturn(function,EINVAL,NO);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->parallelForRange,ENOTSUP,NO);
+	return class->parallelForRange(self, collection, function, context, options);
+}
+
+bool parallelMapIntoVector(void *const self, const void *const collection, void *const vector, ParallelMapFunction function, void *const context, ThreadPoolParallelOptions options) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(collection,EINVAL,NO);
+	COAssertNoNullOrReturn(vector,EINVAL,NO);
+	COAssertNoNullOrReturn(function,EINVAL,NO);
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->parallelMapIntoVector,ENOTSUP,NO);
+	return class->parallelMapIntoVector(self, collection, vector, function, context, options);
+}
+
+bool parallelReduce(void *const self, const void *const collection, void *const result, UInteger resultSize, ParallelReduceFunction reduce, ParallelCombineFunction combine, void *const context, ThreadPoolParallelOptions options) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(collection,EINVAL,NO);
+	COAssertNoNullOrReturn(result,EINVAL,NO);
+	COAssertNoNullOrReturn(reduce,EINVAL,NO);
+	COAssertNoNullOrReturn(combine,EINVAL,NO);
+	if ( resultSize == 0 ) return errno = EINVAL, NO;
+	const struct ThreadPoolClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->parallelReduce,ENOTSUP,NO);
+	return class->parallelReduce(self, collection, result, resultSize, reduce, combine, context, options);
+}
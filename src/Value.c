@@ -13,8 +13,7 @@
 #include <cobj.h>
 #include <Value.r>
 
-const void * Value = NULL;
-const void * ValueClass = NULL;
+CO_CLASS_STORAGE_DECL(Value)
 
 
 static void * Value_constructor (void * _self, va_list * app) {
@@ -29,6 +28,17 @@ static void * Value_constructor (void * _self, va_list * app) {
 	return self;
 }
 
+static void * Value_initializer (void * _self, const void *const _arguments) {
+	const ValueArguments *arguments = _arguments;
+	COAssertNoNullOrReturn(arguments,EINVAL,NULL);
+	COAssertNoNullOrReturn(arguments->pointer,EINVAL,NULL);
+	
+	struct Value *self = super_initializer(Value, _self, _arguments);
+	self->pointer = arguments->pointer;
+	self->cleanup = arguments->cleanup;
+	return self;
+}
+
 static void * Value_destructor (void * _self) {
 	struct Value *self = super_destructor(Value, _self);
 	if ( self->cleanup != NULL ) self->cleanup((void *)self->pointer);
@@ -66,7 +76,7 @@ static void * Value_getValuePointer (const void *const _self) {
 
 static void * Value_copy (const void * const _self) {
 	const struct Value *self = _self;
-	return new(Value, getValuePointer(self), NULL);
+	return newWithArguments(Value, &(ValueArguments){ getValuePointer(self), NULL });
 }
 
 static bool Value_equals (const void * const _self, const void *const _other) {
@@ -92,13 +102,14 @@ static void Value_setValuePointerCleanup (void *const _self, voidf cleanup) {
 }
 
 
-void initValue() {
+CO_CLASS_INIT_DECL(Value) {
 	if ( ! ValueClass )
 		ValueClass = new(Class, "ValueClass", Class, sizeof(struct ValueClass),
 						 constructor, ValueClass_constructor, NULL);
-	if ( ! Value )
-		Value = new(ValueClass, "Value", Object, sizeof(struct Value),
+	if ( CO_CLASS_PENDING(Value) )
+		CO_CLASS_PUBLISH(Value, new(ValueClass, "Value", Object, sizeof(struct Value),
 					constructor, Value_constructor,
+					initializer, Value_initializer,
 					destructor, Value_destructor,
 					
 					/* Oveerrides */
@@ -110,7 +121,7 @@ void initValue() {
 					getValuePointer, Value_getValuePointer,
 					setValuePointer, Value_setValuePointer,
 					setValuePointerCleanup, Value_setValuePointerCleanup,
-					NULL);
+					NULL));
 		
 }
 
@@ -16,8 +16,7 @@
 #include <Vector.r>
 #include <Array.r>
 
-const void * Vector = NULL;
-const void * VectorClass = NULL;
+CO_CLASS_STORAGE_DECL(Vector)
 
 
 static int __grow(struct Vector *const self, UInteger minCapacity) {
@@ -53,8 +52,7 @@ static int __shrink(struct Vector *const self, UInteger minCapacity) {
 }
 
 inline static int __ensureCapacity(struct Vector *const self, UInteger minCapacity) {
-		if (
-			(minCapacity - self->capacity > 0) )
+		if ( minCapacity > self->capacity )
 			return __grow(self, minCapacity);
 	return 0;
 }
@@ -313,15 +311,15 @@ static ObjectRef Vector_popObject(void *const _self) {
 }
 
 
-void initVector() {
+CO_CLASS_INIT_DECL(Vector) {
 	initArray();
 	initMutableArray();
 	
 	if ( ! VectorClass )
 		VectorClass = new(MutableArrayClass, "VectorClass", MutableArrayClass, sizeof(struct VectorClass),
 						 constructor, VectorClass_constructor, NULL);
-	if ( ! Vector )
-		Vector = new(VectorClass, "Vector", MutableArray, sizeof(struct Vector),
+	if ( CO_CLASS_PENDING(Vector) )
+		CO_CLASS_PUBLISH(Vector, new(VectorClass, "Vector", MutableArray, sizeof(struct Vector),
 					constructor, Vector_constructor,
 					destructor, Vector_destructor,
 					
@@ -337,6 +335,8 @@ void initVector() {
 					 removeObjectAtIndex, Vector_removeObjectAtIndex,
 					 indexOfObject, Vector_indexOfObject,
 					 containsObject, Vector_arrayContainsObject,
+					 /* Indexing a vector is cheap, Array's enumeration instead of MutableArray's list walk */
+					 enumerateWithState, ((const struct CollectionClass *)Array)->enumerateWithState,
 					 removeObject, Vector_removeObject,
 					 removeFirstObject, Vector_removeFirstObject,
 					 removeLastObject, Vector_removeLastObject,
@@ -350,15 +350,17 @@ void initVector() {
 					 getVectorCapacityIncrement, Vector_getVectorCapacityIncrement,
 					 setVectorCapacityIncrement, Vector_setVectorCapacityIncrement,
 					 setVectorSize, Vector_setVectorSize,
-					NULL);
+					NULL));
 	
 }
 
 void deallocVector() {
 //	free((void *)Vector), Vector = NULL;
 //	free((void *)VectorClass), VectorClass = NULL;
-	release((void *)Vector), Vector = NULL;
-	release((void *)VectorClass), VectorClass = NULL;
+	if (Vector)
+		release((void *)Vector), Vector = NULL;
+	if (VectorClass)
+		release((void *)VectorClass), VectorClass = NULL;
 	deallocMutableArray();
 	deallocArray();
 }
@@ -28,15 +28,18 @@ static int __grow(struct WMutableString *const self, UInteger minCapacity) {
 	struct String *stringSelf = (struct String *)self;
 	UInteger newCapacity = 0;
 	/* if doubling the capacity is impossible due to overflow */
-	if (UINT64_MAX - self->capacity < self->capacity) {
+	if (UINT64_MAX / sizeof(wchar_t) / 2 < self->capacity) {
 		/* then use the max value */
-		newCapacity = UINT64_MAX;
+		newCapacity = UINT64_MAX / sizeof(wchar_t);
 	}
 	else {
 		newCapacity = self->capacity * 2;
 	}
+	if ( newCapacity < minCapacity )
+		newCapacity = minCapacity;
 
-	const void *newText = realloc((void *)stringSelf->text, newCapacity * sizeof(char) );
+	/* The capacity counts characters, terminating null included */
+	const void *newText = realloc((void *)stringSelf->text, newCapacity * sizeof(wchar_t) );
 	if ( newText == NULL ) return -1;
 	self->capacity = newCapacity;
 	stringSelf->text = newText;
@@ -50,37 +53,6 @@ inline static int __ensureCapacity(struct WMutableString *const self, UInteger m
 }
 
 
-inline static char *__wideToCharConverter(const wchar_t *restrict wideContent) {
-	if ( wideContent == NULL ) return errno = EINVAL, (char *)NULL;
-	
-	size_t charContentSize = wcstombs(NULL, wideContent, 0);
-	if ( charContentSize == (size_t)-1 ) return errno = 0, NULL;
-	
-	char *restrict charContent = calloc(charContentSize+1, sizeof(char));
-	if ( charContent == NULL ) return errno = ENOMEM, (char *)NULL;
-	
-	charContentSize = wcstombs(charContent, wideContent, charContentSize);
-	if ( charContentSize == (size_t)-1 ) return free(charContent), errno = 0, (char *)NULL;
-	
-	return charContent;
-}
-
-inline static wchar_t *__charToWideConverter(const char *restrict charContent) {
-	if ( charContent == NULL ) return errno = EINVAL, (wchar_t *)NULL;
-	
-	size_t wideContentSize = mbstowcs(NULL, charContent, 0);
-	if ( wideContentSize == (size_t)-1 ) return errno = 0,  (wchar_t  *)NULL;
-	
-	wchar_t *wideContent = calloc(wideContentSize + 1, sizeof(wchar_t));
-	if ( wideContent == NULL ) return errno = 0,  (wchar_t *)NULL;
-	
-	wideContentSize =mbstowcs(wideContent, charContent, wideContentSize);
-	if ( wideContentSize == (size_t)-1 ) return free(wideContent), errno = 0,  (wchar_t *)NULL;
-	
-	return wideContent;
-}
-
-
 static void * WMutableString_constructor (void * _self, va_list * app) {
 	struct WMutableString *self = super_constructor(String, _self, app);
 	struct String *super = (struct String *)self;
@@ -97,8 +69,7 @@ static void * WMutableString_constructor (void * _self, va_list * app) {
 	assert(super->text != NULL);
 	if (super->text == NULL) return free(self), NULL;
 	super->length = wcslen(super->text);
-	UInteger charContentSize = wcstombs(NULL, text, 0);
-	self->capacity = (UInteger)charContentSize;
+	self->capacity = super->length + 1;
 	return self;
 }
 
@@ -187,10 +158,9 @@ static WMutableStringRef WMutableString_copyStringByAppendingString(const void *
 
 static WMutableStringRef WMutableString_copyDescription(const void *restrict const _self) {
 	const struct WString *self = _self;
-	char *multibyte = __wideToCharConverter(getWText(self));
-	StringRef description  = new(String, multibyte, NULL);
-	free(multibyte);
-	return description;
+	StringRef description = WString_newUTF8Description(getWText(self), getStringLength(self));
+	/* Malformed wide text is described as an empty String */
+	return description ? description : new(String, NULL);
 }
 
 static SComparisonResult WMutableString_compare (const void *const self, const void *const other) {
@@ -250,6 +220,13 @@ static int WMutableString_getCharactersInRange(const void * const _self, void *c
 
 /* Mutable */
 
+/* Whether the text of other is wide, other being a WString or a WMutableString or a subclass of */
+static bool __isWide(const void *const other) {
+	for (const void *class = classOf(other); class != Object; class = superclass(class))
+		if ( class == WString || class == WMutableString ) return YES;
+	return NO;
+}
+
 static void WMutableString_appendString(void *const _self, const void *const _other) {
 	struct WMutableString *self = _self;
 	struct String *stringSelf = _self;
@@ -257,36 +234,41 @@ static void WMutableString_appendString(void *const _self, const void *const _ot
 	UInteger selfLength = getStringLength(self);
 	UInteger otherLength = getStringLength(_other);
 	
-	if (isSubclassOf(_other, WString) || isSubclassOf(_other, WMutableString)) {
+	if ( __isWide(_other) ) {
 		const wchar_t *otherText = getWText(_other);
 		
-		if ( __ensureCapacity(self, selfLength + otherLength + sizeof(wchar_t)) == -1 ) { errno = ENOMEM; return; };
+		if ( __ensureCapacity(self, selfLength + otherLength + 1) == -1 ) { errno = ENOMEM; return; };
 		
 		wchar_t *selfText = (wchar_t *)getStringText(self);
-		wcsncat(selfText, otherText, otherLength);
+		wmemcpy(selfText + selfLength, otherText, otherLength);
+		selfText[selfLength + otherLength] = L'\0';
 		stringSelf->length += otherLength;
 	}
 	else {
-		const char *otherText = getStringText(_other);
-		UInteger size = mbstowcs(NULL, otherText, 0);
-		if ( __ensureCapacity(self, selfLength + size + sizeof(wchar_t)) == -1 ) { errno = ENOMEM; return; };
+		/* UTF-8, decoded straight into the text: a code point takes at least a byte */
+		const char *otherText = otherLength ? getStringText(_other) : "";
+		if ( __ensureCapacity(self, selfLength + otherLength + 1) == -1 ) { errno = ENOMEM; return; };
 		wchar_t *selfText = (wchar_t *)getStringText(self);
-		wchar_t *otherT = __charToWideConverter(otherText);
-		wcsncat(selfText, otherT, otherLength);
-		stringSelf->length += wcslen(otherT);
-		free(otherT);
+		UInteger decoded = WString_decodeUTF8(otherText, otherLength, selfText + selfLength);
+		if ( decoded == NotFound ) {
+			selfText[selfLength] = L'\0';
+			errno = EILSEQ;
+			return;
+		}
+		selfText[selfLength + decoded] = L'\0';
+		stringSelf->length += decoded;
 	}
+	stringSelf->_hash = 0;
 }
 
-const void * WMutableString = NULL;
-const void * WMutableStringClass = NULL;
+CO_CLASS_STORAGE_DECL(WMutableString)
 
-void initWMutableString() {
+CO_CLASS_INIT_DECL(WMutableString) {
 	initMutableString();
 	if ( !WMutableStringClass )
 		WMutableStringClass = new(MutableStringClass, "WMutableStringClass", MutableStringClass, sizeof(struct WMutableStringClass), constructor, WMutableStringClass_constructor, NULL);
-	if ( !WMutableString )
-		WMutableString = new(WMutableStringClass, "WMutableString", MutableString, sizeof(struct WMutableString),
+	if ( CO_CLASS_PENDING(WMutableString) )
+		CO_CLASS_PUBLISH(WMutableString, new(WMutableStringClass, "WMutableString", MutableString, sizeof(struct WMutableString),
 							 constructor, WMutableString_constructor,
 
 							 copy, WMutableString_copy,
@@ -301,7 +283,9 @@ void initWMutableString() {
 							 compareWithOptions, WMutableString_compareWithOptions,
 							 characterAtIndex, WMutableString_characterAtIndex,
 							 getCharactersInRange, WMutableString_getCharactersInRange,
-							 NULL);
+							 /* The search works on bytes */
+							 rangeOfStringWithOptionsInRange, NULL,
+							 NULL));
 }
 
 void deallocWMutableString() {
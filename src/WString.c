@@ -17,39 +17,35 @@
 #include <cobj.h>
 #include <WString.r>
 #include <StringObject.r>
+#include <coutf8.h>
 
 extern int errno;
 
-inline static char *__wideToCharConverter(const wchar_t *restrict wideContent) {
-	if ( wideContent == NULL ) return errno = EINVAL, (char *)NULL;
-	
-	size_t charContentSize = wcstombs(NULL, wideContent, 0);
-	if ( charContentSize == (size_t)-1 ) return errno = 0, NULL;
-	
-	char *restrict charContent = calloc(charContentSize+1, sizeof(char));
-	if ( charContent == NULL ) return errno = ENOMEM, (char *)NULL;
-	
-	charContentSize = wcstombs(charContent, wideContent, charContentSize);
-	if ( charContentSize == (size_t)-1 ) return free(charContent), errno = 0, (char *)NULL;
-	
-	return charContent;
-}
+#if WCHAR_MAX > 0xFFFF
+#define WString_lengthInUTF8(text, length) COUTF32LengthInUTF8((const uint32_t *)(text), length)
+#define WString_encodeUTF8(text, length, output) COUTF32ToUTF8((const uint32_t *)(text), length, output)
+#else
+#define WString_lengthInUTF8(text, length) COUTF16LengthInUTF8((const uint16_t *)(text), length)
+#define WString_encodeUTF8(text, length, output) COUTF16ToUTF8((const uint16_t *)(text), length, output)
+#endif
 
-inline static wchar_t *__charToWideConverter(const char *restrict charContent) {
-	if ( charContent == NULL ) return errno = EINVAL, (wchar_t *)NULL;
-	
-	size_t wideContentSize = mbstowcs(NULL, charContent, 0);
-	if ( wideContentSize == (size_t)-1 ) return errno = 0,  (wchar_t  *)NULL;
-	
-	wchar_t *wideContent = calloc(wideContentSize + 1, sizeof(wchar_t));
-	if ( wideContent == NULL ) return errno = 0,  (wchar_t *)NULL;
-	
-	wideContentSize =mbstowcs(wideContent, charContent, wideContentSize);
-	if ( wideContentSize == (size_t)-1 ) return free(wideContent), errno = 0,  (wchar_t *)NULL;
-	
-	return wideContent;
+StringRef WString_newUTF8Description(const wchar_t *text, UInteger length) {
+	UInteger utf8Length = WString_lengthInUTF8(text, length);
+	if ( utf8Length == NotFound ) return errno = EILSEQ, NULL;
+	struct String *description = String_newWithLength(utf8Length);
+	if ( description == NULL ) return NULL;
+	WString_encodeUTF8(text, length, (char *)description->text);
+	description->utf8 = StringUTF8Valid;
+	return description;
 }
 
+UInteger WString_decodeUTF8(const char *text, UInteger length, wchar_t *output) {
+#if WCHAR_MAX > 0xFFFF
+	return COUTF8ToUTF32(text, length, (uint32_t *)output);
+#else
+	return COUTF8ToUTF16(text, length, (uint16_t *)output);
+#endif
+}
 
 static void * WString_constructor (void * _self, va_list * app) {
 	struct WString *self = super_constructor(String, _self, app);
@@ -158,10 +154,9 @@ static WStringRef WString_copyStringByAppendingString(const void *restrict const
 
 static WStringRef WString_copyDescription(const void *restrict const _self) {
 	const struct WString *self = _self;
-	char *multibyte = __wideToCharConverter(getWText(self));
-	StringRef description  = new(String, multibyte, NULL);
-	free(multibyte);
-	return description;
+	StringRef description = WString_newUTF8Description(getWText(self), getStringLength(self));
+	/* Malformed wide text is described as an empty String */
+	return description ? description : new(String, NULL);
 }
 
 static SComparisonResult WString_compare (const void *const self, const void *const other) {
@@ -220,16 +215,15 @@ static int WString_getCharactersInRange(const void * const _self, void *const re
 }
 
 
-const void * WString = NULL;
-const void * WStringClass = NULL;
+CO_CLASS_STORAGE_DECL(WString)
 
-void initWString() {
+CO_CLASS_INIT_DECL(WString) {
 	setlocale(LC_CTYPE, "UTF-8");
 	initString();
 	if ( ! WStringClass )
 		WStringClass = new(StringClass, "WStringClass", StringClass, sizeof(struct WStringClass), constructor, WStringClass_constructor, NULL);
-	if ( ! WString )
-		WString = new(WStringClass, "WString", String, sizeof(struct WString),
+	if ( CO_CLASS_PENDING(WString) )
+		CO_CLASS_PUBLISH(WString, new(WStringClass, "WString", String, sizeof(struct WString),
 					  constructor, WString_constructor,
 					  copy, WString_copy,
 					  equals, WString_equals,
@@ -241,7 +235,9 @@ void initWString() {
 					  characterAtIndex, WString_characterAtIndex,
 					  getCharactersInRange, WString_getCharactersInRange,
 					  hash, WString_hash,
-					  NULL);
+					  /* The search works on bytes */
+					  rangeOfStringWithOptionsInRange, NULL,
+					  NULL));
 }
 
 void deallocWString() {
@@ -261,3 +257,26 @@ const wchar_t *getWText(const void *const self) {
 	COAssertNoNullOrReturn(class->getStringText,ENOTSUP,NULL);
 	return (const wchar_t *)class->getStringText(self);
 }
+
+WStringRef newWStringWithUTF8Text(const void *const _class, const char *const text, UInteger length) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	COAssertNoNullOrReturn(text,EINVAL,NULL);
+	const void *const class = COResolveClass(_class);
+	/* A code point takes at least a byte */
+	wchar_t *wideText = malloc((length + 1) * sizeof(wchar_t));
+	if ( wideText == NULL ) return errno = ENOMEM, NULL;
+	UInteger wideLength = WString_decodeUTF8(text, length, wideText);
+	if ( wideLength == NotFound ) return free(wideText), errno = EILSEQ, NULL;
+	wideText[wideLength] = L'\0';
+	if ( class == WString ) {
+		/* The WString takes the text over */
+		struct String *newString = new(WString, NULL);
+		if ( newString == NULL ) return free(wideText), NULL;
+		newString->text = wideText;
+		newString->length = wideLength;
+		return newString;
+	}
+	WStringRef newString = new(class, wideText, NULL);
+	free(wideText);
+	return newString;
+}
@@ -0,0 +1,274 @@
+//
+//  WorkStealingDeque.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <memory_management/memory_management.h>
+
+#include <cobj.h>
+#include <WorkStealingDeque.r>
+
+/* The Chase–Lev deque with the C11 memory orderings of Lê, Pop, Cohen and Zappa Nardelli, "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (PPoPP 2013), expressed with the __atomic builtins. The owner and a thief
+ * only race for the last object, which both claim by advancing top with a CAS; the sequentially consistent fences
+ * order the owner's bottom decrement against the thief's top read. */
+
+CO_CLASS_STORAGE_DECL(WorkStealingDeque)
+
+static struct _WorkStealingBuffer * WorkStealingDeque_newBuffer(Integer capacity, struct _WorkStealingBuffer *const previous) {
+	struct _WorkStealingBuffer *buffer = malloc(sizeof(struct _WorkStealingBuffer) + (UInteger)capacity * sizeof(void *));
+	assert( buffer != NULL );
+	if ( buffer == NULL ) return NULL;
+	buffer->mask = capacity - 1;
+	buffer->previous = previous;
+	return buffer;
+}
+
+static void * WorkStealingDeque_constructor (void * _self, va_list * app) {
+	UInteger capacity = va_arg(*app, UInteger);
+	/* Past this the rounded up size, an Integer, or the size of its buffer overflows. Checked before the object is set
+	 * up, so that giving it back does not run its destructor */
+	if ( capacity > ((UInteger)IntegerMax / 2 + 1) / sizeof(void *) )
+		return MEMORY_MANAGEMENT_RELEASE(_self), errno = EINVAL, NULL;
+
+	Integer size = 2;
+	while ( (UInteger)size < capacity )
+		size <<= 1;
+
+	/* Allocated before the object is set up too, for the same reason */
+	struct _WorkStealingBuffer *buffer = WorkStealingDeque_newBuffer(size, NULL);
+	if ( buffer == NULL ) return MEMORY_MANAGEMENT_RELEASE(_self), errno = ENOMEM, NULL;
+	struct WorkStealingDeque *self = super_constructor(WorkStealingDeque, _self, app);
+	self->buffer = buffer;
+	self->top = self->bottom = 0;
+	return self;
+}
+
+static ObjectRef WorkStealingDeque_popDequeObject(void *const _self);
+
+static void * WorkStealingDeque_destructor (void * _self) {
+	struct WorkStealingDeque *self = super_destructor(WorkStealingDeque, _self);
+	ObjectRef object = NULL;
+	while ( (object = WorkStealingDeque_popDequeObject(self)) )
+		release(object);
+	struct _WorkStealingBuffer *buffer = self->buffer;
+	while ( buffer ) {
+		struct _WorkStealingBuffer *previous = buffer->previous;
+		free(buffer);
+		buffer = previous;
+	}
+	self->buffer = NULL;
+	return self;
+}
+
+static void * WorkStealingDequeClass_constructor (void * _self, va_list *app) {
+	struct WorkStealingDequeClass * self = super_constructor(WorkStealingDequeClass, _self, app);
+	typedef void (*voidf) ();
+	voidf selector;
+	va_list ap;
+	va_copy(ap, *app);
+	while ( (selector = va_arg(ap, voidf)) ) {
+		voidf method = va_arg(ap, voidf);
+		if (selector == (voidf) pushDequeObject )
+			* (voidf *) & self->pushDequeObject = method;
+		else if (selector == (voidf) popDequeObject )
+			* (voidf *) & self->popDequeObject = method;
+		else if (selector == (voidf) stealDequeObject )
+			* (voidf *) & self->stealDequeObject = method;
+	}
+	va_end(ap);
+	return self;
+}
+
+static void * WorkStealingDeque_copy (const void * const _self) {
+	return NULL;
+}
+
+/* Doubles the buffer, keeping the old one alive for the thieves still reading it. Returns NULL, leaving the deque
+ * unchanged, if the new buffer cannot be allocated. */
+static struct _WorkStealingBuffer * WorkStealingDeque_grow(struct WorkStealingDeque *const self, struct _WorkStealingBuffer *const buffer, Integer top, Integer bottom) {
+	struct _WorkStealingBuffer *grown = WorkStealingDeque_newBuffer(2 * (buffer->mask + 1), buffer);
+	if ( grown == NULL ) return NULL;
+	for (Integer i=top; i<bottom; i++)
+		grown->objects[i & grown->mask] = __atomic_load_n(&(buffer->objects[i & buffer->mask]), __ATOMIC_RELAXED);
+	__atomic_store_n(&(self->buffer), grown, __ATOMIC_RELEASE);
+	return grown;
+}
+
+static bool WorkStealingDeque_pushDequeObject(void *const _self, void *const object) {
+	struct WorkStealingDeque *self = _self;
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_RELAXED);
+	Integer top = __atomic_load_n(&(self->top), __ATOMIC_ACQUIRE);
+	struct _WorkStealingBuffer *buffer = __atomic_load_n(&(self->buffer), __ATOMIC_RELAXED);
+	if ( bottom - top > buffer->mask ) {
+		buffer = WorkStealingDeque_grow(self, buffer, top, bottom);
+		if ( buffer == NULL ) return errno = ENOMEM, NO;
+	}
+	retain(object);
+	__atomic_store_n(&(buffer->objects[bottom & buffer->mask]), object, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&(self->bottom), bottom + 1, __ATOMIC_RELAXED);
+	return YES;
+}
+
+static ObjectRef WorkStealingDeque_popDequeObject(void *const _self) {
+	struct WorkStealingDeque *self = _self;
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_RELAXED) - 1;
+	struct _WorkStealingBuffer *buffer = __atomic_load_n(&(self->buffer), __ATOMIC_RELAXED);
+	__atomic_store_n(&(self->bottom), bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	Integer top = __atomic_load_n(&(self->top), __ATOMIC_RELAXED);
+
+	ObjectRef object = NULL;
+	if ( top <= bottom ) {
+		object = __atomic_load_n(&(buffer->objects[bottom & buffer->mask]), __ATOMIC_RELAXED);
+		if ( top == bottom ) {
+			/* The last one: race the thieves for it */
+			if ( ! __atomic_compare_exchange_n(&(self->top), &top, top + 1, NO, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) )
+				object = NULL;
+			__atomic_store_n(&(self->bottom), bottom + 1, __ATOMIC_RELAXED);
+		}
+	}
+	else
+		__atomic_store_n(&(self->bottom), bottom + 1, __ATOMIC_RELAXED);
+	return object;
+}
+
+static ObjectRef WorkStealingDeque_stealDequeObject(void *const _self) {
+	struct WorkStealingDeque *self = _self;
+	Integer top = __atomic_load_n(&(self->top), __ATOMIC_ACQUIRE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE);
+	if ( top >= bottom )
+		return NULL;
+
+	struct _WorkStealingBuffer *buffer = __atomic_load_n(&(self->buffer), __ATOMIC_ACQUIRE);
+	ObjectRef object = __atomic_load_n(&(buffer->objects[top & buffer->mask]), __ATOMIC_RELAXED);
+	if ( ! __atomic_compare_exchange_n(&(self->top), &top, top + 1, NO, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) )
+		return NULL;
+	return object;
+}
+
+static UInteger WorkStealingDeque_getCollectionCount(const void *const _self) {
+	const struct WorkStealingDeque *self = _self;
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE);
+	Integer top = __atomic_load_n(&(self->top), __ATOMIC_ACQUIRE);
+	return bottom > top ? (UInteger)(bottom - top) : 0;
+}
+
+/* The Collection methods read the live range straight out of the buffer. They are only meant for the owner thread while
+ * no thief runs: a stolen object may be released by its thief while these still look at it. */
+
+static ObjectRef WorkStealingDeque_objectAtPosition(const struct WorkStealingDeque *const self, Integer position) {
+	const struct _WorkStealingBuffer *buffer = __atomic_load_n(&(self->buffer), __ATOMIC_ACQUIRE);
+	return __atomic_load_n(&(buffer->objects[position & buffer->mask]), __ATOMIC_RELAXED);
+}
+
+static bool WorkStealingDeque_containsObject(const void *const _self, const void *const object) {
+	const struct WorkStealingDeque *self = _self;
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE);
+	for (Integer i=__atomic_load_n(&(self->top), __ATOMIC_ACQUIRE); i<bottom; i++)
+		if ( equals(WorkStealingDeque_objectAtPosition(self, i), object) )
+			return YES;
+	return NO;
+}
+
+/* The oldest object, the next one to be stolen */
+static void * WorkStealingDeque_firstObject(const void *const _self) {
+	const struct WorkStealingDeque *self = _self;
+	Integer top = __atomic_load_n(&(self->top), __ATOMIC_ACQUIRE);
+	if ( __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE) <= top )
+		return NULL;
+	return WorkStealingDeque_objectAtPosition(self, top);
+}
+
+/* The newest object, the next one to be popped */
+static void * WorkStealingDeque_lastObject(const void *const _self) {
+	const struct WorkStealingDeque *self = _self;
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE);
+	if ( bottom <= __atomic_load_n(&(self->top), __ATOMIC_ACQUIRE) )
+		return NULL;
+	return WorkStealingDeque_objectAtPosition(self, bottom - 1);
+}
+
+/* From the oldest object to the newest. extra[0] holds the next position, bottom serves as the mutations counter
+ * since every push and pop moves it. */
+static UInteger WorkStealingDeque_enumerateWithState(const void *const _self, FastEnumerationState *const state, void *iobuffer[], UInteger length) {
+	const struct WorkStealingDeque *self = _self;
+	if ( state->state == 0 ) {
+		state->mutationsPointer = (UInteger *)&(self->bottom);
+		state->extra[0] = (UInteger)__atomic_load_n(&(self->top), __ATOMIC_ACQUIRE);
+		state->state = 1;
+	}
+	state->itemsPointer = iobuffer;
+	Integer position = (Integer)state->extra[0];
+	Integer bottom = __atomic_load_n(&(self->bottom), __ATOMIC_ACQUIRE);
+	UInteger count = 0;
+	for (; count<length && position<bottom; count++, position++)
+		iobuffer[count] = WorkStealingDeque_objectAtPosition(self, position);
+	state->extra[0] = (UInteger)position;
+	return count;
+}
+
+CO_CLASS_INIT_DECL(WorkStealingDeque) {
+	if ( ! WorkStealingDequeClass )
+		WorkStealingDequeClass = new(CollectionClass, "WorkStealingDequeClass", CollectionClass, sizeof(struct WorkStealingDequeClass),
+									 constructor, WorkStealingDequeClass_constructor, NULL);
+	if ( CO_CLASS_PENDING(WorkStealingDeque) )
+		CO_CLASS_PUBLISH(WorkStealingDeque, new(WorkStealingDequeClass, "WorkStealingDeque", Collection, sizeof(struct WorkStealingDeque),
+								constructor, WorkStealingDeque_constructor,
+								destructor, WorkStealingDeque_destructor,
+
+								/* Overrides */
+								copy, WorkStealingDeque_copy,
+								getCollectionCount, WorkStealingDeque_getCollectionCount,
+								containsObject, WorkStealingDeque_containsObject,
+								firstObject, WorkStealingDeque_firstObject,
+								lastObject, WorkStealingDeque_lastObject,
+								enumerateWithState, WorkStealingDeque_enumerateWithState,
+
+								/* new */
+								pushDequeObject, WorkStealingDeque_pushDequeObject,
+								popDequeObject, WorkStealingDeque_popDequeObject,
+								stealDequeObject, WorkStealingDeque_stealDequeObject,
+								NULL));
+}
+
+void deallocWorkStealingDeque() {
+	release((void *)WorkStealingDeque), WorkStealingDeque = NULL;
+	release((void *)WorkStealingDequeClass), WorkStealingDequeClass = NULL;
+}
+
+/* API */
+
+bool pushDequeObject(void *const self, void *const object) {
+	COAssertNoNullOrReturn(self,EINVAL,NO);
+	COAssertNoNullOrReturn(object,EINVAL,NO);
+	const struct WorkStealingDequeClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NO);
+	COAssertNoNullOrReturn(class->pushDequeObject,ENOTSUP,NO);
+	return class->pushDequeObject(self, object);
+}
+
+ObjectRef popDequeObject(void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct WorkStealingDequeClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->popDequeObject,ENOTSUP,NULL);
+	return class->popDequeObject(self);
+}
+
+ObjectRef stealDequeObject(void *const self) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	const struct WorkStealingDequeClass *const class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->stealDequeObject,ENOTSUP,NULL);
+	return class->stealDequeObject(self);
+}
@@ -20,7 +20,7 @@
 #include <new.h>
 
 
-static void * Class_constructor (void * _self, va_list * app) {
+void * Class_constructor (void * _self, va_list * app) {
 	struct Classs * self = _self;
 	
 	self->class_name = va_arg( *app, const char *);
@@ -35,12 +35,15 @@ static void * Class_constructor (void * _self, va_list * app) {
 		voidf selector = NULL;
 		va_list ap;
 		va_copy(ap, *app);
+		bool overridesConstructor = NO, overridesInitializer = NO;
 		
 		while ( (selector = va_arg(ap, voidf)) ) {
 			voidf method = va_arg(ap, voidf);
 			
 			if ( selector == (voidf) constructor )
-				* (voidf *) & self->constructor = method;
+				* (voidf *) & self->constructor = method, overridesConstructor = YES;
+			else if ( selector == (voidf) initializer )
+				* (voidf *) & self->initializer = method, overridesInitializer = YES;
 			else if ( selector == (voidf) destructor )
 				* (voidf *) & self->destructor = method;
 			
@@ -66,20 +69,24 @@ static void * Class_constructor (void * _self, va_list * app) {
 				* (voidf *) & self->autorelease = method;
 		}
 		va_end(ap);
+		
+		/* An inherited initializer would skip this class's constructor */
+		if ( overridesConstructor && ! overridesInitializer )
+			self->initializer = NULL;
 	}
 	
 	return self;
 }
 
-static void * Class_destructor (void * _self) {
+void * Class_destructor (void * _self) {
 	return NULL;
 }
 
-static void * Class_copy (const void *const _self) {
+void * Class_copy (const void *const _self) {
 	return NULL;
 }
 
-static UInteger Class_hash (const void *const self) {
+UInteger Class_hash (const void *const self) {
 	COAssertNoNullOrReturn(self,EINVAL,0);
 	const struct Classs *const class = classOf(self);
 	COAssertNoNullOrReturn(class,EINVAL,0);
@@ -94,21 +101,21 @@ static UInteger Class_hash (const void *const self) {
 	result = prime * result + class->size;
 	return result;
 }
-static void * Class_retain (void *const _self) {
+void * Class_retain (void *const _self) {
 	return NULL;
 }
 
 static void Class_release (void *const _self) {
 }
 
-static void *Class_autorelease (void *const _self) {
+void *Class_autorelease (void *const _self) {
 	return NULL;
 }
 
-static const struct Classs object [] = {
-	{	{object+1},
+const struct Classs CORootClasses [] = {
+	{	{CORootClasses+1},
 		"Object",
-		object,
+		CORootClasses,
 		sizeof(struct Object),
 		Object_constructor,
 		Object_destructor,
@@ -120,10 +127,11 @@ static const struct Classs object [] = {
 		Object_release,
 		Object_retainCount,
 		Object_autorelease,
+		Object_initializer,
 	},
-	{	{object+1},
+	{	{CORootClasses+1},
 		"Class",
-		object,
+		CORootClasses,
 		sizeof(struct Classs),
 		Class_constructor,
 		Class_destructor,
@@ -135,11 +143,35 @@ static const struct Classs object [] = {
 		Object_release,
 		Object_retainCount,
 		Class_autorelease,
+		NULL,
+	},
+	{	{CORootClasses+1},
+		"LazyClass",
+		CORootClasses+1,
+		sizeof(struct COLazyClass),
+		NULL,
+		Class_destructor,
+		Class_copy,
+		Object_equals,
+		Class_hash,
+		Object_copyDescription,
+		Class_retain,
+		Class_release,
+		Object_retainCount,
+		Class_autorelease,
+		NULL,
 	}
 };
 
-const void *const Object = (const void * const)(object);
-const void *const Class = (const void * const )(object+1);
+const void * COResolveLazyClass (const void *const _class) {
+	const struct COLazyClass *const class = _class;
+	class->initialize();
+	/* Pairs with the release store of CO_CLASS_PUBLISH */
+	return __atomic_load_n(class->class, __ATOMIC_ACQUIRE);
+}
+
+const void *const Object = (const void * const)(CORootClasses);
+const void *const Class = (const void * const )(CORootClasses+1);
 
 
 
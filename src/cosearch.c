@@ -0,0 +1,364 @@
+//
+//  cosearch.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include <cosearch.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define COSEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+/* Needles at least this long fall back to Two-Way when filtering them forwards costs too much */
+#define COSEARCH_TWO_WAY_LENGTH 64
+
+/* ASCII case folding, the same whatever the locale */
+static inline unsigned char COSearchFold(unsigned char character) {
+	return ( character >= 'A' && character <= 'Z' ) ? (unsigned char)(character | 0x20) : character;
+}
+
+static bool COSearchEqualCaseInsensitive(const char *text, const char *needle, UInteger length) {
+	for (UInteger i=0; i<length; i++)
+		if ( COSearchFold((unsigned char)text[i]) != COSearchFold((unsigned char)needle[i]) )
+			return NO;
+	return YES;
+}
+
+/* A candidate is compared in full, ignoring case when folding */
+static inline bool COSearchMatches(const char *candidate, const char *needle, UInteger length, bool fold) {
+	return fold ? COSearchEqualCaseInsensitive(candidate, needle, length) : ( memcmp(candidate, needle, length) == 0 );
+}
+
+/* The difference of the first bytes to differ once folded, as strncasecmp gives it in the C locale */
+static int COCompareCaseInsensitiveScalar(const char *text, const char *other, UInteger length) {
+	for (UInteger i=0; i<length; i++) {
+		int difference = (int)COSearchFold((unsigned char)text[i]) - (int)COSearchFold((unsigned char)other[i]);
+		if ( difference ) return difference;
+	}
+	return 0;
+}
+
+/* Scalar searches, also the tails of the vectorized ones */
+
+static const char * COSearchForwardScalar(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold) {
+	const char *end = haystack + haystackLength - needleLength + 1;
+	if ( ! fold ) {
+		const char *candidate = haystack;
+		while ( candidate < end && (candidate = memchr(candidate, needle[0], (UInteger)(end - candidate))) ) {
+			if ( COSearchMatches(candidate, needle, needleLength, NO) )
+				return candidate;
+			candidate++;
+		}
+		return NULL;
+	}
+	const unsigned char first = COSearchFold((unsigned char)needle[0]);
+	for (const char *candidate = haystack; candidate < end; candidate++)
+		if ( COSearchFold((unsigned char)*candidate) == first && COSearchMatches(candidate, needle, needleLength, YES) )
+			return candidate;
+	return NULL;
+}
+
+static const char * COSearchBackwardScalar(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold) {
+	const unsigned char first = fold ? COSearchFold((unsigned char)needle[0]) : (unsigned char)needle[0];
+	for (UInteger position = haystackLength - needleLength + 1; position-- > 0; ) {
+		unsigned char character = (unsigned char)haystack[position];
+		if ( (fold ? COSearchFold(character) : character) == first && COSearchMatches(haystack + position, needle, needleLength, fold) )
+			return haystack + position;
+	}
+	return NULL;
+}
+
+/* Two-Way (Crochemore and Perrin, 1991), with the last byte shift table of musl's memmem */
+
+#define COSEARCH_BITOP(set, byte, op) ((set)[(byte) / (8 * sizeof(UInteger))] op ((UInteger)1 << ((byte) % (8 * sizeof(UInteger)))))
+
+static const char * COSearchTwoWay(const char *_haystack, UInteger haystackLength, const char *_needle, UInteger needleLength) {
+	const unsigned char *haystack = (const unsigned char *)_haystack, *needle = (const unsigned char *)_needle;
+	const unsigned char *const end = haystack + haystackLength;
+	UInteger byteset[32 / sizeof(UInteger)] = { 0 };
+	UInteger shift[256];
+	for (UInteger i=0; i<needleLength; i++)
+		COSEARCH_BITOP(byteset, needle[i], |=), shift[needle[i]] = i + 1;
+
+	/* The critical factorization, from the maximal suffixes for both orderings */
+	UInteger ip = (UInteger)-1, jp = 0, k = 1, p = 1;
+	while ( jp + k < needleLength ) {
+		if ( needle[ip + k] == needle[jp + k] ) {
+			if ( k == p ) jp += p, k = 1;
+			else k++;
+		}
+		else if ( needle[ip + k] > needle[jp + k] ) jp += k, k = 1, p = jp - ip;
+		else ip = jp++, k = p = 1;
+	}
+	UInteger ms = ip, p0 = p;
+	ip = (UInteger)-1, jp = 0, k = p = 1;
+	while ( jp + k < needleLength ) {
+		if ( needle[ip + k] == needle[jp + k] ) {
+			if ( k == p ) jp += p, k = 1;
+			else k++;
+		}
+		else if ( needle[ip + k] < needle[jp + k] ) jp += k, k = 1, p = jp - ip;
+		else ip = jp++, k = p = 1;
+	}
+	if ( ip + 1 > ms + 1 ) ms = ip;
+	else p = p0;
+
+	/* A periodic needle remembers how much of its prefix already matched */
+	UInteger memory0 = 0, memory = 0;
+	if ( memcmp(needle, needle + p, ms + 1) ) {
+		memory0 = 0;
+		p = (ms > needleLength - ms - 1 ? ms : needleLength - ms - 1) + 1;
+	}
+	else
+		memory0 = needleLength - p;
+
+	for (;;) {
+		if ( (UInteger)(end - haystack) < needleLength ) return NULL;
+
+		/* The last byte first, shifting past it when it is not in the needle */
+		if ( COSEARCH_BITOP(byteset, haystack[needleLength - 1], &) ) {
+			k = needleLength - shift[haystack[needleLength - 1]];
+			if ( k ) {
+				if ( k < memory ) k = memory;
+				haystack += k, memory = 0;
+				continue;
+			}
+		}
+		else {
+			haystack += needleLength, memory = 0;
+			continue;
+		}
+
+		/* The right half, then the left one */
+		for (k = (ms + 1 > memory ? ms + 1 : memory); k < needleLength && needle[k] == haystack[k]; k++);
+		if ( k < needleLength ) {
+			haystack += k - ms, memory = 0;
+			continue;
+		}
+		for (k = ms + 1; k > memory && needle[k - 1] == haystack[k - 1]; k--);
+		if ( k <= memory ) return (const char *)haystack;
+		haystack += p, memory = memory0;
+	}
+}
+
+/* First and last byte filtering: a position is compared in full only when both its first byte and the byte where the
+ * needle would end match, a block of positions at a time. Folding sets the 0x20 bit on both sides, which keeps every
+ * position whose bytes are equal ignoring the case of ASCII letters. */
+
+/* The bytes the forward filters may spend comparing candidates before leaving the rest of the haystack to Two-Way,
+ * which keeps them linear on adversarial texts. Exhausted, resume is where Two-Way takes over. */
+struct _COSearchBudget {
+	UInteger bytes;
+	const char *resume;
+};
+
+static inline bool COSearchSpend(struct _COSearchBudget *budget, const char *position, UInteger bytes) {
+	if ( budget == NULL ) return NO;
+	if ( budget->bytes < bytes ) return budget->resume = position, YES;
+	budget->bytes -= bytes;
+	return NO;
+}
+
+#ifdef COSEARCH_X86
+
+static const char * COSearchForwardSSE2(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold, struct _COSearchBudget *budget) {
+	const char foldBit = fold ? 0x20 : 0;
+	const __m128i folding = _mm_set1_epi8(foldBit);
+	const __m128i first = _mm_set1_epi8((char)(needle[0] | foldBit)), last = _mm_set1_epi8((char)(needle[needleLength - 1] | foldBit));
+	UInteger i = 0;
+	for (; i + needleLength + 15 <= haystackLength; i += 16) {
+		__m128i blockFirst = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + i)), folding);
+		__m128i blockLast = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + i + needleLength - 1)), folding);
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+		if ( mask && COSearchSpend(budget, haystack + i, (UInteger)__builtin_popcount(mask) * needleLength) )
+			return NULL;
+		for (; mask; mask &= mask - 1) {
+			UInteger bit = (UInteger)__builtin_ctz(mask);
+			if ( COSearchMatches(haystack + i + bit, needle, needleLength, fold) )
+				return haystack + i + bit;
+		}
+	}
+	return COSearchForwardScalar(haystack + i, haystackLength - i, needle, needleLength, fold);
+}
+
+static const char * COSearchBackwardSSE2(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold) {
+	const char foldBit = fold ? 0x20 : 0;
+	const __m128i folding = _mm_set1_epi8(foldBit);
+	const __m128i first = _mm_set1_epi8((char)(needle[0] | foldBit)), last = _mm_set1_epi8((char)(needle[needleLength - 1] | foldBit));
+	/* The positions left to try are those before j */
+	UInteger j = haystackLength - needleLength + 1;
+	for (; j >= 16; j -= 16) {
+		__m128i blockFirst = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + j - 16)), folding);
+		__m128i blockLast = _mm_or_si128(_mm_loadu_si128((const __m128i *)(haystack + j - 16 + needleLength - 1)), folding);
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+		while ( mask ) {
+			UInteger bit = 31 - (UInteger)__builtin_clz(mask);
+			if ( COSearchMatches(haystack + j - 16 + bit, needle, needleLength, fold) )
+				return haystack + j - 16 + bit;
+			mask &= ~(1U << bit);
+		}
+	}
+	return COSearchBackwardScalar(haystack, j + needleLength - 1, needle, needleLength, fold);
+}
+
+__attribute__((target("avx2")))
+static const char * COSearchForwardAVX2(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold, struct _COSearchBudget *budget) {
+	const char foldBit = fold ? 0x20 : 0;
+	const __m256i folding = _mm256_set1_epi8(foldBit);
+	const __m256i first = _mm256_set1_epi8((char)(needle[0] | foldBit)), last = _mm256_set1_epi8((char)(needle[needleLength - 1] | foldBit));
+	UInteger i = 0;
+	for (; i + needleLength + 31 <= haystackLength; i += 32) {
+		__m256i blockFirst = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(haystack + i)), folding);
+		__m256i blockLast = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(haystack + i + needleLength - 1)), folding);
+		unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+		if ( mask && COSearchSpend(budget, haystack + i, (UInteger)__builtin_popcount(mask) * needleLength) )
+			return NULL;
+		for (; mask; mask &= mask - 1) {
+			UInteger bit = (UInteger)__builtin_ctz(mask);
+			if ( COSearchMatches(haystack + i + bit, needle, needleLength, fold) )
+				return haystack + i + bit;
+		}
+	}
+	return COSearchForwardSSE2(haystack + i, haystackLength - i, needle, needleLength, fold, budget);
+}
+
+__attribute__((target("avx2")))
+static const char * COSearchBackwardAVX2(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold) {
+	const char foldBit = fold ? 0x20 : 0;
+	const __m256i folding = _mm256_set1_epi8(foldBit);
+	const __m256i first = _mm256_set1_epi8((char)(needle[0] | foldBit)), last = _mm256_set1_epi8((char)(needle[needleLength - 1] | foldBit));
+	UInteger j = haystackLength - needleLength + 1;
+	for (; j >= 32; j -= 32) {
+		__m256i blockFirst = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(haystack + j - 32)), folding);
+		__m256i blockLast = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(haystack + j - 32 + needleLength - 1)), folding);
+		unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+		while ( mask ) {
+			UInteger bit = 31 - (UInteger)__builtin_clz(mask);
+			if ( COSearchMatches(haystack + j - 32 + bit, needle, needleLength, fold) )
+				return haystack + j - 32 + bit;
+			mask &= ~(1U << bit);
+		}
+	}
+	return COSearchBackwardSSE2(haystack, j + needleLength - 1, needle, needleLength, fold);
+}
+
+/* Comparisons fold the upper case letters exactly: bytes shifted so that 'A' is the smallest signed one are upper case
+ * when they are less than 26 past it */
+static inline __m128i COCompareFoldSSE2(__m128i block) {
+	__m128i upper = _mm_cmplt_epi8(_mm_add_epi8(block, _mm_set1_epi8((char)(0x80 - 'A'))), _mm_set1_epi8((char)(0x80 + 26)));
+	return _mm_or_si128(block, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+/* At least 16 bytes; the last block overlaps the one before it, whose bytes are equal */
+static int COCompareCaseInsensitiveSSE2(const char *text, const char *other, UInteger length) {
+	for (UInteger i=0; i<length; i += 16) {
+		if ( i + 16 > length ) i = length - 16;
+		__m128i block = COCompareFoldSSE2(_mm_loadu_si128((const __m128i *)(text + i)));
+		__m128i otherBlock = COCompareFoldSSE2(_mm_loadu_si128((const __m128i *)(other + i)));
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, otherBlock)) ^ 0xFFFFU;
+		if ( mask ) {
+			UInteger bit = (UInteger)__builtin_ctz(mask);
+			return COCompareCaseInsensitiveScalar(text + i + bit, other + i + bit, 1);
+		}
+	}
+	return 0;
+}
+
+__attribute__((target("avx2")))
+static inline __m256i COCompareFoldAVX2(__m256i block) {
+	__m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(0x80 + 26)), _mm256_add_epi8(block, _mm256_set1_epi8((char)(0x80 - 'A'))));
+	return _mm256_or_si256(block, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+/* At least 32 bytes, as above. Not finished by the SSE2 version: legacy SSE code run with the upper halves of the
+ * registers dirty is slowed down until the next vzeroupper */
+__attribute__((target("avx2")))
+static int COCompareCaseInsensitiveAVX2(const char *text, const char *other, UInteger length) {
+	for (UInteger i=0; i<length; i += 32) {
+		if ( i + 32 > length ) i = length - 32;
+		__m256i block = COCompareFoldAVX2(_mm256_loadu_si256((const __m256i *)(text + i)));
+		__m256i otherBlock = COCompareFoldAVX2(_mm256_loadu_si256((const __m256i *)(other + i)));
+		unsigned mask = ~(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, otherBlock));
+		if ( mask ) {
+			UInteger bit = (UInteger)__builtin_ctz(mask);
+			return COCompareCaseInsensitiveScalar(text + i + bit, other + i + bit, 1);
+		}
+	}
+	return 0;
+}
+
+/* 0 until the processor was asked, then 1 without AVX2 and 2 with it */
+static int COSearchAVX2State = 0;
+
+static int COSearchHasAVX2() {
+	int state = __atomic_load_n(&COSearchAVX2State, __ATOMIC_RELAXED);
+	if ( state == 0 ) {
+		__builtin_cpu_init();
+		state = __builtin_cpu_supports("avx2") ? 2 : 1;
+		__atomic_store_n(&COSearchAVX2State, state, __ATOMIC_RELAXED);
+	}
+	return state == 2;
+}
+
+#endif /* COSEARCH_X86 */
+
+static const char * COSearchFiltering(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength, bool fold, bool backwards, struct _COSearchBudget *budget) {
+#ifdef COSEARCH_X86
+	if ( COSearchHasAVX2() )
+		return backwards ? COSearchBackwardAVX2(haystack, haystackLength, needle, needleLength, fold) : COSearchForwardAVX2(haystack, haystackLength, needle, needleLength, fold, budget);
+	return backwards ? COSearchBackwardSSE2(haystack, haystackLength, needle, needleLength, fold) : COSearchForwardSSE2(haystack, haystackLength, needle, needleLength, fold, budget);
+#else
+	return backwards ? COSearchBackwardScalar(haystack, haystackLength, needle, needleLength, fold) : COSearchForwardScalar(haystack, haystackLength, needle, needleLength, fold);
+#endif
+}
+
+/* API */
+
+const char * COSearchForward(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength) {
+	if ( needleLength == 0 || needleLength > haystackLength ) return NULL;
+	if ( needleLength == 1 ) return memchr(haystack, needle[0], haystackLength);
+	if ( needleLength < COSEARCH_TWO_WAY_LENGTH ) return COSearchFiltering(haystack, haystackLength, needle, needleLength, NO, NO, NULL);
+#ifdef COSEARCH_X86
+	/* Long needles are filtered while candidates are rare, as they are in most texts */
+	struct _COSearchBudget budget = { haystackLength, NULL };
+	const char *found = COSearchFiltering(haystack, haystackLength, needle, needleLength, NO, NO, &budget);
+	if ( found || budget.resume == NULL ) return found;
+	return COSearchTwoWay(budget.resume, haystackLength - (UInteger)(budget.resume - haystack), needle, needleLength);
+#else
+	return COSearchTwoWay(haystack, haystackLength, needle, needleLength);
+#endif
+}
+
+const char * COSearchBackward(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength) {
+	if ( needleLength == 0 || needleLength > haystackLength ) return NULL;
+	return COSearchFiltering(haystack, haystackLength, needle, needleLength, NO, YES, NULL);
+}
+
+const char * COSearchForwardCaseInsensitive(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength) {
+	if ( needleLength == 0 || needleLength > haystackLength ) return NULL;
+	return COSearchFiltering(haystack, haystackLength, needle, needleLength, YES, NO, NULL);
+}
+
+const char * COSearchBackwardCaseInsensitive(const char *haystack, UInteger haystackLength, const char *needle, UInteger needleLength) {
+	if ( needleLength == 0 || needleLength > haystackLength ) return NULL;
+	return COSearchFiltering(haystack, haystackLength, needle, needleLength, YES, YES, NULL);
+}
+
+int COCompareCaseInsensitive(const char *text, const char *other, UInteger length) {
+#ifdef COSEARCH_X86
+	/* Short texts differ early or not at all, not worth the dispatch */
+	if ( length < 16 ) return COCompareCaseInsensitiveScalar(text, other, length);
+	return length >= 32 && COSearchHasAVX2() ? COCompareCaseInsensitiveAVX2(text, other, length) : COCompareCaseInsensitiveSSE2(text, other, length);
+#else
+	return COCompareCaseInsensitiveScalar(text, other, length);
+#endif
+}
@@ -0,0 +1,423 @@
+//
+//  coutf8.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include <coutf8.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define COUTF8_X86 1
+#include <immintrin.h>
+#endif
+
+/* Scalar sequences, also the non-ASCII parts of the vectorized loops */
+
+/* Decodes the sequence starting text, returns its length or 0 when it is malformed or truncated */
+static inline UInteger COUTF8Decode(const unsigned char *text, UInteger remaining, uint32_t *codePoint) {
+	const unsigned char lead = text[0];
+	if ( lead < 0x80 )
+		return *codePoint = lead, 1;
+	if ( lead < 0xC2 )
+		return 0;
+	if ( lead < 0xE0 ) {
+		if ( remaining < 2 || (text[1] & 0xC0) != 0x80 ) return 0;
+		return *codePoint = ((uint32_t)(lead & 0x1F) << 6) | (text[1] & 0x3F), 2;
+	}
+	if ( lead < 0xF0 ) {
+		if ( remaining < 3 || (text[1] & 0xC0) != 0x80 || (text[2] & 0xC0) != 0x80 ) return 0;
+		/* Overlong, or a surrogate */
+		if ( (lead == 0xE0 && text[1] < 0xA0) || (lead == 0xED && text[1] > 0x9F) ) return 0;
+		return *codePoint = ((uint32_t)(lead & 0x0F) << 12) | ((uint32_t)(text[1] & 0x3F) << 6) | (text[2] & 0x3F), 3;
+	}
+	if ( lead < 0xF5 ) {
+		if ( remaining < 4 || (text[1] & 0xC0) != 0x80 || (text[2] & 0xC0) != 0x80 || (text[3] & 0xC0) != 0x80 ) return 0;
+		/* Overlong, or past U+10FFFF */
+		if ( (lead == 0xF0 && text[1] < 0x90) || (lead == 0xF4 && text[1] > 0x8F) ) return 0;
+		return *codePoint = ((uint32_t)(lead & 0x07) << 18) | ((uint32_t)(text[1] & 0x3F) << 12) | ((uint32_t)(text[2] & 0x3F) << 6) | (text[3] & 0x3F), 4;
+	}
+	return 0;
+}
+
+/* Encodes codePoint at output, returns its length or 0 for a surrogate or a code point past U+10FFFF */
+static inline UInteger COUTF8Encode(uint32_t codePoint, char *output) {
+	unsigned char *bytes = (unsigned char *)output;
+	if ( codePoint < 0x80 )
+		return bytes[0] = (unsigned char)codePoint, 1;
+	if ( codePoint < 0x800 ) {
+		bytes[0] = (unsigned char)(0xC0 | (codePoint >> 6));
+		bytes[1] = (unsigned char)(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	if ( codePoint < 0x10000 ) {
+		if ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) return 0;
+		bytes[0] = (unsigned char)(0xE0 | (codePoint >> 12));
+		bytes[1] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+		bytes[2] = (unsigned char)(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+	if ( codePoint < 0x110000 ) {
+		bytes[0] = (unsigned char)(0xF0 | (codePoint >> 18));
+		bytes[1] = (unsigned char)(0x80 | ((codePoint >> 12) & 0x3F));
+		bytes[2] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+		bytes[3] = (unsigned char)(0x80 | (codePoint & 0x3F));
+		return 4;
+	}
+	return 0;
+}
+
+static inline UInteger COUTF8EncodedLength(uint32_t codePoint) {
+	if ( codePoint < 0x80 ) return 1;
+	if ( codePoint < 0x800 ) return 2;
+	if ( codePoint < 0x10000 ) return ( codePoint >= 0xD800 && codePoint <= 0xDFFF ) ? 0 : 3;
+	return codePoint < 0x110000 ? 4 : 0;
+}
+
+/* A surrogate pair makes one code point, a lone surrogate none: returns the units used or 0 */
+static inline UInteger COUTF16Decode(const uint16_t *text, UInteger remaining, uint32_t *codePoint) {
+	const uint16_t unit = text[0];
+	if ( unit < 0xD800 || unit > 0xDFFF )
+		return *codePoint = unit, 1;
+	if ( unit > 0xDBFF || remaining < 2 || text[1] < 0xDC00 || text[1] > 0xDFFF )
+		return 0;
+	return *codePoint = 0x10000 + (((uint32_t)unit - 0xD800) << 10) + ((uint32_t)text[1] - 0xDC00), 2;
+}
+
+static bool COUTF8ValidateScalar(const unsigned char *text, UInteger length) {
+	UInteger i = 0;
+	uint32_t codePoint;
+	while ( i < length ) {
+		/* Eight ASCII bytes at a time */
+		uint64_t word;
+		if ( i + 8 <= length && (memcpy(&word, text + i, 8), (word & 0x8080808080808080ULL) == 0) ) {
+			i += 8;
+			continue;
+		}
+		UInteger sequence = COUTF8Decode(text + i, length - i, &codePoint);
+		if ( sequence == 0 ) return NO;
+		i += sequence;
+	}
+	return YES;
+}
+
+#if defined(COUTF8_X86)
+
+/* Validation with the lookup tables of Keiser and Lemire, "Validating UTF-8 in less than one instruction per byte".
+ * Each byte is classified by the high nibble of the previous byte, the low nibble of the previous byte and its own
+ * high nibble; the three classes share a bit exactly when the two bytes make an error. Which bytes must be third or
+ * fourth continuations is checked apart, from the two and three previous bytes. */
+
+#define COUTF8_TOO_SHORT		(1 << 0)	/* A lead not followed by a continuation */
+#define COUTF8_TOO_LONG			(1 << 1)	/* A continuation after an ASCII byte */
+#define COUTF8_OVERLONG_3		(1 << 2)
+#define COUTF8_TOO_LARGE		(1 << 3)
+#define COUTF8_SURROGATE		(1 << 4)
+#define COUTF8_OVERLONG_2		(1 << 5)
+#define COUTF8_TOO_LARGE_1000	(1 << 6)
+#define COUTF8_OVERLONG_4		(1 << 6)
+#define COUTF8_TWO_CONTINUATIONS	(1 << 7)
+#define COUTF8_CARRY			(COUTF8_TOO_SHORT | COUTF8_TOO_LONG | COUTF8_TWO_CONTINUATIONS)
+
+#define COUTF8_TABLE(...) _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+struct _COUTF8Validation {
+	__m256i error;
+	__m256i previous;			/* The last block */
+	__m256i previousIncomplete;	/* Non zero when the last block ends within a sequence */
+};
+
+__attribute__((target("avx2")))
+static inline void COUTF8ValidateBlockAVX2(struct _COUTF8Validation *const validation, __m256i input) {
+	if ( _mm256_movemask_epi8(input) == 0 ) {
+		/* ASCII, an error only if the previous block expected continuations */
+		validation->error = _mm256_or_si256(validation->error, validation->previousIncomplete);
+		validation->previousIncomplete = _mm256_setzero_si256();
+		validation->previous = input;
+		return;
+	}
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i byte1High = COUTF8_TABLE(
+		COUTF8_TOO_LONG, COUTF8_TOO_LONG, COUTF8_TOO_LONG, COUTF8_TOO_LONG,
+		COUTF8_TOO_LONG, COUTF8_TOO_LONG, COUTF8_TOO_LONG, COUTF8_TOO_LONG,
+		(char)COUTF8_TWO_CONTINUATIONS, (char)COUTF8_TWO_CONTINUATIONS, (char)COUTF8_TWO_CONTINUATIONS, (char)COUTF8_TWO_CONTINUATIONS,
+		COUTF8_TOO_SHORT | COUTF8_OVERLONG_2,
+		COUTF8_TOO_SHORT,
+		COUTF8_TOO_SHORT | COUTF8_OVERLONG_3 | COUTF8_SURROGATE,
+		COUTF8_TOO_SHORT | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000 | COUTF8_OVERLONG_4);
+	const __m256i byte1Low = COUTF8_TABLE(
+		(char)(COUTF8_CARRY | COUTF8_OVERLONG_3 | COUTF8_OVERLONG_2 | COUTF8_OVERLONG_4),
+		(char)(COUTF8_CARRY | COUTF8_OVERLONG_2),
+		(char)COUTF8_CARRY,
+		(char)COUTF8_CARRY,
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000 | COUTF8_SURROGATE),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000),
+		(char)(COUTF8_CARRY | COUTF8_TOO_LARGE | COUTF8_TOO_LARGE_1000));
+	const __m256i byte2High = COUTF8_TABLE(
+		COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT,
+		COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT,
+		(char)(COUTF8_TOO_LONG | COUTF8_OVERLONG_2 | COUTF8_TWO_CONTINUATIONS | COUTF8_OVERLONG_3 | COUTF8_TOO_LARGE_1000 | COUTF8_OVERLONG_4),
+		(char)(COUTF8_TOO_LONG | COUTF8_OVERLONG_2 | COUTF8_TWO_CONTINUATIONS | COUTF8_OVERLONG_3 | COUTF8_TOO_LARGE),
+		(char)(COUTF8_TOO_LONG | COUTF8_OVERLONG_2 | COUTF8_TWO_CONTINUATIONS | COUTF8_SURROGATE | COUTF8_TOO_LARGE),
+		(char)(COUTF8_TOO_LONG | COUTF8_OVERLONG_2 | COUTF8_TWO_CONTINUATIONS | COUTF8_SURROGATE | COUTF8_TOO_LARGE),
+		COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT, COUTF8_TOO_SHORT);
+
+	/* The bytes 1, 2 and 3 positions back, across the previous block */
+	const __m256i carried = _mm256_permute2x128_si256(validation->previous, input, 0x21);
+	const __m256i previous1 = _mm256_alignr_epi8(input, carried, 15);
+	const __m256i previous2 = _mm256_alignr_epi8(input, carried, 14);
+	const __m256i previous3 = _mm256_alignr_epi8(input, carried, 13);
+
+	__m256i special = _mm256_shuffle_epi8(byte1High, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), nibble));
+	special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte1Low, _mm256_and_si256(previous1, nibble)));
+	special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+	/* Third and fourth bytes of sequences must be continuations, and only they may follow two continuations */
+	const __m256i isThird = _mm256_subs_epu8(previous2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+	const __m256i isFourth = _mm256_subs_epu8(previous3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+	const __m256i must23 = _mm256_and_si256(_mm256_or_si256(isThird, isFourth), _mm256_set1_epi8((char)0x80));
+	validation->error = _mm256_or_si256(validation->error, _mm256_xor_si256(must23, special));
+
+	/* A lead in the last three bytes that its sequence does not fit in */
+	const __m256i maximum = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+											 -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+											 (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+	validation->previousIncomplete = _mm256_subs_epu8(input, maximum);
+	validation->previous = input;
+}
+
+__attribute__((target("avx2")))
+static bool COUTF8ValidateAVX2(const unsigned char *text, UInteger length) {
+	struct _COUTF8Validation validation = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+	UInteger i = 0;
+	for (; i + 32 <= length; i += 32)
+		COUTF8ValidateBlockAVX2(&validation, _mm256_loadu_si256((const __m256i *)(text + i)));
+	if ( i < length ) {
+		/* The tail, padded with null bytes */
+		unsigned char block[32] = { 0 };
+		memcpy(block, text + i, length - i);
+		COUTF8ValidateBlockAVX2(&validation, _mm256_loadu_si256((const __m256i *)block));
+	}
+	validation.error = _mm256_or_si256(validation.error, validation.previousIncomplete);
+	return _mm256_testz_si256(validation.error, validation.error);
+}
+
+static int COUTF8AVX2State = 0;
+
+static int COUTF8HasAVX2() {
+	int state = __atomic_load_n(&COUTF8AVX2State, __ATOMIC_RELAXED);
+	if ( state == 0 ) {
+		__builtin_cpu_init();
+		state = __builtin_cpu_supports("avx2") ? 2 : 1;
+		__atomic_store_n(&COUTF8AVX2State, state, __ATOMIC_RELAXED);
+	}
+	return state == 2;
+}
+
+/* A bit set for each ASCII byte among the 16 at text */
+static inline int COUTF8ASCIIMask(const unsigned char *text) {
+	return ~_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)text)) & 0xFFFF;
+}
+
+#endif
+
+/* API */
+
+bool COUTF8Validate(const char *text, UInteger length) {
+#if defined(COUTF8_X86)
+	if ( length >= 32 && COUTF8HasAVX2() )
+		return COUTF8ValidateAVX2((const unsigned char *)text, length);
+#endif
+	return COUTF8ValidateScalar((const unsigned char *)text, length);
+}
+
+UInteger COUTF8CountCodePoints(const char *_text, UInteger length) {
+	const unsigned char *text = (const unsigned char *)_text;
+	UInteger count = 0, i = 0;
+#if defined(COUTF8_X86)
+	/* Every byte but the continuations, 0x80 to 0xBF, starts a code point */
+	const __m128i lastContinuation = _mm_set1_epi8((char)0xBF);
+	for (; i + 16 <= length; i += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(text + i));
+		count += (UInteger)__builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, lastContinuation)));
+	}
+#endif
+	for (; i < length; i++)
+		count += (text[i] & 0xC0) != 0x80;
+	return count;
+}
+
+UInteger COUTF8OffsetOfCodePoint(const char *_text, UInteger length, UInteger index) {
+	const unsigned char *text = (const unsigned char *)_text;
+	UInteger i = 0;
+#if defined(COUTF8_X86)
+	/* Whole blocks starting before the code point */
+	const __m128i lastContinuation = _mm_set1_epi8((char)0xBF);
+	for (; i + 16 <= length; i += 16) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(text + i));
+		UInteger count = (UInteger)__builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, lastContinuation)));
+		if ( count > index ) break;
+		index -= count;
+	}
+#endif
+	for (; i < length; i++)
+		if ( (text[i] & 0xC0) != 0x80 && index-- == 0 )
+			return i;
+	return NotFound;
+}
+
+UInteger COUTF8ToUTF32(const char *_text, UInteger length, uint32_t *output) {
+	const unsigned char *text = (const unsigned char *)_text;
+	UInteger i = 0, written = 0;
+	while ( i < length ) {
+		UInteger blockEnd = i + 1;
+#if defined(COUTF8_X86)
+		if ( i + 16 <= length ) {
+			if ( COUTF8ASCIIMask(text + i) == 0xFFFF ) {
+				/* Zero extended 16 bytes to 16 code points */
+				const __m128i zero = _mm_setzero_si128(), bytes = _mm_loadu_si128((const __m128i *)(text + i));
+				const __m128i low = _mm_unpacklo_epi8(bytes, zero), high = _mm_unpackhi_epi8(bytes, zero);
+				_mm_storeu_si128((__m128i *)(output + written), _mm_unpacklo_epi16(low, zero));
+				_mm_storeu_si128((__m128i *)(output + written + 4), _mm_unpackhi_epi16(low, zero));
+				_mm_storeu_si128((__m128i *)(output + written + 8), _mm_unpacklo_epi16(high, zero));
+				_mm_storeu_si128((__m128i *)(output + written + 12), _mm_unpackhi_epi16(high, zero));
+				i += 16, written += 16;
+				continue;
+			}
+			blockEnd = i + 16;
+		}
+#endif
+		/* The mixed block one sequence at a time */
+		while ( i < blockEnd && i < length ) {
+			uint32_t codePoint;
+			UInteger sequence = COUTF8Decode(text + i, length - i, &codePoint);
+			if ( sequence == 0 ) return NotFound;
+			output[written++] = codePoint;
+			i += sequence;
+		}
+	}
+	return written;
+}
+
+UInteger COUTF8ToUTF16(const char *_text, UInteger length, uint16_t *output) {
+	const unsigned char *text = (const unsigned char *)_text;
+	UInteger i = 0, written = 0;
+	while ( i < length ) {
+		UInteger blockEnd = i + 1;
+#if defined(COUTF8_X86)
+		if ( i + 16 <= length ) {
+			if ( COUTF8ASCIIMask(text + i) == 0xFFFF ) {
+				const __m128i zero = _mm_setzero_si128(), bytes = _mm_loadu_si128((const __m128i *)(text + i));
+				_mm_storeu_si128((__m128i *)(output + written), _mm_unpacklo_epi8(bytes, zero));
+				_mm_storeu_si128((__m128i *)(output + written + 8), _mm_unpackhi_epi8(bytes, zero));
+				i += 16, written += 16;
+				continue;
+			}
+			blockEnd = i + 16;
+		}
+#endif
+		while ( i < blockEnd && i < length ) {
+			uint32_t codePoint;
+			UInteger sequence = COUTF8Decode(text + i, length - i, &codePoint);
+			if ( sequence == 0 ) return NotFound;
+			if ( codePoint >= 0x10000 ) {
+				output[written++] = (uint16_t)(0xD800 + ((codePoint - 0x10000) >> 10));
+				output[written++] = (uint16_t)(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+			}
+			else
+				output[written++] = (uint16_t)codePoint;
+			i += sequence;
+		}
+	}
+	return written;
+}
+
+UInteger COUTF32ToUTF8(const uint32_t *text, UInteger length, char *output) {
+	UInteger i = 0, written = 0;
+	while ( i < length ) {
+		UInteger blockEnd = i + 1;
+#if defined(COUTF8_X86)
+		if ( i + 16 <= length ) {
+			const __m128i a = _mm_loadu_si128((const __m128i *)(text + i)), b = _mm_loadu_si128((const __m128i *)(text + i + 4));
+			const __m128i c = _mm_loadu_si128((const __m128i *)(text + i + 8)), d = _mm_loadu_si128((const __m128i *)(text + i + 12));
+			const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+			if ( _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) == 0xFFFF ) {
+				/* 16 code points below 0x80 narrowed to 16 bytes */
+				_mm_storeu_si128((__m128i *)(output + written), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+				i += 16, written += 16;
+				continue;
+			}
+			blockEnd = i + 16;
+		}
+#endif
+		for (; i < blockEnd && i < length; i++) {
+			UInteger sequence = COUTF8Encode(text[i], output + written);
+			if ( sequence == 0 ) return NotFound;
+			written += sequence;
+		}
+	}
+	return written;
+}
+
+UInteger COUTF16ToUTF8(const uint16_t *text, UInteger length, char *output) {
+	UInteger i = 0, written = 0;
+	while ( i < length ) {
+		UInteger blockEnd = i + 1;
+#if defined(COUTF8_X86)
+		if ( i + 16 <= length ) {
+			const __m128i a = _mm_loadu_si128((const __m128i *)(text + i)), b = _mm_loadu_si128((const __m128i *)(text + i + 8));
+			if ( _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(~0x7F)), _mm_setzero_si128())) == 0xFFFF ) {
+				_mm_storeu_si128((__m128i *)(output + written), _mm_packus_epi16(a, b));
+				i += 16, written += 16;
+				continue;
+			}
+			blockEnd = i + 16;
+		}
+#endif
+		while ( i < blockEnd && i < length ) {
+			uint32_t codePoint;
+			UInteger units = COUTF16Decode(text + i, length - i, &codePoint);
+			if ( units == 0 ) return NotFound;
+			written += COUTF8Encode(codePoint, output + written);
+			i += units;
+		}
+	}
+	return written;
+}
+
+UInteger COUTF32LengthInUTF8(const uint32_t *text, UInteger length) {
+	UInteger bytes = 0;
+	for (UInteger i=0; i<length; i++) {
+		UInteger sequence = COUTF8EncodedLength(text[i]);
+		if ( sequence == 0 ) return NotFound;
+		bytes += sequence;
+	}
+	return bytes;
+}
+
+UInteger COUTF16LengthInUTF8(const uint16_t *text, UInteger length) {
+	UInteger bytes = 0;
+	for (UInteger i=0; i<length; ) {
+		uint32_t codePoint;
+		UInteger units = COUTF16Decode(text + i, length - i, &codePoint);
+		if ( units == 0 ) return NotFound;
+		bytes += COUTF8EncodedLength(codePoint);
+		i += units;
+	}
+	return bytes;
+}
@@ -24,7 +24,8 @@ void * new (const void *const restrict _class, ...) {
 	
 	
 	/* Get the type */
-	const struct Classs *const class = _class;
+	const struct Classs *const class = COResolveClass(_class);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
 	struct Object * object;
 	va_list ap;
 	
@@ -41,6 +42,23 @@ void * new (const void *const restrict _class, ...) {
 	return object;
 }
 
+/* Creates any Object whose class has an initializer */
+void * newWithArguments (const void *const restrict _class, const void *const arguments) {
+	COAssertNoNullOrReturn(_class,EINVAL,NULL);
+	
+	const struct Classs *const class = COResolveClass(_class);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->initializer,ENOTSUP,NULL);
+	
+	if ( class->size == 0 ) return  NULL;
+	
+	struct Object * object = MEMORY_MANAGEMENT_ALLOC(class->size);
+	COAssertNoNullOrReturn(object,ENOMEM,NULL);
+	object->class = class;
+	
+	return class->initializer(object, arguments);
+}
+
 void delete (void * self) {
 	if ( self != NULL )
 		destructor(self);
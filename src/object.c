@@ -33,6 +33,15 @@ void * constructor(void * self, va_list * app) {
 	return class->constructor(self, app);
 }
 
+void * initializer(void * self, const void *const arguments) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	
+	const struct Classs *class = classOf(self);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	COAssertNoNullOrReturn(class->initializer,ENOTSUP,NULL);
+	return class->initializer(self, arguments);
+}
+
 void * destructor(void * self) {
 	COAssertNoNullOrReturn(self,EINVAL,NULL);
 	
@@ -52,6 +61,16 @@ void * super_constructor(const void *const class, void * self, va_list * app) {
 	return _superclass->constructor(self, app);
 }
 
+void * super_initializer(const void *const class, void * self, const void *const arguments) {
+	COAssertNoNullOrReturn(self,EINVAL,NULL);
+	COAssertNoNullOrReturn(class,EINVAL,NULL);
+	
+	const struct Classs * _superclass = superclass(class);
+	COAssertNoNullOrReturn(_superclass,EINVAL,NULL);
+	COAssertNoNullOrReturn(_superclass->initializer,ENOTSUP,NULL);
+	return _superclass->initializer(self, arguments);
+}
+
 void * super_destructor(const void *const class, void * self) {
 	COAssertNoNullOrReturn(self,EINVAL,NULL);
 	COAssertNoNullOrReturn(class,EINVAL,NULL);
@@ -72,6 +91,12 @@ void * Object_constructor (void * _self, va_list * app) {
 	return self;
 }
 
+void * Object_initializer (void * _self, const void *const arguments) {
+	struct Object *self = _self;
+	MEMORY_MANAGEMENT_ATTRIBUTE_SET_DEALLOC_FUNCTION(self, delete);
+	return self;
+}
+
 void * Object_destructor (void * _self) {
 	return _self;
 }
@@ -129,7 +154,7 @@ StringRef Object_copyDescription (const void * const _self) {
 const char *getClassName(const void *const self) {
 	COAssertNoNullOrReturn(self,EINVAL,NULL);
 	
-	const struct Classs *class = classOf(self);
+	const struct Classs *class = classOf(COResolveClass(self));
 	COAssertNoNullOrReturn(class,EINVAL,NULL);
 	return class->class_name;
 }
@@ -198,11 +223,11 @@ bool instanceOf (const void * const self, const void *const _class) {
 	COAssertNoNullOrReturn(self,EINVAL,-1);
 	COAssertNoNullOrReturn(_class,EINVAL,-1);
 	
-	const struct Classs *class = classOf(self);
+	const struct Classs *class = classOf(COResolveClass(self));
 	COAssertNoNullOrReturn(class,EINVAL,-1);
 	
 	/* Get the type */
-	const struct Classs *const mclass = _class;
+	const struct Classs *const mclass = COResolveClass(_class);
 	return ( strcmp(class->class_name, mclass->class_name) == 0 );
 }
 
@@ -216,7 +241,7 @@ bool isSubclassOf (const void *const self, const void * const _class) {
 UInteger sizeOf(const void *const self) {
 	COAssertNoNullOrReturn(self,EINVAL,0);
 	
-	const struct Classs *const class = classOf(self);
+	const struct Classs *const class = classOf(COResolveClass(self));
 	COAssertNoNullOrReturn(class,EINVAL,0);
 	
 	return class->size;
@@ -233,7 +258,7 @@ const void * classOf(const void * const _self) {
 const void * superclass (const void *const _class) {
 	COAssertNoNullOrReturn(_class,EINVAL,NULL);
 	
-	const struct Classs * self = _class;
+	const struct Classs * self = COResolveClass(_class);
 	COAssertNoNullOrReturn(self->super,EINVAL,NULL);
 	
 	return self->super;
@@ -242,7 +267,7 @@ const void * superclass (const void *const _class) {
 const void * super(const void *const _self) {
 	COAssertNoNullOrReturn(_self,EINVAL,NULL);
 	
-	const struct Classs * self = classOf(_self);
+	const struct Classs * self = classOf(COResolveClass(_self));
 	COAssertNoNullOrReturn(self,EINVAL,NULL);
 	COAssertNoNullOrReturn(self->super,ENOTSUP,NULL);
 	
@@ -7,8 +7,25 @@
 //
 
 #include <stdio.h>
+#include <pthread.h>
 #include <cobj.h>
 #include <memory_management/memory_management.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+static StringRef newAutoreleasedString(const char *text) {
+	StringRef string = new(String, text, NULL);
+	return autoreleaseReturnValue(string);
+}
+
+/* Parks its argument and exits without claiming it */
+static void *parkAndExit(void *string) {
+	autoreleaseReturnValue(string);
+	return NULL;
+}
 
 int main () {
 	COBJ_MAIN_BEGIN()
@@ -16,6 +33,44 @@ int main () {
 	AutoreleasePoolRef autoreleasePool2 = new(AutoreleasePool, NULL);
 	StringRef string = new(String, "Test String", NULL);
 	autorelease(string);
+	
+	{	/* The caller claims the return value right away: the pool is bypassed */
+		UInteger elided = AutoreleasePoolGetElidedReturnValueCount();
+		StringRef returned = retainAutoreleasedReturnValue(newAutoreleasedString("claimed"));
+		assert( returned != NULL );
+		assert( retainCount(returned) == 1 );
+		assert( AutoreleasePoolGetElidedReturnValueCount() == elided + 1 );
+		release(returned);
+	}
+	
+	{	/* A second hand-off flushes the first one into the pool */
+		UInteger elided = AutoreleasePoolGetElidedReturnValueCount();
+		StringRef first = newAutoreleasedString("first");
+		StringRef second = newAutoreleasedString("second");
+		StringRef claimed = retainAutoreleasedReturnValue(first);
+		assert( retainCount(claimed) == 2 );
+		assert( AutoreleasePoolGetElidedReturnValueCount() == elided );
+		release(claimed);
+		assert( getStringLength(second) == 6 );
+	}
+	
+	{	/* A pending return value outlives an inner pool */
+		StringRef pending = newAutoreleasedString("pending");
+		AutoreleasePoolRef inner = new(AutoreleasePool, NULL);
+		release(inner);
+		assert( retainCount(pending) == 1 );
+	}
+	
+	{	/* A value never claimed is released when its thread exits */
+		StringRef parked = new(String, "parked", NULL);
+		retain(parked);
+		pthread_t thread;
+		int created = pthread_create(&thread, NULL, parkAndExit, (void *)parked);
+		assert( created == 0 );
+		pthread_join(thread, NULL);
+		assert( retainCount(parked) == 1 );
+		release(parked);
+	}
 	COBJ_MAIN_END()
 	return 0;
 }
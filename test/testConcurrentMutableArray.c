@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <string.h>
+#include <errno.h>
 #include <cobj.h>
 #if DEBUG
 #include <assert.h>
@@ -26,6 +27,14 @@ struct _args {
 
 static void * threadFunction(void *args);
 
+/* Drains the first array of the pair into the second, over and over */
+static void * drainFunction(void *arrays) {
+	ConcurrentMutableArrayRef *pair = arrays;
+	for (int i=0; i<20000; i++)
+		drainObjectsIntoArray(pair[0], pair[1], 3);
+	return NULL;
+}
+
 int main () {
 	{	/* Testing allocation and waiting getObject with an addObject */
 		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
@@ -99,6 +108,14 @@ int main () {
 		release(thread);
 	}
 	
+	{	/* An index past the first of an empty array fails without waiting */
+		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
+		errno = 0;
+		StringRef missing = getObjectAtIndex(array, 5);
+		assert( missing == NULL && errno == EINVAL );
+		release(array);
+	}
+	
 	{	/* insertObjectAtIndex */
 		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
 		
@@ -149,6 +166,78 @@ int main () {
 		release(array);
 	}
 	
+	{	/* popObjectWaiting */
+		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
+		
+		errno = 0;
+		StringRef none = popObjectWaiting(array, 0);
+		assert( none == NULL );
+		assert( errno == ETIMEDOUT );
+		errno = 0;
+		none = popObjectWaiting(array, 10);
+		assert( none == NULL );
+		assert( errno == ETIMEDOUT );
+		
+		Args.array = array;
+		Args.function = (voidf)addObject;
+		ThreadRef thread = new(Thread, threadFunction, array, NULL);
+		startThread(thread);
+		
+		StringRef s1 = popObjectWaiting(array, -1);
+		assert( s1 != NULL );
+		assert( strcmp(getStringText(s1), "string 1") == 0 );
+		assert( getCollectionCount(array) == 0 );
+		
+		joinThread(thread, NULL);
+		release(s1), release(thread), release(array);
+	}
+	
+	{	/* drainObjectsIntoArray */
+		ConcurrentMutableArrayRef array = new(ConcurrentMutableArray, NULL);
+		MutableArrayRef batch = new(MutableArray, NULL);
+		
+		for (int i=0; i<10; i++) {
+			StringRef s = newStringWithFormat(String, "string %2d", i, NULL);
+			addObject(array, s);
+			release(s);
+		}
+		
+		UInteger drained = drainObjectsIntoArray(array, batch, 4);
+		assert( drained == 4 );
+		assert( getCollectionCount(array) == 6 );
+		assert( getCollectionCount(batch) == 4 );
+		assert( strcmp(getStringText(getObjectAtIndex(batch, 0)), "string  0") == 0 );
+		assert( strcmp(getStringText(getObjectAtIndex(batch, 3)), "string  3") == 0 );
+		
+		drained = drainObjectsIntoArray(array, batch, 100);
+		assert( drained == 6 );
+		assert( getCollectionCount(array) == 0 );
+		assert( getCollectionCount(batch) == 10 );
+		assert( strcmp(getStringText(getObjectAtIndex(batch, 9)), "string  9") == 0 );
+		drained = drainObjectsIntoArray(array, batch, 100);
+		assert( drained == 0 );
+		
+		release(batch), release(array);
+	}
+	
+	{	/* Two arrays drained into each other from two threads */
+		ConcurrentMutableArrayRef first = new(ConcurrentMutableArray, NULL), second = new(ConcurrentMutableArray, NULL);
+		for (int i=0; i<10; i++) {
+			StringRef s = newStringWithFormat(String, "string %2d", i, NULL);
+			addObject(first, s);
+			addObject(second, s);
+			release(s);
+		}
+		ConcurrentMutableArrayRef forth[2] = { first, second }, back[2] = { second, first };
+		pthread_t forthThread, backThread;
+		pthread_create(&forthThread, NULL, drainFunction, forth);
+		pthread_create(&backThread, NULL, drainFunction, back);
+		pthread_join(forthThread, NULL);
+		pthread_join(backThread, NULL);
+		assert( getCollectionCount(first) + getCollectionCount(second) == 20 );
+		release(second), release(first);
+	}
+	
 	return 0;
 }
 
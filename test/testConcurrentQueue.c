@@ -0,0 +1,165 @@
+//
+//  testConcurrentQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+#include <unistd.h>
+#include <errno.h>
+
+#include <cobj.h>
+
+#define OBJECTS 64
+#define HANDOFFS 20000UL
+
+static StringRef objects[OBJECTS];
+static UInteger consumed;
+
+void * producer(void *queue);
+void * consumer(void *queue);
+
+int main () {
+	for (UInteger i=0; i<OBJECTS; i++)
+		objects[i] = newStringWithFormat(String, "object %lu", i, NULL);
+	
+	/* Test creation */
+	{
+		ConcurrentQueueRef queue = new(ConcurrentQueue, 5UL, NULL);
+		assert( queue != NULL );
+		assert( getQueueCapacity(queue) == 8 );
+		assert( getQueueCount(queue) == 0 );
+		ObjectRef none = tryDequeueObject(queue);
+		assert( none == NULL );
+		release(queue);
+		
+		errno = 0;
+		ConcurrentQueueRef tooLarge = new(ConcurrentQueue, UIntegerMax, NULL);
+		assert( tooLarge == NULL && errno == EINVAL );
+		
+		/* Rounded up fine by Queue, too large for the cells */
+		errno = 0;
+		ConcurrentQueueRef tooManyCells = new(ConcurrentQueue, UIntegerMax / 2 + 1, NULL);
+		assert( tooManyCells == NULL && errno == EINVAL );
+	}
+	
+	/* Test FIFO order, full queue and ownership */
+	{
+		ConcurrentQueueRef queue = new(ConcurrentQueue, 4UL, NULL);
+		UInteger retainCountBefore = retainCount(objects[0]);
+		for (UInteger i=0; i<4; i++) {
+			bool enqueued = tryEnqueueObject(queue, objects[i]);
+			assert( enqueued );
+		}
+		bool enqueued = tryEnqueueObject(queue, objects[4]);
+		assert( ! enqueued );
+		assert( getQueueCount(queue) == 4 );
+		assert( retainCount(objects[0]) == retainCountBefore + 1 );
+		
+		for (UInteger i=0; i<4; i++) {
+			ObjectRef object = tryDequeueObject(queue);
+			assert( object == objects[i] );
+			release(object);
+		}
+		ObjectRef none = tryDequeueObject(queue);
+		assert( none == NULL );
+		assert( retainCount(objects[0]) == retainCountBefore );
+		
+		/* Wrap around */
+		for (UInteger round=0; round<10; round++) {
+			enqueued = tryEnqueueObject(queue, objects[round]);
+			assert( enqueued );
+			ObjectRef object = tryDequeueObject(queue);
+			assert( object == objects[round] );
+			release(object);
+		}
+		
+		/* Objects left in the queue are released with it */
+		enqueued = tryEnqueueObject(queue, objects[0]);
+		assert( enqueued );
+		release(queue);
+		assert( retainCount(objects[0]) == retainCountBefore );
+	}
+	
+	/* Test batches */
+	{
+		ConcurrentQueueRef queue = new(ConcurrentQueue, 8UL, NULL);
+		UInteger enqueued = tryEnqueueObjects(queue, (void **)objects, 10);
+		assert( enqueued == 8 );
+		ObjectRef dequeued[OBJECTS];
+		UInteger dequeuedCount = tryDequeueObjects(queue, dequeued, 3);
+		assert( dequeuedCount == 3 );
+		assert( dequeued[0] == objects[0] && dequeued[2] == objects[2] );
+		dequeuedCount = tryDequeueObjects(queue, dequeued + 3, OBJECTS);
+		assert( dequeuedCount == 5 );
+		for (UInteger i=0; i<8; i++) {
+			assert( dequeued[i] == objects[i] );
+			release(dequeued[i]);
+		}
+		release(queue);
+	}
+	
+	/* Test blocking hand-off through a tiny queue, in order */
+	{
+		ConcurrentQueueRef queue = new(ConcurrentQueue, 2UL, NULL);
+		ThreadRef thread = new(Thread, producer, queue, NULL);
+		startThread(thread);
+		for (UInteger i=0; i<HANDOFFS; i++) {
+			ObjectRef object = dequeueObject(queue);
+			assert( object == objects[i % OBJECTS] );
+			release(object);
+		}
+		joinThread(thread, NULL);
+		assert( getQueueCount(queue) == 0 );
+		release(thread);
+		release(queue);
+	}
+	
+	/* Test many producers and consumers */
+	{
+		ConcurrentQueueRef queue = new(ConcurrentQueue, 16UL, NULL);
+		ThreadRef threads[8];
+		consumed = 0;
+		for (UInteger i=0; i<4; i++) {
+			threads[2*i] = new(Thread, producer, queue, NULL);
+			threads[2*i+1] = new(Thread, consumer, queue, NULL);
+			startThread(threads[2*i]);
+			startThread(threads[2*i+1]);
+		}
+		for (UInteger i=0; i<8; i++)
+			joinThread(threads[i], NULL), release(threads[i]);
+		assert( consumed == 4 * HANDOFFS );
+		assert( getQueueCount(queue) == 0 );
+		release(queue);
+	}
+	
+	for (UInteger i=0; i<OBJECTS; i++) {
+		assert( retainCount(objects[i]) == 1 );
+		release(objects[i]);
+	}
+	return 0;
+}
+
+void * producer(void *queue) {
+	for (UInteger i=0; i<HANDOFFS; i++)
+		enqueueObject(queue, objects[i % OBJECTS]);
+	return NULL;
+}
+
+void * consumer(void *queue) {
+	for (UInteger i=0; i<HANDOFFS; i++) {
+		ObjectRef object = dequeueObject(queue);
+		assert( object != NULL );
+		release(object);
+		__atomic_fetch_add(&consumed, 1, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
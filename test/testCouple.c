@@ -36,6 +36,20 @@ int main () {
 		release(couple);
 	}
 
+	/* Test typed creation */
+	{
+		CoupleRef couple = newWithArguments(Couple, &(CoupleArguments){ k2, v2 });
+		CoupleRef other = new(Couple, k2, v2, NULL);
+		
+		assert( couple != NULL );
+		assert( getKey(couple) == k2 );
+		assert( getValue(couple) == v2 );
+		assert( equals(couple, other) );
+		
+		release(couple);
+		release(other);
+	}
+
 	/* Test equals */
 	{
 		CoupleRef couple1 = new(Couple, k1, v1, NULL);
@@ -25,5 +25,24 @@ int main () {
 		
 		release(strings);
 	}
+	
+	{	/* Past the first batch of 16, in order, whatever the kind of array */
+		ObjectRef arrays[] = { new(MutableArray, NULL), new(Vector, 0UL, 0UL, NULL), new(ConcurrentMutableArray, NULL), new(ReadMostlyMutableArray, NULL) };
+		for (UInteger a=0; a<sizeof(arrays)/sizeof(arrays[0]); a++) {
+			StringRef strings[40];
+			for (UInteger i=0; i<40; i++) {
+				strings[i] = newStringWithFormat(String, "string %lu", i);
+				addObject(arrays[a], strings[i]);
+				release(strings[i]);
+			}
+			UInteger enumerated = 0;
+			foreach_start(StringRef, string, arrays[a]) {
+				assert( string == strings[enumerated] );
+				enumerated++;
+			} foreach_end()
+			assert( enumerated == 40 );
+			release(arrays[a]);
+		}
+	}
 	return EXIT_SUCCESS;
 }
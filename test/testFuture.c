@@ -0,0 +1,166 @@
+//
+//  testFuture.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <sched.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+#define CONTINUATIONS 1000UL
+
+static UInteger Counter = 0;
+
+static void count(FutureRef future, void *argument) {
+	assert( isFutureReady(future) );
+	__atomic_add_fetch(&Counter, 1, __ATOMIC_RELAXED);
+}
+
+static void * fulfillLater(void *argument) {
+	sched_yield();
+	fulfillPromise(argument, argument);
+	return NULL;
+}
+
+int main () {
+	StringRef string = new(String, "value", NULL);
+	
+	{	/* fulfill and get */
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = getPromiseFuture(promise);
+		assert( ! isFutureReady(future) );
+		errno = 0;
+		assert( getFutureValue(future, 0) == NULL );
+		assert( errno == ETIMEDOUT );
+		assert( getFutureValue(future, 10) == NULL );
+		assert( errno == ETIMEDOUT );
+		
+		bool fulfilled = fulfillPromise(promise, string);
+		assert( fulfilled );
+		assert( isFutureReady(future) );
+		assert( getFutureValue(future, 0) == string );
+		assert( getFutureValue(future, -1) == string );
+		assert( getFutureError(future) == 0 );
+		errno = 0;
+		fulfilled = fulfillPromise(promise, string);
+		assert( ! fulfilled );
+		assert( errno == EALREADY );
+		release(promise);
+		assert( retainCount(string) == 1 );
+	}
+	
+	{	/* fulfilled from another thread */
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = retain(getPromiseFuture(promise));
+		ThreadRef thread = new(Thread, fulfillLater, promise, NULL);
+		startThread(thread);
+		assert( getFutureValue(future, -1) == promise );
+		joinThread(thread, NULL);
+		release(thread), release(promise), release(future);
+	}
+	
+	{	/* failure */
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = getPromiseFuture(promise);
+		errno = 0;
+		bool failed = failPromise(promise, 0);
+		assert( ! failed );
+		assert( errno == EINVAL );
+		failed = failPromise(promise, ERANGE);
+		assert( failed );
+		errno = 0;
+		assert( getFutureValue(future, -1) == NULL );
+		assert( errno == ERANGE );
+		assert( getFutureError(future) == ERANGE );
+		release(promise);
+	}
+	
+	{	/* a released promise breaks its future */
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = retain(getPromiseFuture(promise));
+		release(promise);
+		assert( isFutureReady(future) );
+		assert( getFutureError(future) == ECANCELED );
+		release(future);
+	}
+	
+	{	/* continuations, before and after completion */
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = getPromiseFuture(promise);
+		Counter = 0;
+		thenFuture(future, count, NULL, NULL);
+		thenFuture(future, count, NULL, NULL);
+		assert( Counter == 0 );
+		fulfillPromise(promise, string);
+		assert( Counter == 2 );
+		thenFuture(future, count, NULL, NULL);
+		assert( Counter == 3 );
+		release(promise);
+	}
+	
+	{	/* continuations on a pool */
+		ThreadPoolRef pool = new(ThreadPool, 2UL, NULL);
+		PromiseRef promise = new(Promise, NULL);
+		FutureRef future = getPromiseFuture(promise);
+		Counter = 0;
+		for (UInteger i=0; i<CONTINUATIONS; i++)
+			thenFuture(future, count, NULL, pool);
+		fulfillPromise(promise, string);
+		release(promise);
+		waitForTasks(pool);
+		assert( Counter == CONTINUATIONS );
+		release(pool);
+	}
+	
+	{	/* when all */
+		PromiseRef first = new(Promise, NULL), second = new(Promise, NULL);
+		ArrayRef futures = new(Array, getPromiseFuture(first), getPromiseFuture(second), NULL);
+		FutureRef all = newFutureWhenAll(futures);
+		fulfillPromise(second, string);
+		assert( ! isFutureReady(all) );
+		fulfillPromise(first, string);
+		assert( getFutureValue(all, 0) == futures );
+		release(all), release(futures), release(first), release(second);
+		
+		first = new(Promise, NULL), second = new(Promise, NULL);
+		futures = new(Array, getPromiseFuture(first), getPromiseFuture(second), NULL);
+		all = newFutureWhenAll(futures);
+		failPromise(first, EIO);
+		assert( getFutureError(all) == EIO );
+		release(all), release(futures), release(first), release(second);
+		
+		MutableArrayRef empty = new(MutableArray, NULL);
+		all = newFutureWhenAll(empty);
+		assert( getFutureValue(all, 0) == empty );
+		release(all);
+		errno = 0;
+		FutureRef any = newFutureWhenAny(empty);
+		assert( any == NULL );
+		assert( errno == EINVAL );
+		release(empty);
+	}
+	
+	{	/* when any */
+		PromiseRef first = new(Promise, NULL), second = new(Promise, NULL);
+		ArrayRef futures = new(Array, getPromiseFuture(first), getPromiseFuture(second), NULL);
+		FutureRef any = newFutureWhenAny(futures);
+		assert( ! isFutureReady(any) );
+		fulfillPromise(second, string);
+		assert( getFutureValue(any, 0) == getPromiseFuture(second) );
+		fulfillPromise(first, string);
+		assert( getFutureValue(any, 0) == getPromiseFuture(second) );
+		release(any), release(futures), release(first), release(second);
+	}
+	
+	assert( retainCount(string) == 1 );
+	release(string);
+	return 0;
+}
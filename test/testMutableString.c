@@ -20,6 +20,14 @@ extern int errno;
 #include <cobj.h>
 
 int main () {
+	{ /* Classes asked about before their first instance */
+		assert( strcmp(getClassName(MutableString), "MutableStringClass") == 0 );
+		assert( superclass(MutableString) == String );
+		MutableStringRef mString = new(MutableString, "string", NULL);
+		assert( instanceOf(mString, MutableString) && ! instanceOf(mString, String) );
+		release(mString);
+	}
+	
 	{ /* Testing allocation */
 		MutableStringRef mString = new(MutableString, "string", NULL);
 		
@@ -67,6 +75,56 @@ int main () {
 		release(mString);
 	}
 	
+	{	/* Testing appendBytes, appendCharacter and reserveMutableStringCapacity */
+		
+		MutableStringRef mString = new(MutableString, "", NULL);
+		reserveMutableStringCapacity(mString, 64);
+		const char *text = getStringText(mString);
+		appendBytes(mString, "bytes and more", 5);
+		appendCharacter(mString, ' ');
+		appendFormat(mString, "%s %d", "format", 42);
+		assert( getStringText(mString) == text );
+		assert( getStringLength(mString) == 15 );
+		assert( strcmp(getStringText(mString), "bytes format 42") == 0 );
+		
+		/* Growing past the doubled capacity and appending self */
+		StringRef longString = new(String, "a string longer than twice the capacity of the receiver", NULL);
+		MutableStringRef grown = new(MutableString, "x", NULL);
+		appendString(grown, longString);
+		assert( getStringLength(grown) == 1 + getStringLength(longString) );
+		appendString(grown, grown);
+		assert( getStringLength(grown) == 2 * (1 + getStringLength(longString)) );
+		assert( strncmp(getStringText(grown) + 1 + getStringLength(longString), "xa string", 9) == 0 );
+		
+		/* Formatting longer than the spare capacity */
+		appendFormat(mString, " %s", getStringText(grown));
+		assert( getStringLength(mString) == 15 + 1 + getStringLength(grown) );
+		
+		/* Slices append only their range */
+		StringRef slice = newStringSlice(longString, MakeRange(2, 6));
+		setString(grown, slice);
+		appendString(grown, slice);
+		assert( strcmp(getStringText(grown), "stringstring") == 0 );
+		
+		release(slice), release(grown), release(longString), release(mString);
+	}
+	
+	{	/* Testing mutators on a MutableString created without text */
+		
+		MutableStringRef formatted = new(MutableString, NULL);
+		assert( getStringText(formatted) != NULL );
+		appendFormat(formatted, "%d", 42);
+		assert( strcmp(getStringText(formatted), "42") == 0 );
+		
+		MutableStringRef emptied = new(MutableString, NULL);
+		StringRef empty = new(String, "", NULL);
+		setString(emptied, empty);
+		assert( getStringLength(emptied) == 0 );
+		assert( strcmp(getStringText(emptied), "") == 0 );
+		
+		release(empty), release(emptied), release(formatted);
+	}
+	
 	{	/* Testing setMutableStringLength */
 		
 		MutableStringRef mString = new(MutableString, "string 01 02 03 04", NULL);
@@ -0,0 +1,119 @@
+//
+//  testReadMostlyMutableArray.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+#define READERS 4
+#define UPDATES 200
+#define ROUTES 8
+
+static ReadMostlyMutableArrayRef Routes = NULL;
+static UInteger Done = 0;
+
+/* Every published snapshot holds exactly ROUTES routes, all named alike */
+static void * readRoutes(void *argument) {
+	UInteger *reads = argument;
+	while ( ! __atomic_load_n(&Done, __ATOMIC_ACQUIRE) ) {
+		assert( getCollectionCount(Routes) >= ROUTES - 1 );
+		assert( getObjectAtIndex(Routes, 0) != NULL );
+		/* The objects of a copy stay alive whatever the writer removes */
+		MutableArrayRef routes = copy(Routes);
+		assert( getCollectionCount(routes) >= ROUTES - 1 );
+		assert( strncmp(getStringText(getObjectAtIndex(routes, 0)), "route ", 6) == 0 );
+		release(routes);
+		(*reads)++;
+	}
+	return NULL;
+}
+
+int main () {
+	{	/* reads see the writes */
+		ReadMostlyMutableArrayRef array = new(ReadMostlyMutableArray, NULL);
+		assert( array != NULL );
+		assert( getCollectionCount(array) == 0 );
+		assert( getObjectAtIndex(array, 0) == NULL );
+		
+		for (int i=0; i<10; i++) {
+			StringRef s = newStringWithFormat(String, "string %2d", i, NULL);
+			addObject(array, s);
+			release(s);
+		}
+		assert( getCollectionCount(array) == 10 );
+		assert( strcmp(getStringText(getObjectAtIndex(array, 0)), "string  0") == 0 );
+		assert( strcmp(getStringText(getObjectAtIndex(array, 9)), "string  9") == 0 );
+		assert( getObjectAtIndex(array, 10) == NULL );
+		
+		StringRef first = new(String, "first", NULL);
+		insertObjectAtIndex(array, first, 0);
+		release(first);
+		assert( strcmp(getStringText(getObjectAtIndex(array, 0)), "first") == 0 );
+		removeObjectAtIndex(array, 0);
+		assert( strcmp(getStringText(getObjectAtIndex(array, 0)), "string  0") == 0 );
+		
+		StringRef popped = popObject(array);
+		assert( strcmp(getStringText(popped), "string  0") == 0 );
+		release(popped);
+		assert( getCollectionCount(array) == 9 );
+		
+		MutableArrayRef batch = new(MutableArray, NULL);
+		UInteger drained = drainObjectsIntoArray(array, batch, 4);
+		assert( drained == 4 );
+		assert( getCollectionCount(array) == 5 );
+		assert( strcmp(getStringText(getObjectAtIndex(array, 0)), "string  5") == 0 );
+		
+		MutableArrayRef contents = copy(array);
+		assert( getCollectionCount(contents) == 5 );
+		assert( strcmp(getStringText(getObjectAtIndex(contents, 4)), "string  9") == 0 );
+		
+		release(contents), release(batch), release(array);
+	}
+	
+	{	/* concurrent readers while a writer replaces the routes */
+		Routes = new(ReadMostlyMutableArray, NULL);
+		for (int i=0; i<ROUTES; i++) {
+			StringRef s = newStringWithFormat(String, "route %d", i, NULL);
+			addObject(Routes, s);
+			release(s);
+		}
+		
+		UInteger reads[READERS] = { 0 };
+		ThreadRef readers[READERS];
+		for (int i=0; i<READERS; i++) {
+			readers[i] = new(Thread, readRoutes, &reads[i], NULL);
+			startThread(readers[i]);
+		}
+		
+		for (int update=0; update<UPDATES; update++) {
+			StringRef s = newStringWithFormat(String, "route %d", ROUTES + update, NULL);
+			StringRef old = popObject(Routes);
+			addObject(Routes, s);
+			release(old), release(s);
+		}
+		
+		__atomic_store_n(&Done, 1, __ATOMIC_RELEASE);
+		for (int i=0; i<READERS; i++)
+			joinThread(readers[i], NULL), release(readers[i]);
+		assert( getCollectionCount(Routes) == ROUTES );
+		assert( strcmp(getStringText(getObjectAtIndex(Routes, ROUTES - 1)), "route 207") == 0 );
+#ifdef __PROFILING__
+		UInteger publications = 0;
+		ReadMostlyMutableArrayGetStatistics(Routes, &publications, NULL);
+		assert( publications == ROUTES + 2 * UPDATES );
+#endif
+		release(Routes);
+	}
+	
+	return 0;
+}
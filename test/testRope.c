@@ -0,0 +1,163 @@
+//
+//  testRope.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+/* The text of the rope, a chunk at a time */
+static bool ropeHasText(const void *const rope, const char *const text, UInteger length) {
+	RopeChunks chunks = MakeRopeChunks(rope);
+	const char *chunk;
+	UInteger chunkLength, location = 0;
+	while ( nextRopeChunk(&chunks, &chunk, &chunkLength) ) {
+		if ( chunkLength == 0 || location + chunkLength > length || memcmp(chunk, text + location, chunkLength) != 0 ) return NO;
+		location += chunkLength;
+	}
+	return location == length && getStringLength(rope) == length;
+}
+
+int main () {
+	{ /* Creation and materialization */
+		RopeRef rope = new(Rope, "hello world", NULL);
+		assert( rope != NULL );
+		assert( getStringLength(rope) == 11 );
+		assert( strcmp(getStringText(rope), "hello world") == 0 );
+		assert( ropeHasText(rope, "hello world", 11) );
+		StringRef string = copyRopeAsString(rope);
+		assert( classOf(string) == String );
+		assert( equals(string, rope) && equals(rope, string) );
+		assert( hash(string) == hash(rope) );
+		assert( compare(rope, string) == SSame );
+		release(string);
+		release(rope);
+
+		rope = newWithArguments(Rope, &(StringArguments){ "ab\0cd", 5 });
+		assert( getStringLength(rope) == 5 && memcmp(getStringText(rope), "ab\0cd", 5) == 0 );
+		release(rope);
+
+		rope = new(Rope, NULL);
+		assert( getStringLength(rope) == 0 && getRopeChunkCount(rope) == 0 );
+		assert( strcmp(getStringText(rope), "") == 0 );
+		release(rope);
+	}
+
+	{ /* Editing */
+		RopeRef rope = new(Rope, "The cat sat", NULL);
+		StringRef big = new(String, "mat", NULL);
+		insertStringAtMutableStringIndex(rope, big, 11);
+		assert( strcmp(getStringText(rope), "The cat satmat") == 0 );
+		StringRef space = new(String, " on the ", NULL);
+		insertStringAtMutableStringIndex(rope, space, 11);
+		assert( strcmp(getStringText(rope), "The cat sat on the mat") == 0 );
+		int edited = deleteMutableStringCharactersInRange(rope, MakeRange(0, 4));
+		assert( edited == 0 );
+		assert( strcmp(getStringText(rope), "cat sat on the mat") == 0 );
+		appendCharacter(rope, '.');
+		appendFormat(rope, " %d times", 3);
+		appendBytes(rope, "!!", 2);
+		assert( strcmp(getStringText(rope), "cat sat on the mat. 3 times!!") == 0 );
+		char character = '\0';
+		assert( characterAtIndex(rope, &character, 4) == 0 && character == 's' );
+		assert( characterAtIndex(rope, &character, 29) == -1 );
+		edited = insertStringAtMutableStringIndex(rope, space, 30);
+		assert( edited == -1 );
+		edited = deleteMutableStringCharactersInRange(rope, MakeRange(20, 10));
+		assert( edited == -1 );
+		setMutableStringLength(rope, 18);
+		assert( strcmp(getStringText(rope), "cat sat on the mat") == 0 );
+		setString(rope, big);
+		assert( strcmp(getStringText(rope), "mat") == 0 );
+		release(space), release(big), release(rope);
+	}
+
+	{ /* Long Strings and slices become chunks without being copied, and copies share them */
+		char text[2000];
+		for (UInteger i=0; i<sizeof(text); i++) text[i] = (char)('a' + i % 26);
+		StringRef string = newWithArguments(String, &(StringArguments){ text, sizeof(text) });
+		StringRef slice = newStringSlice(string, MakeRange(100, 1000));
+		RopeRef rope = new(Rope, "<>", NULL);
+		insertStringAtMutableStringIndex(rope, string, 1);
+		insertStringAtMutableStringIndex(rope, slice, 1);
+		assert( getRopeChunkCount(rope) == 4 );
+		RopeChunks chunks = MakeRopeChunks(rope);
+		const char *chunk;
+		UInteger length;
+		bool next = nextRopeChunk(&chunks, &chunk, &length);
+		assert( next && length == 1 && *chunk == '<' );
+		next = nextRopeChunk(&chunks, &chunk, &length);
+		assert( next && chunk == getStringText(string) + 100 && length == 1000 );
+		next = nextRopeChunk(&chunks, &chunk, &length);
+		assert( next && chunk == getStringText(string) && length == 2000 );
+		next = nextRopeChunk(&chunks, &chunk, &length);
+		assert( next && length == 1 && *chunk == '>' );
+		next = nextRopeChunk(&chunks, &chunk, &length);
+		assert( ! next );
+
+		RopeRef ropeCopy = copy(rope);
+		assert( classOf(ropeCopy) == Rope && equals(ropeCopy, rope) );
+		deleteMutableStringCharactersInRange(ropeCopy, MakeRange(500, 1000));
+		assert( getStringLength(rope) == 3002 && getStringLength(ropeCopy) == 2002 );
+		StringRef appended = copyStringByAppendingString(rope, slice);
+		assert( getStringLength(appended) == 4002 && getStringLength(rope) == 3002 );
+		release(appended), release(ropeCopy), release(rope), release(slice), release(string);
+	}
+
+	{ /* Random edits agree with a flat buffer, and typing does not split the text a character at a time */
+		enum { Capacity = 1 << 16 };
+		char *expected = malloc(Capacity), insertion[700];
+		UInteger length = 0;
+		RopeRef rope = new(Rope, "", NULL);
+		srand(49);
+		for (UInteger round=0; round<20000; round++) {
+			UInteger location = length ? (UInteger)rand() % (length + 1) : 0;
+			if ( rand() % 3 || length == 0 ) {
+				UInteger insertionLength = 1 + (rand() % 8 == 0 ? (UInteger)rand() % 699 : (UInteger)rand() % 8);
+				if ( length + insertionLength >= Capacity ) continue;
+				for (UInteger i=0; i<insertionLength; i++) insertion[i] = (char)('A' + rand() % 58);
+				StringRef string = newWithArguments(String, &(StringArguments){ insertion, insertionLength });
+				int inserted = insertStringAtMutableStringIndex(rope, string, location);
+				assert( inserted == 0 );
+				release(string);
+				memmove(expected + location + insertionLength, expected + location, length - location);
+				memcpy(expected + location, insertion, insertionLength);
+				length += insertionLength;
+			}
+			else {
+				UInteger deletionLength = (UInteger)rand() % (rand() % 8 == 0 ? 2000 : 16);
+				if ( deletionLength > length - location ) deletionLength = length - location;
+				int deleted = deleteMutableStringCharactersInRange(rope, MakeRange(location, deletionLength));
+				assert( deleted == 0 );
+				memmove(expected + location, expected + location + deletionLength, length - location - deletionLength);
+				length -= deletionLength;
+			}
+			if ( round % 1000 == 0 ) {
+				assert( ropeHasText(rope, expected, length) );
+				assert( memcmp(getStringText(rope), expected, length) == 0 && getStringText(rope)[length] == '\0' );
+			}
+		}
+		assert( ropeHasText(rope, expected, length) );
+		char character = '\0';
+		for (UInteger i=0; i<length; i+=97)
+			assert( characterAtIndex(rope, &character, i) == 0 && character == expected[i] );
+		char *buffer = malloc(length + 1);
+		assert( getCharactersInRange(rope, buffer, MakeRange(0, length)) == 0 && memcmp(buffer, expected, length) == 0 );
+		assert( getRopeChunkCount(rope) < length / 16 );
+		free(buffer);
+		free(expected);
+		release(rope);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+//
+//  testSPSCQueue.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+#include <unistd.h>
+#include <errno.h>
+#include <sched.h>
+
+#include <cobj.h>
+
+#define OBJECTS 64
+#define HANDOFFS 100000UL
+
+static StringRef objects[OBJECTS];
+
+void * producer(void *queue);
+void * batchProducer(void *queue);
+
+int main () {
+	for (UInteger i=0; i<OBJECTS; i++)
+		objects[i] = newStringWithFormat(String, "object %lu", i, NULL);
+	
+	/* Test creation */
+	{
+		SPSCQueueRef queue = new(SPSCQueue, 3UL, NULL);
+		assert( queue != NULL );
+		assert( getQueueCapacity(queue) == 4 );
+		assert( getQueueCount(queue) == 0 );
+		ObjectRef none = tryDequeueObject(queue);
+		assert( none == NULL );
+		release(queue);
+		
+		errno = 0;
+		SPSCQueueRef tooLarge = new(SPSCQueue, UIntegerMax, NULL);
+		assert( tooLarge == NULL && errno == EINVAL );
+		
+		/* Rounded up fine by Queue, too large for the slots */
+		errno = 0;
+		SPSCQueueRef tooManySlots = new(SPSCQueue, UIntegerMax / 2 + 1, NULL);
+		assert( tooManySlots == NULL && errno == EINVAL );
+	}
+	
+	/* Test FIFO order, full queue, wrap around and ownership */
+	{
+		SPSCQueueRef queue = new(SPSCQueue, 4UL, NULL);
+		UInteger retainCountBefore = retainCount(objects[0]);
+		for (UInteger i=0; i<4; i++) {
+			bool enqueued = tryEnqueueObject(queue, objects[i]);
+			assert( enqueued );
+		}
+		bool enqueued = tryEnqueueObject(queue, objects[4]);
+		assert( ! enqueued );
+		assert( getQueueCount(queue) == 4 );
+		assert( retainCount(objects[0]) == retainCountBefore + 1 );
+		
+		for (UInteger round=0; round<10; round++) {
+			ObjectRef object = tryDequeueObject(queue);
+			assert( object == objects[round] );
+			release(object);
+			enqueued = tryEnqueueObject(queue, objects[round + 4]);
+			assert( enqueued );
+		}
+		assert( getQueueCount(queue) == 4 );
+		
+		/* Objects left in the queue are released with it */
+		release(queue);
+		assert( retainCount(objects[0]) == retainCountBefore );
+		assert( retainCount(objects[13]) == retainCountBefore );
+	}
+	
+	/* Test batches */
+	{
+		SPSCQueueRef queue = new(SPSCQueue, 8UL, NULL);
+		UInteger enqueued = tryEnqueueObjects(queue, (void **)objects, 5);
+		assert( enqueued == 5 );
+		enqueued = tryEnqueueObjects(queue, (void **)objects + 5, 10);
+		assert( enqueued == 3 );
+		ObjectRef dequeued[OBJECTS];
+		UInteger dequeuedCount = tryDequeueObjects(queue, dequeued, 3);
+		assert( dequeuedCount == 3 );
+		dequeuedCount = tryDequeueObjects(queue, dequeued + 3, OBJECTS);
+		assert( dequeuedCount == 5 );
+		for (UInteger i=0; i<8; i++) {
+			assert( dequeued[i] == objects[i] );
+			release(dequeued[i]);
+		}
+		dequeuedCount = tryDequeueObjects(queue, dequeued, OBJECTS);
+		assert( dequeuedCount == 0 );
+		release(queue);
+	}
+	
+	/* Test blocking hand-off between two threads, in order */
+	{
+		SPSCQueueRef queue = new(SPSCQueue, 16UL, NULL);
+		ThreadRef thread = new(Thread, producer, queue, NULL);
+		startThread(thread);
+		for (UInteger i=0; i<HANDOFFS; i++) {
+			ObjectRef object = dequeueObject(queue);
+			assert( object == objects[i % OBJECTS] );
+			release(object);
+		}
+		joinThread(thread, NULL);
+		release(thread);
+		release(queue);
+	}
+	
+	/* Test batch hand-off between two threads, in order */
+	{
+		SPSCQueueRef queue = new(SPSCQueue, 32UL, NULL);
+		ThreadRef thread = new(Thread, batchProducer, queue, NULL);
+		startThread(thread);
+		ObjectRef dequeued[OBJECTS];
+		UInteger received = 0;
+		while ( received < HANDOFFS ) {
+			UInteger count = tryDequeueObjects(queue, dequeued, OBJECTS);
+			for (UInteger i=0; i<count; i++, received++) {
+				assert( dequeued[i] == objects[received % OBJECTS] );
+				release(dequeued[i]);
+			}
+			if ( count == 0 )
+				sched_yield();
+		}
+		joinThread(thread, NULL);
+		release(thread);
+		release(queue);
+	}
+	
+	for (UInteger i=0; i<OBJECTS; i++) {
+		assert( retainCount(objects[i]) == 1 );
+		release(objects[i]);
+	}
+	return 0;
+}
+
+void * producer(void *queue) {
+	for (UInteger i=0; i<HANDOFFS; i++)
+		enqueueObject(queue, objects[i % OBJECTS]);
+	return NULL;
+}
+
+void * batchProducer(void *queue) {
+	UInteger sent = 0;
+	while ( sent < HANDOFFS ) {
+		UInteger offset = sent % OBJECTS;
+		UInteger count = OBJECTS - offset;
+		if ( count > HANDOFFS - sent )
+			count = HANDOFFS - sent;
+		UInteger enqueued = tryEnqueueObjects(queue, (void **)objects + offset, count);
+		sent += enqueued;
+		if ( enqueued == 0 )
+			sched_yield();
+	}
+	return NULL;
+}
@@ -10,6 +10,9 @@
 #include <stdlib.h>
 #include <cobj.h>
 #include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <pthread.h>
 
 #if DEBUG
 #if DEBUG
@@ -21,6 +24,38 @@
 #define assert(e)
 #endif /* DEBUG */
 
+#define INTERNING_THREADS 4
+#define INTERNED_TEXTS 1000
+
+/* Interns the same texts as the other threads, returns them in the order of the texts */
+static void * internTexts(void *interned) {
+	char text[32];
+	for (UInteger i=0; i<INTERNED_TEXTS; i++) {
+		int length = snprintf(text, sizeof(text), "key number %lu of the table", i);
+		((StringRef *)interned)[i] = internStringWithText(text, (UInteger)length);
+	}
+	return interned;
+}
+
+/* Well formed UTF-8 by the table of RFC 3629, one sequence at a time */
+static bool isValidUTF8Naively(const unsigned char *text, UInteger length) {
+	for (UInteger i=0; i<length; ) {
+		unsigned char lead = text[i];
+		UInteger count = lead < 0x80 ? 1 : (lead >= 0xC2 && lead <= 0xDF) ? 2 : (lead >= 0xE0 && lead <= 0xEF) ? 3 : (lead >= 0xF0 && lead <= 0xF4) ? 4 : 0;
+		if ( count == 0 || i + count > length ) return NO;
+		unsigned char low = 0x80, high = 0xBF;
+		if ( lead == 0xE0 ) low = 0xA0;
+		else if ( lead == 0xED ) high = 0x9F;
+		else if ( lead == 0xF0 ) low = 0x90;
+		else if ( lead == 0xF4 ) high = 0x8F;
+		for (UInteger k=1; k<count; k++) {
+			if ( text[i + k] < (k == 1 ? low : 0x80) || text[i + k] > (k == 1 ? high : 0xBF) ) return NO;
+		}
+		i += count;
+	}
+	return YES;
+}
+
 int main(int argc, const char * argv[])
 {
 	void * string1 = new(String, "my precious string", NULL);
@@ -65,6 +100,18 @@ int main(int argc, const char * argv[])
 		release(l2);
 	}
 
+	{
+		StringRef typed = newWithArguments(String, &(StringArguments){ "my precious string", StringArgumentsNullTerminated });
+		StringRef prefix = newWithArguments(String, &(StringArguments){ "This is 2 and more", 9 });
+		assert( typed != NULL && prefix != NULL );
+		assert( equals(typed, string1) );
+		assert( equals(prefix, string2) );
+		assert( hash(typed) == hash(string1) );
+		assert( getStringLength(prefix) == 9 );
+		release(typed);
+		release(prefix);
+	}
+
 	{
 		StringRef k1 = new(String, "Georges", NULL);
 		StringRef k2 = new(String, "Romain", NULL);
@@ -99,6 +146,294 @@ int main(int argc, const char * argv[])
 		release(whiteString);
 	}
 
+	{	/* short texts are stored inline, transparently */
+		const char *shortText = "twenty-three characters";
+		const char *longText = "twenty-four characters!!";
+		StringRef shortString = new(String, shortText, NULL);
+		StringRef longString = new(String, longText, NULL);
+		StringRef shortCopy = newWithArguments(String, &(StringArguments){ longText, 23 });
+		assert( getStringLength(shortString) == 23 && getStringLength(longString) == 24 );
+		assert( (const char *)getStringText(shortString) > (const char *)shortString );
+		assert( (const char *)getStringText(shortString) < (const char *)shortString + 128 );
+		assert( strcmp(getStringText(longString), longText) == 0 );
+		assert( strncmp(getStringText(shortCopy), longText, 23) == 0 && getStringText(shortCopy)[23] == '\0' );
+		
+		StringRef copied = copy(shortString);
+		assert( equals(copied, shortString) && hash(copied) == hash(shortString) );
+		assert( getStringText(copied) != getStringText(shortString) );
+		release(copied);
+		
+		StringRef empty = newWithArguments(String, &(StringArguments){ "", 0 });
+		assert( getStringLength(empty) == 0 );
+		release(empty);
+		
+		/* A length of 0 is an empty substring, not the rest of the text */
+		StringRef emptySubstring = newWithArguments(String, &(StringArguments){ longText + 3, 0 });
+		assert( getStringLength(emptySubstring) == 0 && strcmp(getStringText(emptySubstring), "") == 0 );
+		release(emptySubstring);
+		
+		MutableStringRef mutable = new(MutableString, "short", NULL);
+		assert( getStringLength(mutable) == 5 && strcmp(getStringText(mutable), "short") == 0 );
+		release(mutable);
+		release(shortCopy), release(longString), release(shortString);
+	}
+
+	{	/* formatting, short on the stack and long straight into the String, and the typed fast paths */
+		assert( getStringLength(formatedString) == 2 + getStringLength(string1) + 1 + getStringLength(bigString) );
+		assert( strncmp(getStringText(formatedString), "0 my precious string my", 23) == 0 );
+		
+		StringRef formatted = newStringWithFormat(String, "%s-%d", "short", 42, NULL);
+		assert( strcmp(getStringText(formatted), "short-42") == 0 && getStringLength(formatted) == 8 );
+		release(formatted);
+		MutableStringRef mutable = newStringWithFormat(MutableString, "%s", getStringText(bigString), NULL);
+		assert( classOf(mutable) == MutableString && equals(mutable, bigString) );
+		appendCharacter(mutable, '!');
+		release(mutable);
+		
+		StringRef integer = newStringWithInteger(String, -1234567890L);
+		assert( strcmp(getStringText(integer), "-1234567890") == 0 && getStringLength(integer) == 11 );
+		release(integer);
+		integer = newStringWithInteger(String, IntegerMin);
+		char expected[32];
+		snprintf(expected, sizeof(expected), "%ld", IntegerMin);
+		assert( strcmp(getStringText(integer), expected) == 0 );
+		release(integer);
+		integer = newStringWithInteger(MutableString, 0);
+		assert( classOf(integer) == MutableString && strcmp(getStringText(integer), "0") == 0 );
+		release(integer);
+		
+		const double values[] = { 0.0, 3.14159, -2.71828, 1e6 + 0.3, -0.001, 123456.789 };
+		for (UInteger i=0; i<sizeof(values)/sizeof(values[0]); i++) {
+			for (UInteger decimals=0; decimals<4; decimals++) {
+				StringRef number = newStringWithDouble(String, values[i], decimals);
+				snprintf(expected, sizeof(expected), "%.*f", (int)decimals, values[i]);
+				assert( strcmp(getStringText(number), expected) == 0 );
+				release(number);
+			}
+		}
+		StringRef large = newStringWithDouble(String, 1e300, 2);
+		assert( getStringLength(large) == 301 + 3 );
+		release(large);
+		
+		StringRef joined = newStringWithStrings(String, string2, string1, string2, NULL);
+		assert( strcmp(getStringText(joined), "This is 2my precious stringThis is 2") == 0 );
+		assert( getStringLength(joined) == 2 * getStringLength(string2) + getStringLength(string1) );
+		release(joined);
+	}
+
+	{	/* searching */
+		StringRef haystack = new(String, "The cat sat on the mat with another cat", NULL);
+		StringRef cat = new(String, "cat", NULL);
+		StringRef the = new(String, "THE", NULL);
+		StringRef dog = new(String, "dog", NULL);
+		
+		Range found = rangeOfString(haystack, cat);
+		assert( found.location == 4 && found.length == 3 );
+		found = rangeOfStringWithOptions(haystack, cat, SStringComparingOptionBackwardsSearch);
+		assert( found.location == 36 && found.length == 3 );
+		assert( rangeOfString(haystack, dog).location == NotFound );
+		assert( rangeOfString(haystack, the).location == NotFound );
+		assert( rangeOfStringWithOptions(haystack, the, SStringComparingOptionCaseInsensitiveSearch).location == 0 );
+		assert( rangeOfStringWithOptions(haystack, the, SStringComparingOptionCaseInsensitiveSearch | SStringComparingOptionBackwardsSearch).location == 31 );
+		assert( rangeOfStringWithOptions(haystack, cat, SStringComparingOptionAnchoredSearch).location == NotFound );
+		assert( rangeOfStringWithOptions(haystack, cat, SStringComparingOptionAnchoredSearch | SStringComparingOptionBackwardsSearch).location == 36 );
+		assert( rangeOfStringWithOptionsInRange(haystack, cat, 0, MakeRange(5, 20)).location == NotFound );
+		assert( rangeOfStringWithOptionsInRange(haystack, cat, 0, MakeRange(4, 3)).location == 4 );
+		
+		/* A slice is searched within its length only */
+		StringRef slice = newStringSlice(haystack, MakeRange(0, 6));
+		assert( rangeOfString(slice, cat).location == NotFound );
+		release(slice);
+		
+		UInteger locations[] = { 4, 36 }, count = 0;
+		StringSearch search = MakeStringSearch(haystack, cat, 0);
+		for (Range range = nextRangeOfString(&search); range.location != NotFound; range = nextRangeOfString(&search), count++)
+			assert( range.location == locations[count] );
+		assert( count == 2 );
+		search = MakeStringSearch(haystack, cat, SStringComparingOptionBackwardsSearch);
+		for (Range range = nextRangeOfString(&search); range.location != NotFound; range = nextRangeOfString(&search), count--)
+			assert( range.location == locations[count - 1] );
+		assert( count == 0 );
+		
+		release(dog), release(the), release(cat), release(haystack);
+	}
+	
+	{	/* searching agrees with a naive search on every needle length and filter block boundary */
+		char text[600], pattern[120];
+		srand(42);
+		for (UInteger round=0; round<2000; round++) {
+			UInteger textLength = 1 + (UInteger)rand() % 599, patternLength = 1 + (UInteger)rand() % 119;
+			for (UInteger i=0; i<textLength; i++) text[i] = "abAB"[rand() % 4];
+			for (UInteger i=0; i<patternLength; i++) pattern[i] = "ab"[rand() % 2];
+			if ( patternLength <= textLength && rand() % 2 ) /* plant it */
+				memcpy(text + (UInteger)rand() % (textLength - patternLength + 1), pattern, patternLength);
+			StringRef haystack = newWithArguments(String, &(StringArguments){ text, textLength });
+			StringRef needle = newWithArguments(String, &(StringArguments){ pattern, patternLength });
+			
+			UInteger first = NotFound, last = NotFound, firstIgnoringCase = NotFound, lastIgnoringCase = NotFound;
+			for (UInteger i=0; i + patternLength <= textLength; i++) {
+				if ( memcmp(text + i, pattern, patternLength) == 0 )
+					last = i, first = (first == NotFound) ? i : first;
+				if ( strncasecmp(text + i, pattern, patternLength) == 0 )
+					lastIgnoringCase = i, firstIgnoringCase = (firstIgnoringCase == NotFound) ? i : firstIgnoringCase;
+			}
+			assert( rangeOfString(haystack, needle).location == first );
+			assert( rangeOfStringWithOptions(haystack, needle, SStringComparingOptionBackwardsSearch).location == last );
+			assert( rangeOfStringWithOptions(haystack, needle, SStringComparingOptionCaseInsensitiveSearch).location == firstIgnoringCase );
+			assert( rangeOfStringWithOptions(haystack, needle, SStringComparingOptionCaseInsensitiveSearch | SStringComparingOptionBackwardsSearch).location == lastIgnoringCase );
+			release(needle), release(haystack);
+		}
+	}
+
+	{ /* Interning */
+		StringInternStatistics before = getStringInternStatistics();
+		StringRef first = new(String, "an interned key", NULL);
+		StringRef second = newWithArguments(String, &(StringArguments){ "an interned key and more", 15 });
+		StringRef interned = internString(first);
+		assert(interned != first);
+		StringRef internedAgain = internString(second);
+		assert(internedAgain == interned);
+		internedAgain = internString(interned);
+		assert(internedAgain == interned);
+		internedAgain = internStringWithText("an interned key", 15);
+		assert(internedAgain == interned);
+		assert(equals(interned, first) && equals(first, interned));
+		assert(hash(interned) == hash(first));
+		/* Immortal */
+		StringRef retained = retain(interned);
+		assert(retained == interned);
+		release(interned), release(interned), release(interned);
+		StringRef copied = copy(interned);
+		assert(copied == interned);
+		assert(strcmp(getStringText(interned), "an interned key") == 0);
+
+		StringRef other = internStringWithText("another interned key, longer than the inline text", 50);
+		assert(! equals(interned, other));
+		assert(getStringLength(other) == 50);
+		StringRef empty = internStringWithText("", 0);
+		StringRef emptyString = new(String, "", NULL);
+		internedAgain = internString(emptyString);
+		assert(getStringLength(empty) == 0 && internedAgain == empty);
+		release(emptyString);
+
+		/* A slice is interned by its text */
+		StringRef slice = newStringSlice(second, MakeRange(0, 15));
+		internedAgain = internString(slice);
+		assert(internedAgain == interned);
+		release(slice);
+
+		StringInternStatistics after = getStringInternStatistics();
+		assert(after.count == before.count + 3);
+		assert(after.lookups == before.lookups + 7);
+		assert(after.hits == before.hits + 4);
+		assert(after.bytes > before.bytes && after.tableBytes >= after.count * sizeof(StringRef));
+		release(second), release(first);
+
+		/* Threads interning the same texts get the same Strings */
+		StringRef strings[INTERNING_THREADS][INTERNED_TEXTS];
+		pthread_t threads[INTERNING_THREADS];
+		for (UInteger t=0; t<INTERNING_THREADS; t++)
+			pthread_create(threads + t, NULL, internTexts, strings[t]);
+		for (UInteger t=0; t<INTERNING_THREADS; t++)
+			pthread_join(threads[t], NULL);
+		for (UInteger i=0; i<INTERNED_TEXTS; i++)
+			for (UInteger t=1; t<INTERNING_THREADS; t++)
+				assert(strings[t][i] == strings[0][i]);
+		assert(getStringInternStatistics().count == after.count + INTERNED_TEXTS);
+	}
+
+	{ /* Equality and comparison go by the lengths, null bytes included, and differing hashes tell texts apart */
+		StringRef abc = newWithArguments(String, &(StringArguments){ "a\0bc", 4 });
+		StringRef abd = newWithArguments(String, &(StringArguments){ "a\0bd", 4 });
+		StringRef ABC = newWithArguments(String, &(StringArguments){ "A\0BC", 4 });
+		assert( ! equals(abc, abd) );
+		assert( compare(abc, abd) == SAscending && compare(abd, abc) == SDescending );
+		assert( compareWithOptions(abc, ABC, SStringComparingOptionCaseInsensitiveSearch) == SSame );
+		assert( compareWithOptions(abd, ABC, SStringComparingOptionCaseInsensitiveSearch) == SDescending );
+		hash(abc), hash(abd);
+		StringRef abcCopy = copy(abc);
+		assert( equals(abc, abcCopy) );
+		release(abcCopy), release(ABC), release(abd), release(abc);
+
+		/* A MutableString forgets its hash when edited */
+		MutableStringRef mutable = new(MutableString, "key-1", NULL);
+		StringRef key = new(String, "key-12", NULL);
+		hash(mutable), hash(key);
+		appendCharacter(mutable, '2');
+		assert( equals(mutable, key) && equals(key, mutable) && hash(mutable) == hash(key) );
+		release(key), release(mutable);
+
+		StringRef empty = new(String, NULL), emptyText = new(String, "", NULL);
+		assert( equals(empty, emptyText) );
+		release(emptyText), release(empty);
+	}
+
+	{	/* the case-insensitive comparison agrees with strncasecmp on every block boundary */
+		char text[200], other[200];
+		srand(50);
+		for (UInteger round=0; round<20000; round++) {
+			UInteger length = (UInteger)rand() % 200;
+			for (UInteger i=0; i<length; i++) text[i] = "aAzZ@[`{09"[rand() % 10];
+			for (UInteger i=0; i<length; i++) other[i] = rand() % 8 ? (char)(text[i] ^ (isalpha(text[i]) ? 0x20 : 0)) : "aAzZ@[`{09"[rand() % 10];
+			StringRef string = newWithArguments(String, &(StringArguments){ text, length });
+			StringRef otherString = newWithArguments(String, &(StringArguments){ other, length });
+			int expected = strncasecmp(text, other, length);
+			SComparisonResult result = compareWithOptions(string, otherString, SStringComparingOptionCaseInsensitiveSearch);
+			assert( result == (expected < 0 ? SAscending : expected > 0 ? SDescending : SSame) );
+			release(otherString), release(string);
+		}
+	}
+
+	{ /* UTF-8 */
+		const char *greek = "καλημέρα κόσμε, 𐍆 and ascii";
+		StringRef string = newStringWithUTF8Text(String, greek, strlen(greek));
+		assert( string != NULL && isStringValidUTF8(string) );
+		assert( getStringUTF8Length(string) == 27 );
+		Range range = rangeOfUTF8CharacterAtIndex(string, 1);
+		assert( range.location == 2 && range.length == 2 );
+		range = rangeOfUTF8CharacterAtIndex(string, 16);
+		assert( range.location == 29 && range.length == 4 );
+		assert( memcmp(getStringText(string) + range.location, "𐍆", 4) == 0 );
+		range = rangeOfUTF8CharacterAtIndex(string, 27);
+		assert( range.location == NotFound && errno == EINVAL );
+		release(string);
+
+		/* Overlong, surrogate, past U+10FFFF and truncated */
+		const char *malformed[] = { "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "abc\xE2\x82" };
+		for (UInteger i=0; i<sizeof(malformed)/sizeof(malformed[0]); i++) {
+			errno = 0;
+			string = newStringWithUTF8Text(String, malformed[i], strlen(malformed[i]));
+			assert( string == NULL && errno == EILSEQ );
+			string = new(String, malformed[i], NULL);
+			assert( ! isStringValidUTF8(string) );
+			assert( getStringUTF8Length(string) == NotFound && errno == EILSEQ );
+			release(string);
+		}
+
+		/* The vectorized validation agrees with the table on every block boundary */
+		const char *sequences[] = { "a", "\xCE\xBB", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF", "\xF4\x8F\xBF\xBF" };
+		unsigned char text[300];
+		srand(8);
+		for (UInteger round=0; round<20000; round++) {
+			UInteger length = 0, target = (UInteger)rand() % 290;
+			while ( length < target ) {
+				const char *sequence = sequences[rand() % 6];
+				memcpy(text + length, sequence, strlen(sequence)), length += strlen(sequence);
+			}
+			if ( length && rand() % 4 ) /* break it, or not */
+				text[(UInteger)rand() % length] = (unsigned char)rand();
+			string = newWithArguments(String, &(StringArguments){ (const char *)text, length });
+			bool valid = isValidUTF8Naively(text, length);
+			assert( isStringValidUTF8(string) == valid );
+			if ( valid ) {
+				UInteger count = 0;
+				for (UInteger i=0; i<length; i++) count += (text[i] & 0xC0) != 0x80;
+				assert( getStringUTF8Length(string) == count );
+			}
+			release(string);
+		}
+	}
+
 	release(bigString);
 	release(formatedString);
 	release(concat);
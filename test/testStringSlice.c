@@ -0,0 +1,143 @@
+//
+//  testStringSlice.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+int main(int argc, const char * argv[])
+{
+	StringRef parent = new(String, "the quick brown fox jumps over the lazy dog", NULL);
+
+	{ /* A slice shares the text of its parent and retains it */
+		UInteger parentRetainCount = retainCount(parent);
+		StringRef quick = newStringSlice(parent, MakeRange(4, 5));
+		assert( quick != NULL );
+		assert( retainCount(parent) == parentRetainCount + 1 );
+		assert( getStringSliceParent(quick) == parent );
+		assert( getStringLength(quick) == 5 );
+		assert( getStringText(quick) == getStringText(parent) + 4 );
+		assert( strncmp(getStringText(quick), "quick", 5) == 0 );
+
+		char character = 0;
+		assert( characterAtIndex(quick, &character, 4) == 0 && character == 'k' );
+		assert( characterAtIndex(quick, &character, 5) == -1 );
+		char characters[3];
+		assert( getCharactersInRange(quick, characters, MakeRange(1, 3)) == 0 );
+		assert( memcmp(characters, "uic", 3) == 0 );
+
+		release(quick);
+		assert( retainCount(parent) == parentRetainCount );
+	}
+
+	{ /* Ranges past the end of the parent are refused */
+		errno = 0;
+		StringRef outOfRange = newStringSlice(parent, MakeRange(40, 10));
+		assert( outOfRange == NULL );
+		assert( errno == EINVAL );
+	}
+
+	{ /* Equality, hash and comparison are those of a String with the same text */
+		StringRef brown = newStringSlice(parent, MakeRange(10, 5));
+		StringRef string = new(String, "brown", NULL);
+		assert( equals(brown, string) && equals(string, brown) );
+		assert( hash(brown) == hash(string) );
+		assert( compare(brown, string) == SSame );
+
+		StringRef brow = newStringSlice(parent, MakeRange(10, 4));
+		assert( ! equals(brow, string) && ! equals(string, brow) );
+		assert( compare(brow, string) == SAscending );
+		assert( compare(string, brow) == SDescending );
+		assert( compareWithOptions(brow, brown, SStringComparingOptionCaseInsensitiveSearch) == SAscending );
+		assert( compareWithOptions(brown, string, SStringComparingOptionLocalizedCompare) == SSame );
+
+		release(brow);
+		release(string);
+		release(brown);
+	}
+
+	{ /* A slice of a slice shares the text of the first parent */
+		StringRef fox = newStringSlice(parent, MakeRange(16, 9));
+		StringRef jumps = newStringSlice(fox, MakeRange(4, 5));
+		assert( getStringSliceParent(jumps) == parent );
+		assert( getStringSliceRange(jumps).location == 20 );
+		assert( strncmp(getStringText(jumps), "jumps", 5) == 0 );
+		release(fox);
+		assert( getStringLength(jumps) == 5 );
+		release(jumps);
+	}
+
+	{ /* A mutable parent is copied, the slice does not change with it */
+		MutableStringRef mutable = new(MutableString, "mutable text", NULL);
+		StringRef text = newStringSlice(mutable, MakeRange(8, 4));
+		assert( getStringSliceParent(text) != (StringRef)mutable );
+		assert( classOf(getStringSliceParent(text)) == String );
+		StringRef expected = new(String, "text", NULL);
+		assert( equals(text, expected) );
+		release(mutable);
+		assert( equals(text, expected) );
+		release(expected);
+		release(text);
+	}
+
+	{ /* A copy is a String of its own */
+		StringRef lazy = newStringSlice(parent, MakeRange(35, 4));
+		UInteger parentRetainCount = retainCount(parent);
+		StringRef copied = copy(lazy);
+		assert( classOf(copied) == String );
+		assert( retainCount(parent) == parentRetainCount );
+		assert( strcmp(getStringText(copied), "lazy") == 0 );
+		assert( equals(copied, lazy) );
+
+		StringRef appended = copyStringByAppendingString(lazy, copied);
+		assert( strcmp(getStringText(appended), "lazylazy") == 0 );
+		release(appended);
+		release(copied);
+		release(lazy);
+	}
+
+	{ /* Slices and Strings find each other as dictionary keys */
+		MutableDictionaryRef dictionary = new(MutableDictionary, NULL);
+		StringRef dog = newStringSlice(parent, MakeRange(40, 3));
+		StringRef fox = new(String, "fox", NULL);
+		StringRef value = new(String, "value", NULL);
+		setObjectForKey(dictionary, value, dog);
+		setObjectForKey(dictionary, value, fox);
+
+		StringRef key = new(String, "dog", NULL);
+		assert( objectForKey(dictionary, key) == value );
+		StringRef slice = newStringSlice(parent, MakeRange(16, 3));
+		assert( objectForKey(dictionary, slice) == value );
+		release(slice);
+		release(key);
+		release(value);
+		release(fox);
+		release(dog);
+		release(dictionary);
+	}
+
+	{ /* An empty slice */
+		StringRef empty = newStringSlice(parent, MakeRange(43, 0));
+		StringRef string = new(String, "", NULL);
+		assert( getStringLength(empty) == 0 );
+		assert( equals(empty, string) );
+		assert( compare(empty, string) == SSame );
+		release(string);
+		release(empty);
+	}
+
+	release(parent);
+	return EXIT_SUCCESS;
+}
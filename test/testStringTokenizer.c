@@ -0,0 +1,172 @@
+//
+//  testStringTokenizer.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cobj.h>
+
+static bool componentIs(const void *const components, UInteger index, const char *text) {
+	StringRef component = getObjectAtIndex(components, index);
+	return getStringLength(component) == strlen(text) && memcmp(getStringText(component), text, strlen(text)) == 0;
+}
+
+int main () {
+	{ /* componentsSeparatedByString, empty fields included */
+		StringRef line = new(String, "GET, /index.html, , 200, ", NULL);
+		StringRef separator = new(String, ", ", NULL);
+		VectorRef components = componentsSeparatedByString(line, separator);
+		assert(getCollectionCount(components) == 5);
+		assert(componentIs(components, 0, "GET"));
+		assert(componentIs(components, 1, "/index.html"));
+		assert(componentIs(components, 2, ""));
+		assert(componentIs(components, 3, "200"));
+		assert(componentIs(components, 4, ""));
+		/* Zero-copy */
+		StringRef second = getObjectAtIndex(components, 1);
+		assert(classOf(second) == StringSlice);
+		assert(getStringSliceParent(second) == line);
+		assert(getStringText(second) == getStringText(line) + 5);
+		release(components);
+		release(separator);
+		release(line);
+	}
+
+	{ /* A single field when the separator does not occur or is empty */
+		StringRef line = new(String, "no separator here", NULL);
+		StringRef separator = new(String, ";", NULL);
+		StringRef empty = new(String, "", NULL);
+		VectorRef components = componentsSeparatedByString(line, separator);
+		assert(getCollectionCount(components) == 1 && componentIs(components, 0, "no separator here"));
+		release(components);
+		components = componentsSeparatedByString(line, empty);
+		assert(getCollectionCount(components) == 1 && componentIs(components, 0, "no separator here"));
+		release(components);
+		components = componentsSeparatedByString(empty, separator);
+		assert(getCollectionCount(components) == 1 && componentIs(components, 0, ""));
+		release(components);
+		release(empty);
+		release(separator);
+		release(line);
+	}
+
+	{ /* componentsSeparatedByCharacters, of a slice and of a MutableString */
+		StringRef line = new(String, "[a b\tc:d]", NULL);
+		StringRef slice = newStringSlice(line, MakeRange(1, 7));
+		VectorRef components = componentsSeparatedByCharacters(slice, " \t:");
+		assert(getCollectionCount(components) == 4);
+		assert(componentIs(components, 0, "a") && componentIs(components, 1, "b"));
+		assert(componentIs(components, 2, "c") && componentIs(components, 3, "d"));
+		assert(getStringSliceParent(getObjectAtIndex(components, 3)) == line);
+		release(components);
+
+		MutableStringRef mutable = new(MutableString, "x;y", NULL);
+		components = componentsSeparatedByCharacters(mutable, ";");
+		appendBytes(mutable, ";z", 2);
+		assert(getCollectionCount(components) == 2);
+		assert(componentIs(components, 0, "x") && componentIs(components, 1, "y"));
+		release(components);
+		release(mutable);
+		release(slice);
+		release(line);
+	}
+
+	{ /* The tokenizer yields the components without building them, across several batches */
+		MutableStringRef text = new(MutableString, "", NULL);
+		for (UInteger i=0; i<100; i++)
+			appendFormat(text, i ? "|%lu" : "%lu", i * 7);
+		appendBytes(text, "||", 2);
+		StringRef separator = new(String, "|", NULL);
+		VectorRef components = componentsSeparatedByString(text, separator);
+		StringTokenizerRef tokenizer = newStringTokenizer(text, separator);
+		assert(getCollectionCount(tokenizer) == 102);
+		assert(getCollectionCount(components) == 102);
+
+		UInteger index = 0;
+		StringRef kept = NULL;
+		foreach_start(StringRef, field, tokenizer) {
+			assert(classOf(field) == StringSlice);
+			assert(equals(field, getObjectAtIndex(components, index)));
+			if ( index == 3 ) kept = retain(field);
+			index++;
+		} foreach_end()
+		assert(index == 102);
+		/* A retained field is left alone */
+		assert(getStringLength(kept) == 2 && memcmp(getStringText(kept), "21", 2) == 0);
+		release(kept);
+
+		/* Enumerated again */
+		index = 0;
+		foreach_start(StringRef, field, tokenizer) {
+			assert(equals(field, getObjectAtIndex(components, index)));
+			index++;
+		} foreach_end()
+		assert(index == 102);
+		release(tokenizer);
+		release(components);
+		release(separator);
+		release(text);
+	}
+
+	{ /* A tokenizer of characters */
+		StringRef text = new(String, "a,b;;c", NULL);
+		StringTokenizerRef tokenizer = newStringTokenizerWithCharacters(text, ",;");
+		const char *expected[] = { "a", "b", "", "c" };
+		UInteger index = 0;
+		foreach_start(StringRef, field, tokenizer) {
+			assert(getStringLength(field) == strlen(expected[index]));
+			assert(memcmp(getStringText(field), expected[index], getStringLength(field)) == 0);
+			index++;
+		} foreach_end()
+		assert(index == 4);
+		release(tokenizer);
+		release(text);
+	}
+
+	{ /* componentsJoinedByString, the inverse of componentsSeparatedByString */
+		StringRef line = new(String, "one::two::::three", NULL);
+		StringRef separator = new(String, "::", NULL);
+		VectorRef components = componentsSeparatedByString(line, separator);
+		StringRef joined = componentsJoinedByString(components, separator);
+		assert(equals(joined, line));
+		release(joined);
+		joined = componentsJoinedByString(components, NULL);
+		assert(strcmp(getStringText(joined), "onetwothree") == 0);
+		release(joined);
+		release(components);
+
+		MutableArrayRef list = new(MutableArray, NULL);
+		StringRef one = new(String, "one", NULL), two = new(String, "two", NULL);
+		addObject(list, one), addObject(list, two), addObject(list, one);
+		joined = componentsJoinedByString(list, separator);
+		assert(strcmp(getStringText(joined), "one::two::one") == 0);
+		release(joined);
+		release(two), release(one), release(list);
+
+		/* More components than one batch of fast enumeration */
+		MutableArrayRef many = new(MutableArray, NULL);
+		for (UInteger i=0; i<20; i++) {
+			StringRef digit = newStringWithFormat(String, "%lu", i % 10);
+			addObject(many, digit);
+			release(digit);
+		}
+		joined = componentsJoinedByString(many, NULL);
+		assert(strcmp(getStringText(joined), "01234567890123456789") == 0);
+		release(joined);
+		release(many);
+
+		MutableArrayRef empty = new(MutableArray, NULL);
+		joined = componentsJoinedByString(empty, separator);
+		assert(getStringLength(joined) == 0 && strcmp(getStringText(joined), "") == 0);
+		release(joined);
+		release(empty);
+		release(separator);
+		release(line);
+	}
+	return EXIT_SUCCESS;
+}
@@ -6,8 +6,12 @@
 //  Copyright (c) 2013 George Boumis. All rights reserved.
 //
 
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sched.h>
 #if DEBUG
 #include <assert.h>
 #else
@@ -19,6 +23,17 @@
 
 void * threadFunction(void *args);
 void * threadFunctionArgument(void *args);
+void * threadFunctionAttributes(void *args);
+void * threadFunctionDetached(void *args);
+
+struct ObservedAttributes {
+	char name[THREAD_NAME_LENGTH];
+	size_t stackSize;
+	int processorCount;
+	bool onlyFirstProcessor;
+};
+
+static int DetachedRan = 0;
 
 int main () {
 	/* Test creation */
@@ -57,6 +72,77 @@ int main () {
 		release(threadString);
 		release(thread);
 	}
+	
+	/* Test attributes */
+	{
+		ThreadAttributes attributes;
+		memset(&attributes, 0, sizeof(attributes));
+		attributes.name = "a long worker name";
+		attributes.stackSize = 1024 * 1024;
+		attributes.explicitScheduling = YES;
+		attributes.schedulingPolicy = SCHED_OTHER;
+		attributes.schedulingPriority = 0;
+		ThreadAttributesAddProcessor(&attributes, 0);
+		
+		struct ObservedAttributes observed;
+		memset(&observed, 0, sizeof(observed));
+		ThreadArguments arguments = { threadFunctionAttributes, &observed, &attributes };
+		ThreadRef thread = newWithArguments(Thread, &arguments);
+		assert( thread != NULL );
+		startThread(thread);
+		joinThread(thread, NULL);
+		assert( strcmp(observed.name, "a long worker n") == 0 );
+		assert( observed.stackSize >= 1024 * 1024 );
+		assert( observed.processorCount == 1 && observed.onlyFirstProcessor );
+		release(thread);
+		
+		/* an impossible stack size is reported */
+		attributes.stackSize = 1;
+		thread = newWithArguments(Thread, &arguments);
+		errno = 0;
+		startThread(thread);
+		assert( errno == EINVAL );
+		joinThread(thread, NULL);
+		assert( errno == EINVAL );
+		release(thread);
+	}
+	
+	/* Test detached threads */
+	{
+		ThreadAttributes attributes;
+		memset(&attributes, 0, sizeof(attributes));
+		attributes.detached = YES;
+		ThreadArguments arguments = { threadFunctionDetached, NULL, &attributes };
+		ThreadRef thread = newWithArguments(Thread, &arguments);
+		startThread(thread);
+		errno = 0;
+		joinThread(thread, NULL);
+		assert( errno == EINVAL );
+		release(thread);
+		while ( ! __atomic_load_n(&DetachedRan, __ATOMIC_ACQUIRE) )
+			sched_yield();
+	}
+	
+	/* Test pinning a group of threads */
+	{
+		struct ObservedAttributes first, second;
+		memset(&first, 0, sizeof(first)), memset(&second, 0, sizeof(second));
+		ThreadRef thread1 = new(Thread, threadFunctionAttributes, &first, NULL);
+		ThreadRef thread2 = new(Thread, threadFunctionAttributes, &second, NULL);
+		ArrayRef threads = new(Array, thread1, thread2, NULL);
+		bool pinned = pinThreadsToProcessors(threads, 0);
+		assert( pinned );
+		startThread(thread1), startThread(thread2);
+		joinThread(thread1, NULL), joinThread(thread2, NULL);
+		assert( first.processorCount == 1 && first.onlyFirstProcessor );
+		assert( second.processorCount == 1 );
+		
+		/* processors beyond the affinity range are refused */
+		pinned = pinThreadToProcessor(thread1, THREAD_AFFINITY_PROCESSORS);
+		assert( pinned == NO );
+		assert( errno == EINVAL );
+		release(threads), release(thread1), release(thread2);
+	}
 	return 0;
 }
 
@@ -72,3 +158,22 @@ void * threadFunctionArgument(void *args) {
 	release(string);
 	pthread_exit(string);
 }
+
+void * threadFunctionAttributes(void *args) {
+	struct ObservedAttributes *observed = args;
+	pthread_getname_np(pthread_self(), observed->name, THREAD_NAME_LENGTH);
+	pthread_attr_t attributes;
+	pthread_getattr_np(pthread_self(), &attributes);
+	pthread_attr_getstacksize(&attributes, &(observed->stackSize));
+	pthread_attr_destroy(&attributes);
+	cpu_set_t set;
+	pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+	observed->processorCount = CPU_COUNT(&set);
+	observed->onlyFirstProcessor = CPU_ISSET(0, &set) && observed->processorCount == 1;
+	return NULL;
+}
+
+void * threadFunctionDetached(void *args) {
+	__atomic_store_n(&DetachedRan, 1, __ATOMIC_RELEASE);
+	return NULL;
+}
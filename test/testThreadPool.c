@@ -0,0 +1,218 @@
+//
+//  testThreadPool.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+#define TASKS 10000UL
+#define CHILDREN 16UL
+
+static UInteger Counter = 0;
+static ThreadPoolRef Pool = NULL;
+
+static void count(void *argument) {
+	__atomic_add_fetch(&Counter, 1, __ATOMIC_RELAXED);
+}
+
+static void spawn(void *argument) {
+	count(argument);
+	for (UInteger i=0; i<CHILDREN; i++) {
+		bool submitted = submitTask(Pool, count, NULL);
+		assert( submitted );
+	}
+}
+
+static void autoreleaseArgument(void *argument) {
+	autorelease(retain(argument));
+}
+
+#define ELEMENTS 100000UL
+
+static UInteger Visits[ELEMENTS];
+
+static void visit(const void *const collection, Range range, void *context) {
+	for (UInteger i=range.location; i<MaxRange(range); i++)
+		__atomic_add_fetch(&Visits[i], 1, __ATOMIC_RELAXED);
+}
+
+static ObjectRef doubleEven(ObjectRef object, void *context) {
+	UInteger payload = (UInteger)(uintptr_t)getValuePointer(object);
+	if ( payload % 2 ) return NULL;
+	return autorelease(new(Value, (void *)(uintptr_t)(2 * payload), NULL, NULL));
+}
+
+static void sum(void *accumulator, ObjectRef object, void *context) {
+	*(UInteger *)accumulator += (UInteger)(uintptr_t)getValuePointer(object);
+}
+
+static void add(void *accumulator, const void *partial, void *context) {
+	*(UInteger *)accumulator += *(const UInteger *)partial;
+}
+
+/* Not commutative: a sequence of payloads stays contiguous only when folded in order */
+struct _Sequence {
+	UInteger first;
+	UInteger next;
+	bool contiguous;
+};
+
+static void follow(void *accumulator, ObjectRef object, void *context) {
+	struct _Sequence *sequence = accumulator;
+	UInteger payload = (UInteger)(uintptr_t)getValuePointer(object);
+	if ( sequence->first == 0 ) sequence->first = payload;
+	else if ( payload != sequence->next ) sequence->contiguous = NO;
+	sequence->next = payload + 1;
+}
+
+static void concatenate(void *accumulator, const void *partial, void *context) {
+	struct _Sequence *sequence = accumulator;
+	const struct _Sequence *other = partial;
+	if ( other->first == 0 ) return;
+	if ( sequence->first == 0 ) { *sequence = *other; return; }
+	sequence->contiguous = sequence->contiguous && other->contiguous && other->first == sequence->next;
+	sequence->next = other->next;
+}
+
+static void nestedSum(void *argument) {
+	UInteger total = 0;
+	bool reduced = parallelReduce(Pool, argument, &total, sizeof(UInteger), sum, add, NULL, ThreadPoolParallelAdaptive);
+	assert( reduced );
+	assert( total == ELEMENTS * (ELEMENTS + 1) / 2 );
+	count(NULL);
+}
+
+int main () {
+	{	/* every submitted task runs once */
+		ThreadPoolRef pool = new(ThreadPool, 4UL, NULL);
+		assert( pool != NULL );
+		assert( getThreadPoolWorkerCount(pool) == 4 );
+		
+		Counter = 0;
+		for (UInteger i=0; i<TASKS; i++) {
+			bool submitted = submitTask(pool, count, NULL);
+			assert( submitted );
+		}
+		waitForTasks(pool);
+		assert( Counter == TASKS );
+		assert( getThreadPoolCompletedTaskCount(pool) == TASKS );
+		assert( getThreadPoolPendingTaskCount(pool) == 0 );
+		release(pool);
+	}
+	
+	{	/* tasks submitting tasks */
+		Pool = new(ThreadPool, 3UL, NULL);
+		Counter = 0;
+		for (UInteger i=0; i<TASKS/CHILDREN; i++)
+			submitTask(Pool, spawn, NULL);
+		waitForTasks(Pool);
+		assert( Counter == (TASKS/CHILDREN) * (CHILDREN + 1) );
+		assert( getThreadPoolCompletedTaskCount(Pool) == Counter );
+		assert( getThreadPoolStolenTaskCount(Pool) <= Counter );
+		release(Pool), Pool = NULL;
+	}
+	
+	{	/* the pool of a worker is drained after each task */
+		ThreadPoolRef pool = new(ThreadPool, 2UL, NULL);
+		StringRef string = new(String, "autoreleased", NULL);
+		for (UInteger i=0; i<100; i++)
+			submitTask(pool, autoreleaseArgument, string);
+		waitForTasks(pool);
+		assert( retainCount(string) == 1 );
+		release(string), release(pool);
+	}
+	
+	{	/* shutdown runs what was submitted and refuses the rest */
+		ThreadPoolRef pool = new(ThreadPool, 0UL, NULL);
+		assert( getThreadPoolWorkerCount(pool) >= 1 );
+		Counter = 0;
+		for (UInteger i=0; i<TASKS; i++)
+			submitTask(pool, count, NULL);
+		shutdownThreadPool(pool);
+		assert( Counter == TASKS );
+		errno = 0;
+		bool submitted = submitTask(pool, count, NULL);
+		assert( ! submitted );
+		assert( errno == ECANCELED );
+		shutdownThreadPool(pool);
+		release(pool);
+	}
+	
+	{	/* parallel algorithms */
+		ThreadPoolRef pool = new(ThreadPool, 4UL, NULL);
+		VectorRef values = new(Vector, ELEMENTS, 0UL, NULL);
+		for (UInteger i=0; i<ELEMENTS; i++) {
+			ValueRef value = new(Value, (void *)(uintptr_t)(i + 1), NULL, NULL);
+			addObject(values, value);
+			release(value);
+		}
+		
+		for (UInteger options=ThreadPoolParallelAdaptive; options<=ThreadPoolParallelOrdered; options++) {
+			memset(Visits, 0, sizeof(Visits));
+			bool visited = parallelForRange(pool, values, visit, NULL, options);
+			assert( visited );
+			for (UInteger i=0; i<ELEMENTS; i++)
+				assert( Visits[i] == 1 );
+			
+			VectorRef doubled = new(Vector, 0UL, 0UL, NULL);
+			bool mapped = parallelMapIntoVector(pool, values, doubled, doubleEven, NULL, options);
+			assert( mapped );
+			assert( getCollectionCount(doubled) == ELEMENTS / 2 );
+			for (UInteger i=0; i<ELEMENTS/2; i++)
+				assert( (UInteger)(uintptr_t)getValuePointer(getObjectAtIndex(doubled, i)) == 4 * (i + 1) );
+			assert( retainCount(getObjectAtIndex(doubled, 0)) == 1 );
+			release(doubled);
+			
+			UInteger total = 0;
+			bool reduced = parallelReduce(pool, values, &total, sizeof(UInteger), sum, add, NULL, options);
+			assert( reduced );
+			assert( total == ELEMENTS * (ELEMENTS + 1) / 2 );
+		}
+		
+		struct _Sequence sequence = { 0, 0, YES };
+		bool reduced = parallelReduce(pool, values, &sequence, sizeof(sequence), follow, concatenate, NULL, ThreadPoolParallelOrdered);
+		assert( reduced );
+		assert( sequence.contiguous && sequence.first == 1 && sequence.next == ELEMENTS + 1 );
+		
+		/* A list is gathered once, in order */
+		MutableArrayRef list = new(MutableArray, NULL);
+		for (UInteger i=0; i<ELEMENTS; i++)
+			addObject(list, getObjectAtIndex(values, i));
+		sequence = (struct _Sequence){ 0, 0, YES };
+		reduced = parallelReduce(pool, list, &sequence, sizeof(sequence), follow, concatenate, NULL, ThreadPoolParallelOrdered);
+		assert( reduced );
+		assert( sequence.contiguous && sequence.first == 1 && sequence.next == ELEMENTS + 1 );
+		release(list);
+		
+		MutableArrayRef empty = new(MutableArray, NULL);
+		UInteger total = 7;
+		reduced = parallelReduce(pool, empty, &total, sizeof(UInteger), sum, add, NULL, ThreadPoolParallelOrdered);
+		assert( reduced );
+		assert( total == 7 );
+		release(empty);
+		release(pool);
+		
+		/* from the tasks of the pool itself */
+		Pool = new(ThreadPool, 2UL, NULL);
+		Counter = 0;
+		for (UInteger i=0; i<4; i++)
+			submitTask(Pool, nestedSum, values);
+		waitForTasks(Pool);
+		assert( Counter == 4 );
+		release(Pool), Pool = NULL;
+		release(values);
+	}
+	
+	return 0;
+}
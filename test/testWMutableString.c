@@ -71,6 +71,18 @@ int main () {
 		release(w2Copy);
 	}
 	
+	{ /* appending UTF-8 and wide Strings, the text growing past its capacity */
+		WMutableStringRef growing = new(WMutableString, L"αβ", NULL);
+		StringRef utf8 = new(String, "γδ 𐍆 ascii", NULL);
+		WStringRef wide = new(WString, L"ε五", NULL);
+		for (UInteger i=0; i<20; i++)
+			appendString(growing, utf8), appendString(growing, wide);
+		assert( getStringLength(growing) == 2 + 20 * (10 + 2) );
+		assert( wcsncmp(getWText(growing), L"αβγδ 𐍆 asciiε五γδ", 16) == 0 );
+		assert( wcscmp(getWText(growing) + getStringLength(growing) - 12, L"γδ 𐍆 asciiε五") == 0 );
+		release(wide), release(utf8), release(growing);
+	}
+	
 	release(w1);
 	release(w2);
 	return 0;
@@ -71,6 +71,20 @@ int main () {
 		release(w2Copy);
 	}
 	
+	{ /* UTF-8 */
+		const char *utf8 = "𐍆五色沼 (ごしきぬま) και όλα καλά, my fîrst wïdé strìng磐梯 !";
+		WStringRef fromUTF8 = newWStringWithUTF8Text(WString, utf8, strlen(utf8));
+		assert( fromUTF8 != NULL );
+		assert( wcscmp(getWText(fromUTF8), w1wcs) == 0 );
+		assert( getStringLength(fromUTF8) == wcslen(w1wcs) );
+		StringRef description = copyDescription(w1);
+		assert( strcmp(getStringText(description), utf8) == 0 );
+		assert( isStringValidUTF8(description) );
+		release(description);
+		release(fromUTF8);
+		assert( newWStringWithUTF8Text(WString, "\xF8\x88\x80\x80\x80", 5) == NULL && errno == EILSEQ );
+	}
+	
 	release(w1);
 	release(w2);
 	return 0;
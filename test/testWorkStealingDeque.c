@@ -0,0 +1,133 @@
+//
+//  testWorkStealingDeque.c
+//  CObjects
+//
+//  Created by George Boumis on 19/10/26.
+//  Copyright (c) 2026 George Boumis. All rights reserved.
+//
+
+#include <stdio.h>
+#include <stdint.h>
+#include <sched.h>
+#include <errno.h>
+#include <cobj.h>
+#if DEBUG
+#include <assert.h>
+#else
+#define assert(e)
+#endif /* DEBUG */
+
+#define ITEMS 200000UL
+#define THIEVES 3
+
+static WorkStealingDequeRef Deque = NULL;
+static UInteger Taken[ITEMS];
+static UInteger Done = 0;
+
+static void take(ObjectRef object) {
+	UInteger index = (UInteger)(uintptr_t)getValuePointer(object) - 1;
+	__atomic_add_fetch(&Taken[index], 1, __ATOMIC_RELAXED);
+	release(object);
+}
+
+static void * steal(void *argument) {
+	UInteger *stolen = argument;
+	for (;;) {
+		ObjectRef object = stealDequeObject(Deque);
+		if ( object != NULL )
+			take(object), (*stolen)++;
+		else if ( __atomic_load_n(&Done, __ATOMIC_ACQUIRE) && getCollectionCount(Deque) == 0 )
+			break;
+		else
+			sched_yield();
+	}
+	return NULL;
+}
+
+int main () {
+	{	/* LIFO for the owner, FIFO for the thieves, growing past the initial capacity */
+		WorkStealingDequeRef deque = new(WorkStealingDeque, 2UL, NULL);
+		assert( deque != NULL );
+		ObjectRef none = popDequeObject(deque);
+		assert( none == NULL );
+		none = stealDequeObject(deque);
+		assert( none == NULL );
+		errno = 0;
+		WorkStealingDequeRef tooLarge = new(WorkStealingDeque, UIntegerMax, NULL);
+		assert( tooLarge == NULL && errno == EINVAL );
+		
+		StringRef strings[10];
+		for (int i=0; i<10; i++) {
+			strings[i] = newStringWithFormat(String, "string %d", i, NULL);
+			bool pushed = pushDequeObject(deque, strings[i]);
+			assert( pushed );
+			assert( retainCount(strings[i]) == 2 );
+		}
+		assert( getCollectionCount(deque) == 10 );
+		
+		ObjectRef object = popDequeObject(deque);
+		assert( object == strings[9] );
+		release(object);
+		object = stealDequeObject(deque);
+		assert( object == strings[0] );
+		release(object);
+		assert( getCollectionCount(deque) == 8 );
+		
+		/* The Collection methods see the live range, oldest first */
+		assert( firstObject(deque) == strings[1] );
+		assert( lastObject(deque) == strings[8] );
+		assert( containsObject(deque, strings[4]) );
+		assert( ! containsObject(deque, strings[9]) );
+		int enumerated = 1;
+		foreach_start(StringRef, string, deque) {
+			assert( string == strings[enumerated] );
+			enumerated++;
+		} foreach_end()
+		assert( enumerated == 9 );
+		
+		/* The remaining ones are released with the deque */
+		release(deque);
+		for (int i=0; i<10; i++) {
+			assert( retainCount(strings[i]) == 1 );
+			release(strings[i]);
+		}
+	}
+	
+	{	/* Stress: the owner pushes and pops while thieves steal, every object is taken exactly once */
+		Deque = new(WorkStealingDeque, 16UL, NULL);
+		UInteger stolen[THIEVES] = { 0 };
+		ThreadRef thieves[THIEVES];
+		for (int i=0; i<THIEVES; i++) {
+			thieves[i] = new(Thread, steal, &stolen[i], NULL);
+			startThread(thieves[i]);
+		}
+		
+		UInteger popped = 0;
+		for (UInteger i=0; i<ITEMS; i++) {
+			ValueRef value = new(Value, (void *)(uintptr_t)(i + 1), NULL, NULL);
+			pushDequeObject(Deque, value);
+			release(value);
+			if ( i % 3 == 0 ) {
+				ObjectRef object = popDequeObject(Deque);
+				if ( object != NULL )
+					take(object), popped++;
+			}
+		}
+		ObjectRef object = NULL;
+		while ( (object = popDequeObject(Deque)) != NULL )
+			take(object), popped++;
+		__atomic_store_n(&Done, 1, __ATOMIC_RELEASE);
+		
+		UInteger total = popped;
+		for (int i=0; i<THIEVES; i++) {
+			joinThread(thieves[i], NULL), release(thieves[i]);
+			total += stolen[i];
+		}
+		assert( total == ITEMS );
+		for (UInteger i=0; i<ITEMS; i++)
+			assert( Taken[i] == 1 );
+		release(Deque);
+	}
+	
+	return 0;
+}